@@ -0,0 +1,202 @@
+#ifndef SBX_ALLOCATOR_H
+#define SBX_ALLOCATOR_H
+
+// Project headers
+#include <SBX/types.h>
+#include <SBX/report.h>
+
+// LibC headers
+#include <stddef.h>
+#include <stdatomic.h>
+#include <threads.h>
+
+// Memory subsystems, every allocation is accounted to one of them
+enum SBXMemorySubsystems {
+    // SBXBox structures and chunk tables
+    SBX_MEMORY_SUBSYSTEM_BOX             = 0,
+    // SBXChunkData structures
+    SBX_MEMORY_SUBSYSTEM_CHUNK           = 1,
+    // Plock and free plock ID arrays
+    SBX_MEMORY_SUBSYSTEM_PLOCK_ARRAY     = 2,
+    // Plock ID matrices
+    SBX_MEMORY_SUBSYSTEM_PLOCK_ID_MATRIX = 3,
+    // Queued box commands and the buffers used to apply them
+    SBX_MEMORY_SUBSYSTEM_COMMAND         = 4,
+    // Change subscribers and change buffers
+    SBX_MEMORY_SUBSYSTEM_CHANGES         = 5,
+    // Save snapshots and serialization buffers
+    SBX_MEMORY_SUBSYSTEM_SAVE            = 6,
+    // Particle pools
+    SBX_MEMORY_SUBSYSTEM_PARTICLE        = 7,
+    // SBXWindow structures and OpenGL contexts
+    SBX_MEMORY_SUBSYSTEM_WINDOW          = 8,
+    // Thermal active sets and temperature change buffers
+    SBX_MEMORY_SUBSYSTEM_THERMAL         = 9,
+    // Gas fields
+    SBX_MEMORY_SUBSYSTEM_GAS             = 10,
+    // Connected component labels
+    SBX_MEMORY_SUBSYSTEM_COMPONENTS      = 11,
+    // Color pyramids and renderer upload buffers
+    SBX_MEMORY_SUBSYSTEM_RENDER          = 12,
+    // Slab structures and their pending migrations, the shared memory of a slab group is mapped and not accounted
+    SBX_MEMORY_SUBSYSTEM_SLAB            = 13,
+    // Worker pools and their placement and run buffers
+    SBX_MEMORY_SUBSYSTEM_WORKERS         = 14,
+    // Task graphs and the frames built on them
+    SBX_MEMORY_SUBSYSTEM_TASKS           = 15,
+
+    SBX_MEMORY_SUBSYSTEM_COUNT
+};
+
+// Size of the huge pages mapped allocators align their arena to
+#define SBX_ALLOCATOR_HUGE_PAGE_SIZE   ((size_t)2 << 20)
+// Number of distinct allocation sizes an arena recycles freed memory for
+#define SBX_ALLOCATOR_SIZE_CLASS_COUNT 8
+
+// Mapped allocator flags
+enum SBXAllocatorFlags {
+    // Ask for transparent huge pages on the arena
+    SBX_ALLOCATOR_FLAG_HUGE_PAGES          = 1 << 0,
+    // Map the arena from the reserved huge page pool, falls back to SBX_ALLOCATOR_FLAG_HUGE_PAGES when the pool is too small
+    SBX_ALLOCATOR_FLAG_EXPLICIT_HUGE_PAGES = 1 << 1,
+    // Fault the arena in on a background thread so first writes to fresh chunks don't stall the simulation
+    SBX_ALLOCATOR_FLAG_PREFAULT            = 1 << 2
+};
+
+/// @brief Allocation function used by a SBXAllocator, works like realloc when newSize is above 0 and like free when it is 0.
+///        pointer is SBX_POINTER_UNSET and oldSize 0 for new allocations. Must be safe to call from any thread, chunk storage can be freed by save threads.
+typedef void* (*SBX_allocator_callback_t)(void* userData, void* pointer, size_t oldSize, size_t newSize);
+
+/// @brief Structure used by SBXAllocator* functions to store an allocation function and the memory accounted to every subsystem
+struct SBXAllocator {
+    /// @brief SBX_allocator_callback_t object used to store the function every allocation goes through
+    SBX_allocator_callback_t callback;
+    /// @brief Pointer passed to the callback untouched
+    void*                    userData;
+
+    /// @brief size_t object used to store the most bytes that can be allocated at once across every subsystem, 0 for no limit
+    size_t                   budget;
+    /// @brief Bytes allocated across every subsystem
+    _Atomic size_t           totalBytes;
+    /// @brief Bytes allocated by every subsystem
+    _Atomic size_t           bytes[SBX_MEMORY_SUBSYSTEM_COUNT];
+    /// @brief Live allocations of every subsystem
+    _Atomic size_t           allocations[SBX_MEMORY_SUBSYSTEM_COUNT];
+
+    /// @brief Bump allocation state of arena and mapped allocators, the arena is only reset by destroying the allocator
+    uint8_t*                 arena;
+    size_t                   arenaSize, arenaUsed;
+    /// @brief Sizes freed arena memory is recycled for and the free list of each, 0 for unused size classes
+    size_t                   arenaClassSizes[SBX_ALLOCATOR_SIZE_CLASS_COUNT];
+    void*                    arenaClassFreeLists[SBX_ALLOCATOR_SIZE_CLASS_COUNT];
+    /// @brief SBX_bool_t object used to keep whether the arena was mapped rather than allocated with malloc
+    SBX_bool_t               arenaMapped;
+    /// @brief Free list of pool allocators, holding blocks of poolBlockSize bytes
+    uint8_t*                 pool;
+    void*                    poolFreeList;
+    size_t                   poolBlockSize, poolBlockCount;
+    /// @brief mtx_t object used to serialize arena and pool allocators
+    mtx_t                    lock;
+
+    /// @brief thrd_t object used to keep the prefault thread handle of mapped allocators created with SBX_ALLOCATOR_FLAG_PREFAULT
+    thrd_t                   prefaultThread;
+    /// @brief SBX_bool_t object used to keep whether the prefault thread was started
+    SBX_bool_t               prefaulting;
+    /// @brief atomic_bool object set to stop the prefault thread early
+    atomic_bool              prefaultStop;
+    /// @brief Bytes from the start of the arena the prefault thread has faulted in
+    _Atomic size_t           prefaulted;
+};
+
+/// @brief Allocates a SBXAllocator object that sends every allocation through a callback.
+/// @param allocator A pointer to a SBX_allocator_t pointer that will be set to the new object, cannot be SBX_POINTER_UNSET
+/// @param callback  The allocation function, SBX_POINTER_UNSET uses malloc, realloc, and free
+/// @param userData  Pointer passed to the callback untouched, can be SBX_POINTER_UNSET
+/// @param budget    The most bytes that can be allocated at once, 0 for no limit
+/// @return A SBXReport struct that reports the return state of the creation function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXAllocatorCreate(SBX_allocator_t** allocator, SBX_allocator_callback_t callback, void* userData, size_t budget);
+
+/// @brief Allocates a SBXAllocator object that hands out memory from one block of size bytes.
+///        Freed memory is reused in place when it was the last allocation, and otherwise for later allocations of the same size,
+///        up to SBX_ALLOCATOR_SIZE_CLASS_COUNT different sizes. Suited to boxes with a known lifetime, everything is released at once when the allocator is destroyed.
+/// @param allocator A pointer to a SBX_allocator_t pointer that will be set to the new object, cannot be SBX_POINTER_UNSET
+/// @param size      The size of the arena in bytes, cannot be 0
+/// @param budget    The most bytes that can be allocated at once, 0 for no limit other than the arena size
+/// @return A SBXReport struct that reports the return state of the creation function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE, SBX_COMMON_ERROR_THREAD_FAILURE
+SBX_report_t SBXAllocatorCreateArena(SBX_allocator_t** allocator, size_t size, size_t budget);
+
+/// @brief Allocates an arena allocator like SBXAllocatorCreateArena whose arena is mapped straight from the OS, optionally on huge pages and faulted in ahead of use.
+///        Large boxes touch their chunk storage for the first time spread over many ticks, mapping it on huge pages cuts TLB misses and prefaulting it
+///        moves the page faults to a background thread at startup. Flags that aren't supported on the platform are ignored.
+/// @param allocator A pointer to a SBX_allocator_t pointer that will be set to the new object, cannot be SBX_POINTER_UNSET
+/// @param size      The size of the arena in bytes, rounded up to SBX_ALLOCATOR_HUGE_PAGE_SIZE, cannot be 0
+/// @param flags     A combination of SBXAllocatorFlags values
+/// @param budget    The most bytes that can be allocated at once, 0 for no limit other than the arena size
+/// @return A SBXReport struct that reports the return state of the creation function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE, SBX_COMMON_ERROR_THREAD_FAILURE
+SBX_report_t SBXAllocatorCreateMapped(SBX_allocator_t** allocator, size_t size, SBX_bit_flags_t flags, size_t budget);
+
+/// @brief Allocates a SBXAllocator object that hands out blockCount fixed size blocks from a free list, allocations larger than a block use malloc.
+///        Suited to the many same sized chunk allocations of a box.
+/// @param allocator  A pointer to a SBX_allocator_t pointer that will be set to the new object, cannot be SBX_POINTER_UNSET
+/// @param blockSize  The size of a block in bytes, cannot be 0
+/// @param blockCount The number of blocks, cannot be 0
+/// @param budget     The most bytes that can be allocated at once, 0 for no limit
+/// @return A SBXReport struct that reports the return state of the creation function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE, SBX_COMMON_ERROR_THREAD_FAILURE
+SBX_report_t SBXAllocatorCreatePool(SBX_allocator_t** allocator, size_t blockSize, size_t blockCount, size_t budget);
+
+/// @brief Deallocates a SBXAllocator object, every object allocated through it must be destroyed first.
+/// @param allocator A SBX_allocator_t pointer to the desired SBXAllocator to be destroyed, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the destruction function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXAllocatorDestroy(SBX_allocator_t* allocator);
+
+/// @brief Gets how far the prefault thread of a mapped allocator got, equal to the arena size once it is done.
+/// @param allocator  SBXAllocator struct used to retrieve the progress, cannot be SBX_POINTER_UNSET
+/// @param prefaulted A pointer to a size_t variable to store the bytes faulted in from the start of the arena, 0 for allocators without a prefault thread
+/// @return A SBXReport struct that reports the return state of the query function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXAllocatorGetPrefaultProgress(SBX_allocator_t* allocator, size_t* prefaulted);
+
+/// @brief Gets the allocator used by objects created without one, it uses malloc, realloc, and free without a budget.
+/// @param allocator A pointer to a SBX_allocator_t pointer to store the default allocator in, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the query function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXAllocatorGetDefault(SBX_allocator_t** allocator);
+
+/// @brief Gets the bytes and live allocations accounted to a subsystem, SBX_MEMORY_SUBSYSTEM_COUNT gets the totals of every subsystem.
+/// @param allocator   SBXAllocator struct used to retrieve the counters, SBX_POINTER_UNSET for the default allocator
+/// @param subsystem   The SBXMemorySubsystems value to query
+/// @param bytes       A pointer to a size_t variable to store the bytes in, can be SBX_POINTER_UNSET
+/// @param allocations A pointer to a size_t variable to store the live allocations in, can be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the query function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXAllocatorGetUsage(SBX_allocator_t* allocator, SBX_memory_subsystem_t subsystem, size_t* bytes, size_t* allocations);
+
+/// @brief Allocates size bytes accounted to a subsystem, used in place of malloc by every SBX object.
+/// @param allocator SBXAllocator struct to allocate from, SBX_POINTER_UNSET for the default allocator
+/// @param subsystem The SBXMemorySubsystems value to account the allocation to
+/// @param size      The amount of bytes to allocate
+/// @return The new allocation, or SBX_POINTER_UNSET if the callback failed or the allocation would go over the budget
+void* SBXAllocatorAllocate(SBX_allocator_t* allocator, SBX_memory_subsystem_t subsystem, size_t size);
+
+/// @brief Resizes an allocation from oldSize to newSize bytes, used in place of realloc by every SBX object.
+/// @param allocator SBXAllocator struct the allocation came from, SBX_POINTER_UNSET for the default allocator
+/// @param subsystem The SBXMemorySubsystems value the allocation is accounted to
+/// @param pointer   The allocation to resize, SBX_POINTER_UNSET allocates
+/// @param oldSize   The size the allocation was made with, 0 when pointer is SBX_POINTER_UNSET
+/// @param newSize   The new size of the allocation, must be above 0
+/// @return The resized allocation, or SBX_POINTER_UNSET leaving the old allocation untouched if the callback failed or the budget was hit
+void* SBXAllocatorReallocate(SBX_allocator_t* allocator, SBX_memory_subsystem_t subsystem, void* pointer, size_t oldSize, size_t newSize);
+
+/// @brief Frees an allocation of size bytes, used in place of free by every SBX object, can be called from any thread.
+/// @param allocator SBXAllocator struct the allocation came from, SBX_POINTER_UNSET for the default allocator
+/// @param subsystem The SBXMemorySubsystems value the allocation is accounted to
+/// @param pointer   The allocation to free, SBX_POINTER_UNSET does nothing
+/// @param size      The size the allocation was made with
+void SBXAllocatorFree(SBX_allocator_t* allocator, SBX_memory_subsystem_t subsystem, void* pointer, size_t size);
+
+#endif // SBX_ALLOCATOR_H
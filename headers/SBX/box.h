@@ -2,23 +2,70 @@
 #define SBX_BOX_H
 
 // Project headers
+#include <SBX/allocator.h>
+#include <SBX/changes.h>
+#include <SBX/command.h>
+#include <SBX/chunk.h>
+#include <SBX/lod.h>
 #include <SBX/plock.h>
+#include <SBX/thermal.h>
 #include <SBX/types.h>
 #include <SBX/report.h>
 
 /// @brief Structure used by SBXBox* functions to store dimension and plock data required to represent a box
 struct SBXBox {
+    /// @brief SBX_allocator_t pointer to the allocator the box, its chunk table, and new chunk storage are allocated from, SBX_POINTER_UNSET for the default allocator
+    SBX_allocator_t*       allocator;
+
     /// @brief SBX_bool_t object used to keep initialization state
-    SBX_bool_t            initialized;
+    SBX_bool_t             initialized;
 
     /// @brief SBX_box_dimensions_t object used to keep box width
-    SBX_box_dimensions_t  width;
+    SBX_box_dimensions_t   width;
     /// @brief SBX_box_dimensions_t object used to keep box height
-    SBX_box_dimensions_t  height;
+    SBX_box_dimensions_t   height;
+
+    /// @brief SBX_chunk_dimensions_t object used to keep the number of chunk columns in the chunk table
+    SBX_chunk_dimensions_t chunkColumns;
+    /// @brief SBX_chunk_dimensions_t object used to keep the number of chunk rows in the chunk table
+    SBX_chunk_dimensions_t chunkRows;
+
+    /// @brief SBX_chunk_t array used to store the plocks of the box in row-major SBX_CHUNK_SIZE by SBX_CHUNK_SIZE chunks
+    SBX_chunk_t*           chunks;
+
+    /// @brief SBX_chunk_index_t object used to keep the chunk SBXBoxDefragment continues from
+    SBX_chunk_index_t      defragmentCursor;
+
+    /// @brief SBX_plock_count_t array used to keep the number of set plocks of every plock type, updated on every plock write
+    SBX_plock_count_t      plockTypeCounts[SBX_PLOCK_TYPE_COUNT];
+
+    /// @brief SBX_box_tick_t object used to keep the number of steps the box has taken
+    SBX_box_tick_t         tick;
 
-    /// @brief SBX_plock_array_t object used to store all the plocks associated with 
-    SBX_plock_array_t     plockArray;
-    SBX_plock_id_matrix_t plockIDMatrix;
+    /// @brief SBX_box_command_queue_t object used to receive edit commands from any thread, drained at the start of every step
+    SBX_box_command_queue_t commandQueue;
+    /// @brief SBX_box_command_t pointer array used as scratch space for the commands drained in a step
+    SBX_box_command_t**    commandBatch;
+    /// @brief uint32_t object used to keep the number of commands the command batch has room for
+    uint32_t               commandBatchCapacity;
+    /// @brief SBX_box_command_cell_t array used as a hash table of the positions seen while coalescing commands
+    SBX_box_command_cell_t* commandCells;
+    /// @brief uint32_t object used to keep the number of cells in the command cell table, always a power of 2
+    uint32_t               commandCellCapacity;
+    /// @brief uint32_t object used to keep the coalescing pass the command cell table is on
+    uint32_t               commandGeneration;
+
+    /// @brief SBX_box_change_tracker_t object used to keep change subscribers and the changes waiting to be delivered to them
+    SBX_box_change_tracker_t changes;
+
+    /// @brief SBX_plock_t object used to keep the plock every position outside the box reads as, a type of SBX_PLOCK_TYPE_ID_UNSET for void
+    SBX_plock_t            boundary;
+    /// @brief SBX_box_thermal_t object used to keep the thermal settings and the chunks temperature may still flow in
+    SBX_box_thermal_t      thermal;
+    /// @brief SBX_box_lod_t object used to keep the viewport and how often chunks away from it are simulated
+    SBX_box_lod_t          lod;
+    /// @brief SBX_workers_t pointer to the pool the per chunk passes of a step run on, SBX_POINTER_UNSET to run them on the stepping thread
+    SBX_workers_t*         workers;
 };
 
 
@@ -28,6 +75,14 @@ struct SBXBox {
 ///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE
 SBX_report_t SBXBoxCreate(SBX_box_t** box);
 
+/// @brief Allocates memory for a SBXBox object from an allocator and then sets values to a deinitialized state.
+///        Everything the box allocates goes through the allocator, which must outlive the box and every snapshot or clone sharing its chunks.
+/// @param box       A pointer to a SBX_box_t pointer that will be set to the new object, cannot be SBX_POINTER_UNSET
+/// @param allocator The allocator to allocate from, SBX_POINTER_UNSET for the default allocator
+/// @return A SBXReport struct that reports the return state of the creation function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXBoxCreateWithAllocator(SBX_box_t** box, SBX_allocator_t* allocator);
+
 /// @brief Deallocates a SBXBox objects memory after check for deinitialization
 /// @param box A SBX_box_t pointer to the desired SBXBox to be destroyed, cannot be SBX_POINTER_UNSET
 /// @return A SBXReport struct that reports the return state of the destruction function, this can be an error, or a success.
@@ -67,7 +122,75 @@ SBX_report_t SBXBoxGetSize(SBX_box_t* box, SBX_box_dimensions_t* width, SBX_box_
 /// @param height The desired height for the box, cannot be SBX_DIMENSION_UNSET
 /// @return A SBXReport struct that reports the return state of the size setting function, this can be an error, or a success
 ///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT,
-///                                  SBX_BOX_ERROR_PLOCKS_INIT_FAILED, SBX_BOX_ERROR_PLOCK_IDS_INIT_FAILED
+///                                  SBX_COMMON_ERROR_MEMORY_FAILURE
 SBX_report_t SBXBoxSetSize(SBX_box_t* box, SBX_box_dimensions_t width, SBX_box_dimensions_t height);
 
+/// @brief Gets the plock at a position in the supplied box, unset positions give a plock with SBX_PLOCK_TYPE_ID_UNSET and SBX_TEMPERATURE_UNSET
+/// @param box SBXBox struct used to retrieve, store, and check plock query related box data, cannot be SBX_POINTER_UNSET
+/// @param x     The x position of the plock, must be less than the box width
+/// @param y     The y position of the plock, must be less than the box height
+/// @param plock A pointer to a SBX_plock_t variable to store the plock in, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the plock query function, this can be an error, or a success
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT,
+///                                  SBX_BOX_ERROR_OUT_OF_BOUNDS
+SBX_report_t SBXBoxGetPlock(SBX_box_t* box, SBX_box_position_t x, SBX_box_position_t y, SBX_plock_t* plock);
+
+/// @brief Sets the plock at a position in the supplied box, a plock type of SBX_PLOCK_TYPE_ID_UNSET unsets the position.
+///        Chunks shared with a snapshot or another box are copied on their first write.
+/// @param box SBXBox struct used to retrieve, store, and check plock setting related box data, cannot be SBX_POINTER_UNSET
+/// @param x     The x position of the plock, must be less than the box width
+/// @param y     The y position of the plock, must be less than the box height
+/// @param plock The desired plock for the position
+/// @return A SBXReport struct that reports the return state of the plock setting function, this can be an error, or a success
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT,
+///                                  SBX_BOX_ERROR_OUT_OF_BOUNDS, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXBoxSetPlock(SBX_box_t* box, SBX_box_position_t x, SBX_box_position_t y, SBX_plock_t plock);
+
+/// @brief Writes a plock into a chunk of the supplied box, copying shared chunk storage first and letting subscribers, stats, and the thermal pass know.
+///        Does not check its arguments, SBXBoxSetPlock checks them and SBXBoxSetPlockUnchecked asserts them.
+/// @param box    SBXBox struct used to store the plock, must be initialized
+/// @param chunk  The chunk of the box table to write into
+/// @param localX The x position in the chunk, must be below SBX_CHUNK_SIZE and inside the box
+/// @param localY The y position in the chunk, must be below SBX_CHUNK_SIZE and inside the box
+/// @param plock  The desired plock for the position
+/// @return A SBXReport struct that reports the return state of the write, this can be an error, or a success
+///         Possible errors include: SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXBoxWriteChunkPlock(SBX_box_t* box, SBX_chunk_t* chunk, SBX_box_position_t localX, SBX_box_position_t localY, SBX_plock_t plock);
+
+/// @brief Initializes a deinitialized box as a clone of another, sharing its chunk storage until either box first writes to a chunk.
+///        Cloning is O(chunks), memory only grows as the boxes diverge. Must be called from the thread that owns the source box.
+/// @param box   SBXBox struct used to retrieve and check the box data to clone, cannot be SBX_POINTER_UNSET
+/// @param clone SBXBox struct used to store the cloned box data, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the clone function, this can be an error, or a success
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT,
+///                                  SBX_BOX_ERROR_ALREADY_INIT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXBoxClone(SBX_box_t* box, SBX_box_t* clone);
+
+/// @brief Renumbers the plock IDs of up to chunkBudget chunks along a Z-order curve, continuing from where the last call stopped.
+///        Only chunks that acquired or released plock IDs since their last renumbering count against the budget, shared chunks are skipped.
+/// @param box         SBXBox struct used to retrieve, store, and check defragmentation related box data, cannot be SBX_POINTER_UNSET
+/// @param chunkBudget The maximum amount of chunks to renumber, 0 renumbers every chunk that needs it
+/// @return A SBXReport struct that reports the return state of the defragmentation function, this can be an error, or a success
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXBoxDefragment(SBX_box_t* box, SBX_chunk_index_t chunkBudget);
+
+/// @brief Gets the content hash of a chunk of the supplied box, kept up to date on every plock write so reading it is O(1).
+///        Empty chunks hash to 0, chunks with equal plocks hash equal no matter how their plock IDs are numbered or whether their storage is shared.
+/// @param box        SBXBox struct used to retrieve the chunk, cannot be SBX_POINTER_UNSET
+/// @param chunkIndex The row-major index of the chunk in the chunk table
+/// @param hash       A pointer to a uint64_t variable to store the hash in, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the hash query function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT, SBX_BOX_ERROR_OUT_OF_BOUNDS
+SBX_report_t SBXBoxGetChunkHash(SBX_box_t* box, SBX_chunk_index_t chunkIndex, uint64_t* hash);
+
+/// @brief Gets a hash of the whole supplied box from its size and chunk content hashes, O(chunks). Boxes with equal sizes and plocks hash equal.
+/// @param box  SBXBox struct used to retrieve the chunks, cannot be SBX_POINTER_UNSET
+/// @param hash A pointer to a uint64_t variable to store the hash in, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the hash query function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT
+SBX_report_t SBXBoxGetHash(SBX_box_t* box, uint64_t* hash);
+
+// Unchecked accessors, included last as they need the declarations above, and with SBX_UNCHECKED_API they replace some of them
+#include <SBX/unchecked.h>
+
 #endif // SBX_BOX_H
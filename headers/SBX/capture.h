@@ -0,0 +1,88 @@
+#ifndef SBX_CAPTURE_H
+#define SBX_CAPTURE_H
+
+// Project headers
+#include <SBX/window.h>
+#include <SBX/types.h>
+#include <SBX/report.h>
+
+// Pixel buffers a capture reads back into, one can be read back into while the one before it is still being copied out
+#define SBX_CAPTURE_BUFFER_COUNT 2
+// Bytes of one captured RGBA8 pixel
+#define SBX_CAPTURE_PIXEL_SIZE   4
+// Nanoseconds waited on a readback at once, waits go on until the readback is done, this only bounds a single fence wait
+#define SBX_CAPTURE_WAIT_TIMEOUT 1000000000ull
+
+/// @brief Function called by SBXCapture* functions with the pixels of a finished readback, on the thread the capture is used from.
+///        The pixels are RGBA8, rows bottom to top as OpenGL reads them, and are only valid until the function returns.
+typedef SBX_report_t (*SBX_capture_callback_t)(void* userData, uint64_t tag, const uint8_t* pixels, uint32_t width, uint32_t height);
+
+/// @brief Structure used by SBXCapture* functions to keep a framebuffer for a renderer to draw to and read its pixels back without stalling.
+///        Every read copies the framebuffer into the next pixel buffer and returns, the pixels are handed to the callback once the copy is done,
+///        so drawing the next frame overlaps the transfer of the one before.
+struct SBXCapture {
+    /// @brief SBX_window_t pointer to the window whose OpenGL context the capture objects belong to, it must be current on the capturing thread
+    SBX_window_t*          window;
+
+    /// @brief GLuint objects used to store the framebuffer drawn to and its RGBA8 color renderbuffer
+    GLuint                 framebuffer, colorbuffer;
+    /// @brief uint32_t objects used to keep the size of the framebuffer in pixels
+    uint32_t               width, height;
+
+    /// @brief GLuint array used to store the pixel buffers framebuffer contents are read back into, used in turn
+    GLuint                 pixelBuffers[SBX_CAPTURE_BUFFER_COUNT];
+    /// @brief GLsync array used to store the fence signaled once the readback into every pixel buffer is done, 0 for pixel buffers without one
+    GLsync                 fences[SBX_CAPTURE_BUFFER_COUNT];
+    /// @brief uint64_t array used to store the tag every pending readback was started with
+    uint64_t               tags[SBX_CAPTURE_BUFFER_COUNT];
+    /// @brief uint32_t objects used to keep the pixel buffer of the oldest pending readback and the number of pending readbacks
+    uint32_t               oldest, pendingCount;
+
+    /// @brief SBX_capture_callback_t object used to store the function finished readbacks are handed to
+    SBX_capture_callback_t callback;
+    /// @brief void pointer passed to the callback
+    void*                  userData;
+
+    /// @brief uint64_t object used to store the number of reads that had to wait for a readback before them to finish, because every pixel buffer was in use
+    uint64_t               stallCount;
+};
+
+/// @brief Allocates memory for a SBXCapture object and creates its framebuffer and pixel buffers in the OpenGL context of a window.
+///        The memory is accounted to SBX_MEMORY_SUBSYSTEM_RENDER of the default allocator.
+/// @param capture  A pointer to a SBX_capture_t pointer that will be set to the new object, cannot be SBX_POINTER_UNSET
+/// @param window   SBXWindow struct whose OpenGL context is used, must be initialized and current, cannot be SBX_POINTER_UNSET
+/// @param width    The width of the framebuffer in pixels, cannot be 0
+/// @param height   The height of the framebuffer in pixels, cannot be 0
+/// @param callback The function finished readbacks are handed to, cannot be SBX_POINTER_UNSET
+/// @param userData Passed to the callback, can be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the creation function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_WINDOW_ERROR_NOT_INIT, SBX_COMMON_ERROR_MEMORY_FAILURE,
+///                                  SBX_CAPTURE_ERROR_FRAMEBUFFER_INCOMPLETE
+SBX_report_t SBXCaptureCreate(SBX_capture_t** capture, SBX_window_t* window, uint32_t width, uint32_t height, SBX_capture_callback_t callback, void* userData);
+
+/// @brief Hands every pending readback to the callback, then deletes the OpenGL objects of a SBXCapture and deallocates its memory.
+///        The OpenGL context of its window must still be current, pending readbacks are dropped if it isn't initialized anymore.
+/// @param capture A SBX_capture_t pointer to the desired SBXCapture to be destroyed, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the destruction function, this can be an error, or a success.
+///         The capture is destroyed even on errors, which come from the last readbacks.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_CAPTURE_ERROR_READBACK_FAILED, errors of the callback
+SBX_report_t SBXCaptureDestroy(SBX_capture_t* capture);
+
+/// @brief Starts reading the framebuffer back into the next pixel buffer without waiting for it, after everything drawn to it so far.
+///        Finished readbacks are handed to the callback first, and when every pixel buffer is still in use the oldest readback is waited for.
+/// @param capture SBXCapture struct used to read back, cannot be SBX_POINTER_UNSET
+/// @param tag     Passed to the callback with the pixels, such as a frame number
+/// @return A SBXReport struct that reports the return state of the read function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_WINDOW_ERROR_NOT_INIT, SBX_CAPTURE_ERROR_READBACK_FAILED,
+///                                  errors of the callback
+SBX_report_t SBXCaptureRead(SBX_capture_t* capture, uint64_t tag);
+
+/// @brief Hands finished readbacks to the callback, oldest first, stopping at the first error.
+/// @param capture SBXCapture struct used to retrieve the readbacks, cannot be SBX_POINTER_UNSET
+/// @param wait    Whether to wait for every pending readback, such as after the last read of a batch, or only take the ones already done
+/// @return A SBXReport struct that reports the return state of the collection function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_WINDOW_ERROR_NOT_INIT, SBX_CAPTURE_ERROR_READBACK_FAILED,
+///                                  errors of the callback
+SBX_report_t SBXCaptureCollect(SBX_capture_t* capture, SBX_bool_t wait);
+
+#endif // SBX_CAPTURE_H
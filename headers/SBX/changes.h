@@ -0,0 +1,156 @@
+#ifndef SBX_CHANGES_H
+#define SBX_CHANGES_H
+
+// Project headers
+#include <SBX/allocator.h>
+#include <SBX/types.h>
+#include <SBX/report.h>
+
+// Number of possible from, to plock type pairs
+#define SBX_BOX_TRANSITION_COUNT (SBX_PLOCK_TYPE_COUNT * SBX_PLOCK_TYPE_COUNT)
+
+/// @brief Structure used by SBXBoxChangeTracker to keep the changed local positions of one chunk, empty while minimumX is above maximumX
+struct SBXChunkBounds {
+    /// @brief uint8_t objects used to keep the smallest and largest changed local positions
+    uint8_t    minimumX, minimumY, maximumX, maximumY;
+    /// @brief SBX_bool_t object used to keep whether any changed position changed plock type
+    SBX_bool_t typesChanged;
+};
+
+/// @brief Structure used by SBXBoxChanges to describe the part of a chunk that changed, in box coordinates
+struct SBXBoxDirtyRect {
+    /// @brief SBX_box_position_t objects used to store the top left corner of the rectangle
+    SBX_box_position_t   x, y;
+    /// @brief SBX_box_dimensions_t objects used to store the size of the rectangle
+    SBX_box_dimensions_t width, height;
+    /// @brief SBX_bool_t object used to store whether any plock in the rectangle changed type, false when only temperatures were written
+    SBX_bool_t           typesChanged;
+};
+
+/// @brief Structure used by SBXBoxChanges to describe how many plocks went from one plock type to another
+struct SBXBoxTransition {
+    /// @brief SBX_plock_type_id_t objects used to store the plock type before and after, SBX_PLOCK_TYPE_ID_UNSET for unset positions
+    SBX_plock_type_id_t from, to;
+    /// @brief SBX_plock_count_t object used to store the number of plocks that made the transition
+    SBX_plock_count_t   count;
+};
+
+/// @brief Structure passed to SBX_box_change_callback_t subscribers holding everything that changed in a box since the last delivery
+struct SBXBoxChanges {
+    /// @brief SBX_box_tick_t object used to store the tick the changes were delivered on
+    SBX_box_tick_t              tick;
+
+    /// @brief SBX_bool_t object used to store whether the box was resized, initialized, or loaded, the whole box should be treated as changed
+    SBX_bool_t                  resized;
+
+    /// @brief SBX_box_dirty_rect_t array holding one rectangle per changed chunk, bounding every changed position in it
+    const SBX_box_dirty_rect_t* rects;
+    /// @brief SBX_chunk_index_t object used to store the number of rectangles
+    SBX_chunk_index_t           rectCount;
+
+    /// @brief SBX_box_transition_t array holding one entry per plock type pair that changed at least one plock
+    const SBX_box_transition_t* transitions;
+    /// @brief uint32_t object used to store the number of transitions
+    uint32_t                    transitionCount;
+};
+
+/// @brief Structure used by SBXBoxChangeTracker to store one subscriber
+struct SBXBoxSubscription {
+    /// @brief SBX_box_subscription_id_t object used to store the ID given out by SBXBoxSubscribe
+    SBX_box_subscription_id_t id;
+    /// @brief SBX_box_change_callback_t object used to store the function to deliver changes to
+    SBX_box_change_callback_t callback;
+    /// @brief Pointer passed back to the callback untouched
+    void*                     userData;
+};
+
+/// @brief Structure used by SBXBox* functions to store subscribers and the changes waiting to be delivered to them
+struct SBXBoxChangeTracker {
+    /// @brief SBX_allocator_t pointer to the allocator the subscribers and change buffers are allocated from
+    SBX_allocator_t*          allocator;
+
+    /// @brief SBX_box_subscription_t array used to store the subscribers in subscription order
+    SBX_box_subscription_t*   subscriptions;
+    /// @brief uint32_t objects used to keep the number of subscribers and the number the array has room for
+    uint32_t                  subscriptionCount, subscriptionCapacity;
+    /// @brief SBX_box_subscription_id_t object used to keep the ID the next subscriber gets
+    SBX_box_subscription_id_t nextSubscriptionID;
+
+    /// @brief SBX_chunk_bounds_t array used to keep the changed positions of every chunk, indexed like the chunk table
+    SBX_chunk_bounds_t*       chunkBounds;
+    /// @brief SBX_chunk_index_t array used to keep the chunks with changes in the order they first changed
+    SBX_chunk_index_t*        dirtyChunks;
+    /// @brief SBX_box_dirty_rect_t array used as scratch space for the rectangles of a delivery
+    SBX_box_dirty_rect_t*     rects;
+    /// @brief SBX_chunk_index_t objects used to keep the number of dirty chunks and the number of chunks the arrays have room for
+    SBX_chunk_index_t         dirtyChunkCount, chunkCapacity;
+
+    /// @brief SBX_plock_count_t array used to keep the number of plocks of every from, to plock type pair, indexed by from * SBX_PLOCK_TYPE_COUNT + to
+    SBX_plock_count_t*        transitionCounts;
+    /// @brief uint16_t array used to keep the plock type pairs with a non-zero count
+    uint16_t*                 transitionKeys;
+    /// @brief SBX_box_transition_t array used as scratch space for the transitions of a delivery
+    SBX_box_transition_t*     transitions;
+    /// @brief uint32_t object used to keep the number of plock type pairs with a non-zero count
+    uint32_t                  transitionKeyCount;
+
+    /// @brief SBX_bool_t object used to keep whether the box was resized since the last delivery
+    SBX_bool_t                resized;
+};
+
+/// @brief Sets up a change tracker without subscribers or changes.
+/// @param tracker   SBXBoxChangeTracker struct used to store the tracker, cannot be SBX_POINTER_UNSET
+/// @param allocator The allocator to allocate subscribers and change buffers from, SBX_POINTER_UNSET for the default allocator
+/// @return A SBXReport struct that reports the return state of the tracker initialization function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXBoxChangeTrackerInit(SBX_box_change_tracker_t* tracker, SBX_allocator_t* allocator);
+
+/// @brief Frees the subscribers and change buffers of a change tracker.
+/// @param tracker SBXBoxChangeTracker struct used to retrieve the buffers to free, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the tracker deinitialization function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXBoxChangeTrackerDeinit(SBX_box_change_tracker_t* tracker);
+
+/// @brief Adds a subscriber that gets the changes of the box once per SBXBoxStep, ticks without changes are not delivered.
+///        Changes are only tracked while a box has subscribers. Must only be called from the thread that owns the box, and not from a callback.
+/// @param box      SBXBox struct used to store the subscriber, cannot be SBX_POINTER_UNSET
+/// @param callback The function to deliver changes to, cannot be SBX_POINTER_UNSET
+/// @param userData Pointer passed back to the callback untouched, can be SBX_POINTER_UNSET
+/// @param id       A pointer to a SBX_box_subscription_id_t variable to store the ID of the subscription in, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the subscribe function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXBoxSubscribe(SBX_box_t* box, SBX_box_change_callback_t callback, void* userData, SBX_box_subscription_id_t* id);
+
+/// @brief Removes a subscriber added by SBXBoxSubscribe. Must only be called from the thread that owns the box, and not from a callback.
+/// @param box SBXBox struct used to retrieve the subscribers, cannot be SBX_POINTER_UNSET
+/// @param id  The ID SBXBoxSubscribe gave out, must belong to a subscriber of the box
+/// @return A SBXReport struct that reports the return state of the unsubscribe function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXBoxUnsubscribe(SBX_box_t* box, SBX_box_subscription_id_t id);
+
+/// @brief Records a change of the plock at a local position of a chunk, called by every plock write of the box.
+///        If the change buffers can't grow the change is recorded as a resize instead, so subscribers still see it.
+/// @param box        SBXBox struct used to retrieve the change tracker, cannot be SBX_POINTER_UNSET
+/// @param chunkIndex The index of the chunk in the chunk table
+/// @param localX     The x position inside the chunk
+/// @param localY     The y position inside the chunk
+/// @param from       The plock type before the write
+/// @param to         The plock type after the write
+/// @return A SBXReport struct that reports the return state of the tracking function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXBoxTrackChange(SBX_box_t* box, SBX_chunk_index_t chunkIndex, SBX_box_position_t localX, SBX_box_position_t localY,
+                               SBX_plock_type_id_t from, SBX_plock_type_id_t to);
+
+/// @brief Records that the chunk table of a box is about to be replaced, dropping per chunk changes since their indices stop meaning anything.
+/// @param box SBXBox struct used to retrieve the change tracker, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the tracking function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXBoxTrackResize(SBX_box_t* box);
+
+/// @brief Delivers the changes recorded since the last delivery to every subscriber and clears them, called by SBXBoxStep at the end of every tick.
+/// @param box SBXBox struct used to retrieve the change tracker, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the notify function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXBoxNotifyChanges(SBX_box_t* box);
+
+#endif // SBX_CHANGES_H
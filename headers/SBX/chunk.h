@@ -0,0 +1,127 @@
+#ifndef SBX_CHUNK_H
+#define SBX_CHUNK_H
+
+// Project headers
+#include <SBX/plock.h>
+#include <SBX/types.h>
+#include <SBX/report.h>
+
+// LibC headers
+#include <stdatomic.h>
+
+/// @brief Structure used by SBXChunkData* functions to store the plocks of one SBX_CHUNK_SIZE by SBX_CHUNK_SIZE region of a box
+struct SBXChunkData {
+    /// @brief Number of chunk tables and snapshots holding this storage, the storage is only written in place while this is 1
+    _Atomic SBX_reference_count_t referenceCount;
+    /// @brief SBX_allocator_t pointer to the allocator the structure, plock array, and plock ID matrix were allocated from
+    SBX_allocator_t*              allocator;
+
+    /// @brief SBX_plock_array_t object used to store the plocks of the chunk, plock IDs are local to the chunk
+    SBX_plock_array_t             plockArray;
+    /// @brief SBX_plock_id_matrix_t object used to store the SBX_CHUNK_SIZE by SBX_CHUNK_SIZE plock IDs of the chunk
+    SBX_plock_id_matrix_t         plockIDMatrix;
+
+    /// @brief SBX_bool_t object used to keep whether plock IDs still follow Z-order of their positions, cleared whenever a plock ID is acquired or released
+    SBX_bool_t                    spatiallyOrdered;
+
+    /// @brief SBX_plock_count_t object used to keep the number of set plocks in the chunk
+    SBX_plock_count_t             plockCount;
+    /// @brief SBX_plock_temperature_t object used to keep the sum of the temperatures of the set plocks in the chunk
+    SBX_plock_temperature_t       thermalEnergy;
+    /// @brief uint16_t arrays used as tournament trees over the plock array, node 1 is the root and nodes 2 * i and 2 * i + 1 are the children of node i.
+    ///        Every node keeps the index of the plock with the lowest or highest temperature under it, SBX_CHUNK_PLOCK_COUNT when none of them is set,
+    ///        so the extremes of the chunk are always at the root and a plock write updates at most the SBX_CHUNK_SHIFT * 2 nodes above it
+    uint16_t                      minimumTree[SBX_CHUNK_PLOCK_COUNT];
+    uint16_t                      maximumTree[SBX_CHUNK_PLOCK_COUNT];
+
+    /// @brief uint64_t object used to keep the sum of SBXChunkHashPlock over the set plocks in the chunk, updated on every plock write
+    uint64_t                      contentHash;
+    /// @brief uint64_t object used to keep the sum of SBXChunkHashPlockType over the set plocks in the chunk, updated on every plock write.
+    ///        Unlike the content hash it ignores temperatures, so heat diffusing through a chunk leaves it alone
+    uint64_t                      typeHash;
+};
+
+/// @brief Structure used by SBXBox* functions to store one entry of the chunk table of a box
+struct SBXChunk {
+    /// @brief SBX_chunk_data_t pointer to the chunk storage, SBX_POINTER_UNSET while every plock in the chunk is unset
+    SBX_chunk_data_t* data;
+};
+
+/// @brief Allocates memory for a SBXChunkData object with every plock unset and a reference count of 1.
+/// @param data   A pointer to a SBX_chunk_data_t pointer that will be set to the new object, cannot be SBX_POINTER_UNSET
+/// @param allocator The allocator to allocate the chunk storage from, SBX_POINTER_UNSET for the default allocator
+/// @return A SBXReport struct that reports the return state of the creation function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXChunkDataCreate(SBX_chunk_data_t** data, SBX_allocator_t* allocator);
+
+/// @brief Adds a reference to a SBXChunkData object, must only be called from the thread that owns the chunk table holding it.
+/// @param data A SBX_chunk_data_t pointer to the chunk storage to reference, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the retain function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXChunkDataRetain(SBX_chunk_data_t* data);
+
+/// @brief Drops a reference to a SBXChunkData object and deallocates it when it was the last one, can be called from any thread.
+///        The allocator the storage came from must still exist.
+/// @param data A SBX_chunk_data_t pointer to the chunk storage to release, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the release function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXChunkDataRelease(SBX_chunk_data_t* data);
+
+/// @brief Allocates a new SBXChunkData object with a reference count of 1 holding a copy of the plocks and plock IDs of another, from the same allocator.
+/// @param data A SBX_chunk_data_t pointer to the chunk storage to copy, cannot be SBX_POINTER_UNSET
+/// @param copy A pointer to a SBX_chunk_data_t pointer that will be set to the new object, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the duplication function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXChunkDataDuplicate(SBX_chunk_data_t* data, SBX_chunk_data_t** copy);
+
+/// @brief Makes sure a chunk table entry has storage only it references, creating it when unset and copying it when shared.
+/// @param chunk     A SBX_chunk_t pointer to the chunk table entry about to be written, cannot be SBX_POINTER_UNSET
+/// @param allocator The allocator new storage is allocated from, copies come from the allocator of the storage they copy
+/// @return A SBXReport struct that reports the return state of the make writable function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXChunkMakeWritable(SBX_chunk_t* chunk, SBX_allocator_t* allocator);
+
+/// @brief Renumbers the plock IDs of a chunk along a Z-order curve over its positions and rewrites the plock ID matrix to match,
+///        so plocks of neighboring positions end up within a few cache lines of each other. The storage must not be shared.
+/// @param data A SBX_chunk_data_t pointer to the chunk storage to renumber, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the defragmentation function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXChunkDataDefragment(SBX_chunk_data_t* data);
+
+/// @brief Hashes a set plock together with its position in the chunk, the content hash of a chunk is the wrapping sum of this over its set plocks.
+///        The temperature is hashed as a double, the precision saves keep, so a loaded chunk hashes the same as the one saved.
+/// @param position The row-major position of the plock in the chunk, localY * SBX_CHUNK_SIZE + localX
+/// @param plock    A pointer to the plock to hash, cannot be SBX_POINTER_UNSET
+/// @return The hash of the plock at position.
+uint64_t SBXChunkHashPlock(SBX_plock_count_t position, const SBX_plock_t* plock);
+
+/// @brief Hashes the type of a set plock together with its position in the chunk, the type hash of a chunk is the wrapping sum of this over its set plocks.
+/// @param position The row-major position of the plock in the chunk, localY * SBX_CHUNK_SIZE + localX
+/// @param type     The plock type ID of the plock
+/// @return The hash of the plock type at position.
+uint64_t SBXChunkHashPlockType(SBX_plock_count_t position, SBX_plock_type_id_t type);
+
+/// @brief Updates the temperature extremes of a chunk after the plock at an index of its plock array was set, unset, or changed temperature.
+/// @param data       A SBX_chunk_data_t pointer to the chunk storage the plock is in, cannot be SBX_POINTER_UNSET
+/// @param plockIndex The index of the plock in the plock array, below SBX_CHUNK_PLOCK_COUNT
+void SBXChunkDataUpdateExtremes(SBX_chunk_data_t* data, SBX_plock_count_t plockIndex);
+
+/// @brief Gets the lowest and highest temperature of the set plocks of a chunk from its tournament trees.
+/// @param data    A SBX_chunk_data_t pointer to the chunk storage, cannot be SBX_POINTER_UNSET
+/// @param minimum A pointer to a SBX_plock_temperature_t variable to store the lowest temperature in, SBX_TEMPERATURE_UNSET when no plock is set
+/// @param maximum A pointer to a SBX_plock_temperature_t variable to store the highest temperature in, SBX_TEMPERATURE_UNSET when no plock is set
+void SBXChunkDataGetExtremes(const SBX_chunk_data_t* data, SBX_plock_temperature_t* minimum, SBX_plock_temperature_t* maximum);
+
+/// @brief Recounts the plock count and thermal energy of a chunk and rebuilds its temperature extremes from its plocks.
+/// @param data A SBX_chunk_data_t pointer to the chunk storage to recount, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the recount function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXChunkDataRecountStats(SBX_chunk_data_t* data);
+
+/// @brief Recomputes the content and type hashes of a chunk from its plocks and plock IDs, for storage filled without plock writes.
+/// @param data A SBX_chunk_data_t pointer to the chunk storage to rehash, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the recount function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXChunkDataRecountHash(SBX_chunk_data_t* data);
+
+#endif // SBX_CHUNK_H
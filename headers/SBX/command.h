@@ -0,0 +1,122 @@
+#ifndef SBX_COMMAND_H
+#define SBX_COMMAND_H
+
+// Project headers
+#include <SBX/plock.h>
+#include <SBX/types.h>
+#include <SBX/report.h>
+
+// LibC headers
+#include <stdatomic.h>
+
+// Spare queue nodes the consumer keeps in the free list, or as many as the last drained batch held when that is more
+#define SBX_BOX_COMMAND_SPARE_NODES 256
+
+// Box command types
+enum SBXBoxCommandTypes {
+    // Sets the plock at x, y to plock
+    SBX_BOX_COMMAND_PAINT           = 0,
+    // Sets every plock in the width by height rectangle at x, y to plock, clipped to the box
+    SBX_BOX_COMMAND_FILL            = 1,
+    // Sets the temperature of the plock at x, y to the temperature of plock, unset positions are left alone
+    SBX_BOX_COMMAND_SET_TEMPERATURE = 2,
+    // Sets the size of the box to width by height
+    SBX_BOX_COMMAND_RESIZE          = 3
+};
+
+/// @brief Structure used by SBXBoxPushCommand to describe one edit of a box, and by the command queue as its node
+struct SBXBoxCommand {
+    /// @brief SBX_box_command_type_t object used to store the SBXBoxCommandTypes value of the command
+    SBX_box_command_type_t            type;
+
+    /// @brief SBX_box_position_t objects used to store the position the command applies to
+    SBX_box_position_t                x, y;
+    /// @brief SBX_box_dimensions_t objects used to store the rectangle size of fill commands and the box size of resize commands
+    SBX_box_dimensions_t              width, height;
+
+    /// @brief SBX_plock_t object used to store the plock of paint and fill commands and the temperature of set temperature commands
+    SBX_plock_t                       plock;
+
+    /// @brief Next command in the queue or the free list, set by the queue
+    _Atomic(SBX_box_command_t*)       next;
+    /// @brief SBX_allocator_t pointer to the allocator the queue node was allocated from, set by the queue
+    SBX_allocator_t*                  allocator;
+};
+
+/// @brief Structure used by SBXBox* functions to store an intrusive multiple producer, single consumer lock-free queue of commands
+struct SBXBoxCommandQueue {
+    /// @brief Most recently pushed command, swapped by producers
+    _Atomic(SBX_box_command_t*) head;
+    /// @brief Oldest command not yet popped, only touched by the consumer
+    SBX_box_command_t*          tail;
+    /// @brief Placeholder node keeping the queue non-empty so producers and the consumer never touch the same pointer
+    SBX_box_command_t           stub;
+
+    /// @brief SBX_allocator_t pointer to the allocator the consumer fills the free list from, SBX_POINTER_UNSET for the default allocator
+    SBX_allocator_t*            allocator;
+    /// @brief Spare nodes producers take from without locking, linked through their next members, only ever added to by the consumer
+    _Atomic(SBX_box_command_t*) freeHead;
+    /// @brief Number of producers between reading and swapping freeHead, the consumer only links nodes back in while it is 0,
+    ///        so a node can never leave the free list and come back while a producer still holds its stale next pointer
+    _Atomic uint32_t            freeTakers;
+    /// @brief Number of nodes in the free list
+    _Atomic uint32_t            freeCount;
+    /// @brief Nodes the consumer is done with that are not linked back into the free list yet, only touched by the consumer
+    SBX_box_command_t*          pendingHead;
+    SBX_box_command_t*          pendingTail;
+    uint32_t                    pendingCount;
+    /// @brief uint32_t object used to keep the number of spare nodes the consumer keeps, only touched by the consumer
+    uint32_t                    spareTarget;
+};
+
+/// @brief Structure used by SBXBoxApplyCommands to remember which later commands shadow an earlier command on the same position
+struct SBXBoxCommandCell {
+    /// @brief uint32_t object used to store the position of the cell, y in the high half and x in the low half
+    uint32_t   key;
+    /// @brief uint32_t object used to store the coalescing pass the cell belongs to, cells of older passes count as empty
+    uint32_t   generation;
+    /// @brief SBX_bool_t objects used to keep whether a later paint or set temperature command was seen on the position
+    SBX_bool_t painted, heated;
+};
+
+/// @brief Sets up an empty command queue and fills its free list with SBX_BOX_COMMAND_SPARE_NODES nodes, or as many as the allocator gives.
+/// @param queue     SBXBoxCommandQueue struct used to store the queue, cannot be SBX_POINTER_UNSET
+/// @param allocator The allocator to fill the free list from, SBX_POINTER_UNSET for the default allocator
+/// @return A SBXReport struct that reports the return state of the queue initialization function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXBoxCommandQueueInit(SBX_box_command_queue_t* queue, SBX_allocator_t* allocator);
+
+/// @brief Frees the spare nodes of a command queue, commands still queued have to be discarded first and no producer may push anymore.
+/// @param queue SBXBoxCommandQueue struct used to retrieve the nodes to free, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the queue deinitialization function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXBoxCommandQueueDeinit(SBX_box_command_queue_t* queue);
+
+/// @brief Pushes a copy of a command into the command queue of a box, can be called from any thread at any time.
+///        The node holding the copy comes from a lock-free free list the stepping thread refills between ticks from the box allocator,
+///        so pushing takes no lock as long as a tick pushes no more commands than the free list holds. A burst that empties it takes
+///        the node from the box allocator instead, which counts it against the budget and may lock, like malloc and the arena and pool allocators do.
+///        The command is applied at the start of the next SBXBoxStep.
+/// @param box     SBXBox struct used to retrieve the command queue, cannot be SBX_POINTER_UNSET
+/// @param command The command to push, its next member is ignored
+/// @return A SBXReport struct that reports the return state of the push function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXBoxPushCommand(SBX_box_t* box, SBX_box_command_t command);
+
+/// @brief Drains the command queue of a box and applies the commands in push order, called by SBXBoxStep at every tick boundary.
+///        Only commands pushed before the drain starts are applied, commands pushed while it runs are left for the next tick.
+///        Paint and set temperature commands shadowed by a later command on the same position are skipped, fill and resize commands are applied as pushed.
+///        Applied nodes go back to the free list, which is then topped up, so the box allocator is only called after a tick pushed more than ever before.
+///        Must only be called from the thread that owns the box.
+/// @param box SBXBox struct used to retrieve, store, and check the box data to edit, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the first command that failed, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXBoxApplyCommands(SBX_box_t* box);
+
+/// @brief Drops every command still in the command queue of a box without applying them, must only be called from the thread that owns the box.
+/// @param box SBXBox struct used to retrieve the command queue, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the discard function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXBoxDiscardCommands(SBX_box_t* box);
+
+#endif // SBX_COMMAND_H
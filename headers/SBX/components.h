@@ -0,0 +1,120 @@
+#ifndef SBX_COMPONENTS_H
+#define SBX_COMPONENTS_H
+
+// Project headers
+#include <SBX/box.h>
+#include <SBX/types.h>
+#include <SBX/report.h>
+
+// Fewest changed chunks an update spreads over the worker pool of the box, smaller updates relabel on the calling thread
+#define SBX_COMPONENT_LABELS_PARALLEL_MINIMUM 16
+
+/// @brief Structure used by SBXComponentLabelsGetComponent to describe one connected component, a set of plocks of the same class joined through their 4 neighbors
+struct SBXComponent {
+    /// @brief SBX_component_class_t object used to store the class shared by every plock of the component
+    SBX_component_class_t class;
+    /// @brief SBX_plock_count_t object used to store the number of plocks in the component
+    SBX_plock_count_t     plockCount;
+    /// @brief SBX_box_position_t objects used to store the inclusive bounds of the component, maximumY is the box height - 1 for components resting on the bottom
+    SBX_box_position_t    minimumX, minimumY, maximumX, maximumY;
+};
+
+/// @brief Structure used by SBXComponentLabels* functions to keep the labels of one chunk, plocks are labeled with pieces local to the chunk that the boundary pass joins into components
+struct SBXComponentChunk {
+    /// @brief uint64_t object used to keep the type hash the chunk had when it was labeled
+    uint64_t          hash;
+    /// @brief uint16_t array used to keep the piece of every position of the chunk in row-major order, 0 for positions without a labeled plock, SBX_POINTER_UNSET for chunks without pieces
+    uint16_t*         pieceLabels;
+    /// @brief SBX_component_t array used to keep the class, size, and bounds of every piece
+    SBX_component_t*  pieces;
+    /// @brief uint32_t object used to keep the number of pieces
+    uint32_t          pieceCount;
+    /// @brief uint32_t object used to keep the index of the first piece of the chunk in the piece tables of the labels
+    uint32_t          firstPiece;
+};
+
+/// @brief Structure used by SBXComponentLabels* functions to label the connected structures and liquid bodies of a box.
+///        Only chunks whose type hash changed since the last update are labeled again, spread over the worker pool of the box when it has one,
+///        then the pieces of every chunk are joined across chunk edges with union-find.
+struct SBXComponentLabels {
+    /// @brief SBX_component_class_t array used to store the class of every plock type, plocks of SBX_COMPONENT_CLASS_NONE types are not labeled
+    SBX_component_class_t  classes[SBX_PLOCK_TYPE_COUNT];
+
+    /// @brief SBX_box_dimensions_t objects used to keep the box size the labels were made for
+    SBX_box_dimensions_t   boxWidth, boxHeight;
+    /// @brief SBX_chunk_dimensions_t objects used to keep the chunk table size the labels were made for
+    SBX_chunk_dimensions_t chunkColumns, chunkRows;
+    /// @brief SBX_component_chunk_t array used to keep the labels of every chunk, indexed like the chunk table
+    SBX_component_chunk_t* chunks;
+    /// @brief SBX_bool_t object used to keep whether every chunk has to be labeled again, set when the classes or the box size change
+    SBX_bool_t             stale;
+    /// @brief SBX_chunk_index_t array used as scratch space for the chunks an update labels again
+    SBX_chunk_index_t*     changedChunks;
+
+    /// @brief uint32_t array used as the union-find forest over the pieces of every chunk
+    uint32_t*              parents;
+    /// @brief SBX_component_id_t array used to keep the component of every piece of every chunk
+    SBX_component_id_t*    pieceComponents;
+    /// @brief uint32_t object used to keep the number of pieces the piece tables have room for
+    uint32_t               pieceCapacity;
+
+    /// @brief SBX_component_t array used to store every component, component IDs start at 1 so component i is at index i - 1
+    SBX_component_t*       components;
+    /// @brief SBX_component_id_t object used to store the number of components found by the last update
+    SBX_component_id_t     componentCount;
+    /// @brief SBX_component_id_t object used to keep the number of components the component array has room for
+    SBX_component_id_t     componentCapacity;
+    /// @brief SBX_chunk_index_t object used to store the number of chunks the last update labeled again
+    SBX_chunk_index_t      relabeledChunkCount;
+};
+
+/// @brief Allocates memory for a SBXComponentLabels object, nothing is labeled until the first update.
+///        The memory is accounted to SBX_MEMORY_SUBSYSTEM_COMPONENTS of the default allocator.
+/// @param labels  A pointer to a SBX_component_labels_t pointer that will be set to the new object, cannot be SBX_POINTER_UNSET
+/// @param classes SBX_component_class_t array of SBX_PLOCK_TYPE_COUNT classes, one per plock type, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the creation function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXComponentLabelsCreate(SBX_component_labels_t** labels, const SBX_component_class_t* classes);
+
+/// @brief Deallocates a SBXComponentLabels objects memory.
+/// @param labels A SBX_component_labels_t pointer to the desired SBXComponentLabels to be destroyed, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the destruction function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXComponentLabelsDestroy(SBX_component_labels_t* labels);
+
+/// @brief Sets the class of every plock type, adjacent plocks join the same component when their types share a class other than SBX_COMPONENT_CLASS_NONE.
+///        The next update labels every chunk again.
+/// @param labels  SBXComponentLabels struct used to store the classes, cannot be SBX_POINTER_UNSET
+/// @param classes SBX_component_class_t array of SBX_PLOCK_TYPE_COUNT classes, one per plock type, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the setting function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXComponentLabelsSetClasses(SBX_component_labels_t* labels, const SBX_component_class_t* classes);
+
+/// @brief Brings the labels up to date with the box: chunks whose type hash changed are labeled again, on the workers of the box if it has a pool,
+///        then pieces are joined across chunk edges. Temperature changes alone never relabel a chunk.
+///        Component IDs are renumbered by every update, in order of the first chunk holding the component.
+/// @param labels SBXComponentLabels struct used to retrieve and store the labels, cannot be SBX_POINTER_UNSET
+/// @param box    SBXBox struct used to retrieve the plocks to label, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the update function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXComponentLabelsUpdate(SBX_component_labels_t* labels, SBX_box_t* box);
+
+/// @brief Gets the component holding the plock at a position as of the last update.
+/// @param labels      SBXComponentLabels struct used to retrieve the labels, cannot be SBX_POINTER_UNSET
+/// @param x           The x position to look up, must be less than the box width of the last update
+/// @param y           The y position to look up, must be less than the box height of the last update
+/// @param componentID A pointer to a SBX_component_id_t variable to store the component ID in, SBX_COMPONENT_ID_UNSET for positions without a labeled plock,
+///                    cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the query function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_OUT_OF_BOUNDS
+SBX_report_t SBXComponentLabelsGetID(SBX_component_labels_t* labels, SBX_box_position_t x, SBX_box_position_t y, SBX_component_id_t* componentID);
+
+/// @brief Gets the class, size, and bounds of a component found by the last update.
+/// @param labels      SBXComponentLabels struct used to retrieve the components, cannot be SBX_POINTER_UNSET
+/// @param componentID The component to describe, from 1 to the component count
+/// @param component   A pointer to a SBX_component_t variable to store the component in, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the query function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_OUT_OF_BOUNDS
+SBX_report_t SBXComponentLabelsGetComponent(SBX_component_labels_t* labels, SBX_component_id_t componentID, SBX_component_t* component);
+
+#endif // SBX_COMPONENTS_H
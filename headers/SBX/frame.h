@@ -0,0 +1,114 @@
+#ifndef SBX_FRAME_H
+#define SBX_FRAME_H
+
+// Project headers
+#include <SBX/graph.h>
+#include <SBX/stats.h>
+#include <SBX/box.h>
+#include <SBX/types.h>
+#include <SBX/report.h>
+
+// LibC headers
+#include <stdatomic.h>
+
+// Frame stages, the stage of every task of a frame
+enum SBXFrameStages {
+    // Edit commands applied at the tick boundary
+    SBX_FRAME_STAGE_EDITS      = 0,
+    // Chunk placement, picking the chunks to diffuse, and ending the tick
+    SBX_FRAME_STAGE_STEP       = 1,
+    // Temperature changes of every working chunk and their writes
+    SBX_FRAME_STAGE_THERMAL    = 2,
+    // Box stats of the new tick
+    SBX_FRAME_STAGE_STATS      = 3,
+    // Plock colors of every chunk reduced into the color pyramid
+    SBX_FRAME_STAGE_CONVERSION = 4,
+    // Visible chunks uploaded and drawn
+    SBX_FRAME_STAGE_UPLOAD     = 5,
+
+    SBX_FRAME_STAGE_COUNT
+};
+
+/// @brief Function run by SBXFrameRun once the tick is done and every chunk is converted, on the thread running the frame.
+typedef SBX_report_t (*SBX_frame_upload_t)(void* userData, SBX_box_t* box);
+
+/// @brief Structure used by SBXFrameGetTiming to report where the time of the last frame went
+struct SBXFrameTiming {
+    /// @brief uint64_t object used to store the nanoseconds the frame took from start to end
+    uint64_t wallNanoseconds;
+    /// @brief uint64_t object used to store the nanoseconds every task ran for, summed over every thread
+    uint64_t busyNanoseconds;
+    /// @brief uint64_t object used to store the nanoseconds of the longest chain of dependent work, the frame can't be shorter with any number of threads
+    uint64_t criticalNanoseconds;
+    /// @brief uint64_t array used to store the nanoseconds of that chain spent in every SBXFrameStages stage
+    uint64_t stageNanoseconds[SBX_FRAME_STAGE_COUNT];
+    /// @brief uint32_t objects used to store the number of tasks of the frame, and the number of them on the critical path
+    uint32_t taskCount, criticalTaskCount;
+};
+
+/// @brief Structure used by SBXFrame* functions to run the work of one frame as a graph of per chunk tasks, so the conversion of a chunk
+///        overlaps the thermal writes of the next ones, and to keep how long the critical path of the frame took.
+struct SBXFrame {
+    /// @brief SBX_task_graph_t pointer to the graph the tasks of a frame are built in, owned by the frame
+    SBX_task_graph_t*    graph;
+
+    /// @brief Current frame, the box, the pyramid the chunks are converted into, and the function drawing them
+    SBX_box_t*           box;
+    SBX_color_pyramid_t* pyramid;
+    SBX_frame_upload_t   upload;
+    void*                userData;
+
+    /// @brief SBX_task_id_t array used to keep the position of every chunk in the working set of the thermal pass, SBX_TASK_ID_UNSET for chunks outside it,
+    ///        indexed like the chunk table, and the number of chunks it has room for
+    SBX_task_id_t*       workingPositions;
+    SBX_chunk_index_t    chunkCapacity;
+    /// @brief SBX_chunk_index_t object used to keep the number of working chunks of the current frame
+    SBX_chunk_index_t    workingCount;
+
+    /// @brief SBX_report_t array used to keep the first error of every stage of the current frame, conversion errors are only counted
+    SBX_report_t         reports[SBX_FRAME_STAGE_COUNT];
+    /// @brief SBX_bool_t object used to keep whether a chunk failed to convert, written by the conversion tasks of every thread
+    _Atomic SBX_bool_t   conversionFailed;
+
+    /// @brief SBX_box_stats_t object used to store the box stats of the last frame
+    SBX_box_stats_t      stats;
+    /// @brief SBX_frame_timing_t object used to store the timing of the last frame
+    SBX_frame_timing_t   timing;
+};
+
+/// @brief Allocates memory for a SBXFrame object and its task graph.
+///        The memory is accounted to SBX_MEMORY_SUBSYSTEM_TASKS of the default allocator.
+/// @param frame A pointer to a SBX_frame_t pointer that will be set to the new object, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the creation function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE, SBX_COMMON_ERROR_THREAD_FAILURE
+SBX_report_t SBXFrameCreate(SBX_frame_t** frame);
+
+/// @brief Deallocates a SBXFrame objects memory.
+/// @param frame A SBX_frame_t pointer to the desired SBXFrame to be destroyed, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the destruction function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXFrameDestroy(SBX_frame_t* frame);
+
+/// @brief Runs one frame, steps the box one tick with the same result as SBXBoxStep, gets its stats, converts every chunk into the pyramid, and uploads.
+///        Edits and picking the working set run first on this thread since every later task depends on them, the rest runs as a task graph on
+///        SBX_TASK_GRAPH_THREAD_COUNT threads: the temperature changes of every working chunk in parallel, their writes one chunk after the other
+///        once the chunk and its neighbors are computed, and the conversion of every chunk as soon as its writes are done.
+///        The end of the tick, where subscribers are notified, and the upload run on this thread. Subscribers may not write the box.
+/// @param frame    SBXFrame struct used to build and run the tasks, cannot be SBX_POINTER_UNSET
+/// @param box      SBXBox struct to step, cannot be SBX_POINTER_UNSET
+/// @param pyramid  The pyramid to convert the chunks into, SBX_POINTER_UNSET to skip the conversion
+/// @param upload   The function drawing the box, SBX_POINTER_UNSET to skip the upload
+/// @param userData Pointer passed to the upload function untouched
+/// @return A SBXReport struct that reports the return state of the frame function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT, SBX_COMMON_ERROR_MEMORY_FAILURE,
+///                                  and any error of the upload function
+SBX_report_t SBXFrameRun(SBX_frame_t* frame, SBX_box_t* box, SBX_color_pyramid_t* pyramid, SBX_frame_upload_t upload, void* userData);
+
+/// @brief Gets the timing of the last frame and its critical path.
+/// @param frame  SBXFrame struct used to retrieve the timing, cannot be SBX_POINTER_UNSET
+/// @param timing A pointer to a SBX_frame_timing_t variable to store the timing in, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the query function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXFrameGetTiming(SBX_frame_t* frame, SBX_frame_timing_t* timing);
+
+#endif // SBX_FRAME_H
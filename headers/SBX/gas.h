@@ -0,0 +1,132 @@
+#ifndef SBX_GAS_H
+#define SBX_GAS_H
+
+// Project headers
+#include <SBX/box.h>
+#include <SBX/types.h>
+#include <SBX/report.h>
+
+#define SBX_GAS_FIELD_DEFAULT_DIFFUSION   4.0f
+#define SBX_GAS_FIELD_DEFAULT_DISSIPATION 0.05f
+#define SBX_GAS_FIELD_DEFAULT_BUOYANCY    8.0f
+// Total density below which a field counts as empty and stops being solved until gas is added again
+#define SBX_GAS_FIELD_IDLE_DENSITY        0.001f
+
+/// @brief Structure used by SBXGasField* functions to store gas as density and velocity on a grid of cells coarser than the box, one entry per cell in every array.
+///        Cells are laid out row-major, 2 to the cellShift box cells on a side, and are fitted to the size of the box on every call that takes one.
+struct SBXGasField {
+    /// @brief uint8_t object used to store the base 2 logarithm of the cell size in box cells, from 1 to SBX_CHUNK_SHIFT so cells never straddle chunks
+    uint8_t             cellShift;
+    /// @brief uint32_t objects used to keep the number of cell columns and rows
+    uint32_t            columns, rows;
+    /// @brief SBX_box_dimensions_t objects used to keep the box size the cells were laid out for
+    SBX_box_dimensions_t boxWidth, boxHeight;
+
+    /// @brief SBX_gas_scalar_t array used to store the gas density of every cell, in plocks worth of gas
+    SBX_gas_scalar_t*   densities;
+    /// @brief SBX_gas_scalar_t arrays used to store the gas velocity of every cell in box cells per second, y grows in the direction of gravity
+    SBX_gas_scalar_t*   velocitiesX;
+    SBX_gas_scalar_t*   velocitiesY;
+    /// @brief SBX_gas_scalar_t array used to keep the fraction of every cell not taken by set plocks, gas does not flow into full cells
+    SBX_gas_scalar_t*   openFractions;
+    /// @brief SBX_gas_scalar_t arrays used as scratch space for the diffused density and velocities of a step
+    SBX_gas_scalar_t*   nextDensities;
+    SBX_gas_scalar_t*   nextVelocitiesX;
+    SBX_gas_scalar_t*   nextVelocitiesY;
+    /// @brief uint16_t array used to keep the number of set plocks in every cell
+    uint16_t*           occupancies;
+
+    /// @brief uint64_t array used to keep the type hash every chunk had when its cells were last counted, indexed like the chunk table
+    uint64_t*           chunkHashes;
+    /// @brief SBX_chunk_index_t object used to keep the number of chunks the hash array covers
+    SBX_chunk_index_t   chunkCount;
+    /// @brief SBX_bool_t object used to keep whether every cell has to be counted again, set when the cells are laid out
+    SBX_bool_t          occupanciesStale;
+    /// @brief SBX_bool_t object used to keep whether the field is empty, idle fields skip the solver
+    SBX_bool_t          idle;
+
+    /// @brief SBX_gas_scalar_t object used to store how fast density and velocity spread to neighboring cells, in cells squared per second
+    SBX_gas_scalar_t    diffusion;
+    /// @brief SBX_gas_scalar_t object used to store the fraction of density and velocity lost every second
+    SBX_gas_scalar_t    dissipation;
+    /// @brief SBX_gas_scalar_t object used to store the upward acceleration of a cell per unit of density, in box cells per second squared
+    SBX_gas_scalar_t    buoyancy;
+};
+
+/// @brief Allocates memory for a SBXGasField object without gas, the cells are laid out when the field is first used with a box.
+///        The memory is accounted to SBX_MEMORY_SUBSYSTEM_GAS of the default allocator.
+/// @param field     A pointer to a SBX_gas_field_t pointer that will be set to the new object, cannot be SBX_POINTER_UNSET
+/// @param cellShift The base 2 logarithm of the cell size in box cells, from 1 to SBX_CHUNK_SHIFT
+/// @return A SBXReport struct that reports the return state of the creation function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXGasFieldCreate(SBX_gas_field_t** field, uint8_t cellShift);
+
+/// @brief Deallocates a SBXGasField objects memory.
+/// @param field A SBX_gas_field_t pointer to the desired SBXGasField to be destroyed, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the destruction function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXGasFieldDestroy(SBX_gas_field_t* field);
+
+/// @brief Sets how gas in the field spreads, fades, and rises.
+/// @param field       SBXGasField struct used to store the parameters, cannot be SBX_POINTER_UNSET
+/// @param diffusion   How fast density and velocity spread to neighboring cells in cells squared per second, cannot be negative
+/// @param dissipation The fraction of density and velocity lost every second, from 0 to 1
+/// @param buoyancy    The upward acceleration per unit of density in box cells per second squared, negative values make gas sink
+/// @return A SBXReport struct that reports the return state of the setting function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXGasFieldSetParameters(SBX_gas_field_t* field, SBX_gas_scalar_t diffusion, SBX_gas_scalar_t dissipation, SBX_gas_scalar_t buoyancy);
+
+/// @brief Adds gas to the cell holding a box position, the velocity of the cell becomes the density weighted mix of its gas and the new gas.
+/// @param field     SBXGasField struct used to store the gas, cannot be SBX_POINTER_UNSET
+/// @param box       SBXBox struct used to fit the cells, cannot be SBX_POINTER_UNSET
+/// @param x         The x position to add the gas at, must be less than the box width
+/// @param y         The y position to add the gas at, must be less than the box height
+/// @param density   The amount of gas to add, cannot be negative
+/// @param velocityX The x velocity of the new gas in box cells per second
+/// @param velocityY The y velocity of the new gas in box cells per second
+/// @return A SBXReport struct that reports the return state of the add function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT, SBX_BOX_ERROR_OUT_OF_BOUNDS,
+///                                  SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXGasFieldAdd(SBX_gas_field_t* field, SBX_box_t* box, SBX_box_position_t x, SBX_box_position_t y,
+                            SBX_gas_scalar_t density, SBX_gas_scalar_t velocityX, SBX_gas_scalar_t velocityY);
+
+/// @brief Takes the plock at a position out of the box and adds it to the field as gas, so short lived gas plocks stop taking plock IDs.
+///        Unset positions are left alone.
+/// @param field   SBXGasField struct used to store the gas, cannot be SBX_POINTER_UNSET
+/// @param box     SBXBox struct used to retrieve and unset the plock, cannot be SBX_POINTER_UNSET
+/// @param x       The x position of the plock, must be less than the box width
+/// @param y       The y position of the plock, must be less than the box height
+/// @param density The amount of gas one plock turns into, cannot be negative
+/// @return A SBXReport struct that reports the return state of the absorb function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT, SBX_BOX_ERROR_OUT_OF_BOUNDS,
+///                                  SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXGasFieldAbsorbPlock(SBX_gas_field_t* field, SBX_box_t* box, SBX_box_position_t x, SBX_box_position_t y, SBX_gas_scalar_t density);
+
+/// @brief Advances the gas by timeStep seconds: buoyancy, diffusion between open neighboring cells, semi-Lagrangian advection, then dissipation.
+///        Set plocks are obstacles, only cells of chunks whose type hash changed since the last step are counted again. Idle fields only do the count.
+///        The box edges are walls.
+/// @param field    SBXGasField struct used to retrieve and store the gas, cannot be SBX_POINTER_UNSET
+/// @param box      SBXBox struct used to fit the cells and find the obstacles, cannot be SBX_POINTER_UNSET
+/// @param timeStep The amount of seconds to advance the gas by, must be above 0
+/// @return A SBXReport struct that reports the return state of the step function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXGasFieldStep(SBX_gas_field_t* field, SBX_box_t* box, SBX_gas_scalar_t timeStep);
+
+/// @brief Gets the gas density of the cell holding a box position.
+/// @param field   SBXGasField struct used to retrieve the gas, cannot be SBX_POINTER_UNSET
+/// @param x       The x position to sample, positions outside the laid out cells give 0
+/// @param y       The y position to sample, positions outside the laid out cells give 0
+/// @param density A pointer to a SBX_gas_scalar_t variable to store the density in, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the query function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXGasFieldGetDensity(SBX_gas_field_t* field, SBX_box_position_t x, SBX_box_position_t y, SBX_gas_scalar_t* density);
+
+/// @brief Writes one 8 bit coverage value per cell in row-major order, for drawing the gas as a columns by rows overlay stretched over the box.
+/// @param field       SBXGasField struct used to retrieve the gas, cannot be SBX_POINTER_UNSET
+/// @param coverages   uint8_t array with room for columns * rows values, cannot be SBX_POINTER_UNSET
+/// @param fullDensity The density drawn fully opaque, must be above 0
+/// @return A SBXReport struct that reports the return state of the overlay function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXGasFieldGetOverlay(SBX_gas_field_t* field, uint8_t* coverages, SBX_gas_scalar_t fullDensity);
+
+#endif // SBX_GAS_H
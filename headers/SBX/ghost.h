@@ -0,0 +1,57 @@
+#ifndef SBX_GHOST_H
+#define SBX_GHOST_H
+
+// Project headers
+#include <SBX/plock.h>
+#include <SBX/types.h>
+#include <SBX/report.h>
+
+// Width and height of a ghost plane, a chunk with a one position ring around it
+#define SBX_GHOST_PLANE_SIZE       (SBX_CHUNK_SIZE + 2)
+// Positions of a ghost plane
+#define SBX_GHOST_PLANE_CELL_COUNT (SBX_GHOST_PLANE_SIZE * SBX_GHOST_PLANE_SIZE)
+// Index of chunk position x, y in a ghost plane, x and y go from -1 to SBX_CHUNK_SIZE, the ring is at -1 and SBX_CHUNK_SIZE
+#define SBX_GHOST_PLANE_INDEX(x, y) ((uint32_t)((y) + 1) * SBX_GHOST_PLANE_SIZE + (uint32_t)((x) + 1))
+// Chunk of a ring side outside the box, its positions hold the boundary plock
+#define SBX_GHOST_CHUNK_BOUNDARY   UINT32_MAX
+
+// Ghost plane ring sides
+enum SBXGhostSides {
+    SBX_GHOST_SIDE_LEFT   = 0,
+    SBX_GHOST_SIDE_RIGHT  = 1,
+    SBX_GHOST_SIDE_TOP    = 2,
+    SBX_GHOST_SIDE_BOTTOM = 3,
+
+    SBX_GHOST_SIDE_COUNT
+};
+
+/// @brief Structure used by SBXGhostPlane* functions to keep the plocks of a chunk and of the ring of positions around it in one row-major plane,
+///        so per position kernels read every neighbor without bounds checks, chunk lookups, or plock ID matrix lookups
+struct SBXGhostPlane {
+    /// @brief SBX_plock_temperature_t array used to store the temperature of every position, left as it was for unset positions
+    SBX_plock_temperature_t temperatures[SBX_GHOST_PLANE_CELL_COUNT];
+    /// @brief SBX_plock_type_id_t array used to store the type of every position, SBX_PLOCK_TYPE_ID_UNSET for unset positions
+    SBX_plock_type_id_t     types[SBX_GHOST_PLANE_CELL_COUNT];
+    /// @brief SBX_chunk_index_t array used to store the chunk the ring of every SBXGhostSides side was read from, SBX_GHOST_CHUNK_BOUNDARY outside the box
+    SBX_chunk_index_t       sideChunks[SBX_GHOST_SIDE_COUNT];
+};
+
+/// @brief Sets the plock every position outside a box reads as, such as a wall of some type and temperature.
+///        SBX_PLOCK_TYPE_ID_UNSET makes the outside void, the default, where nothing crosses the edge of the box.
+///        Changing it makes the next thermal pass diffuse every chunk again.
+/// @param box      SBXBox struct used to store the boundary, cannot be SBX_POINTER_UNSET
+/// @param boundary The plock of every position outside the box
+/// @return A SBXReport struct that reports the return state of the setting function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXBoxSetBoundary(SBX_box_t* box, SBX_plock_t boundary);
+
+/// @brief Fills a ghost plane from a chunk of a box, its ring from the neighboring chunks, diagonal ones included, and from the boundary plock outside the box.
+///        Only reads the box, so planes of different chunks can be refreshed on different threads at once.
+/// @param plane      SBXGhostPlane struct used to store the plocks, cannot be SBX_POINTER_UNSET
+/// @param box        SBXBox struct used to retrieve the plocks, cannot be SBX_POINTER_UNSET
+/// @param chunkIndex The index of the chunk in the chunk table
+/// @return A SBXReport struct that reports the return state of the refresh function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXGhostPlaneRefresh(SBX_ghost_plane_t* plane, SBX_box_t* box, SBX_chunk_index_t chunkIndex);
+
+#endif // SBX_GHOST_H
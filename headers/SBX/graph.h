@@ -0,0 +1,171 @@
+#ifndef SBX_GRAPH_H
+#define SBX_GRAPH_H
+
+// Project headers
+#include <SBX/types.h>
+#include <SBX/report.h>
+
+// LibC headers
+#include <threads.h>
+
+// Threads a task graph runs on, counting the executing thread
+#define SBX_TASK_GRAPH_THREAD_COUNT 4
+// Most stages tasks can be grouped in, the time of every stage on the critical path is reported separately
+#define SBX_TASK_GRAPH_STAGE_COUNT  8
+// ID of no task
+#define SBX_TASK_ID_UNSET           UINT32_MAX
+
+// Task flags
+enum SBXTaskFlags {
+    // The task only runs on the thread executing the graph, for work bound to that thread like a graphics context
+    SBX_TASK_FLAG_MAIN_THREAD = 1 << 0
+};
+
+/// @brief Function run by SBXTaskGraphExecute for a task, with the user data and argument the task was added with.
+typedef void (*SBX_task_function_t)(void* userData, uint32_t argument);
+
+/// @brief Structure used by SBXTaskGraph* functions to store one task, its dependents, and when it ran
+struct SBXTask {
+    /// @brief The function the task runs, and the user data and argument passed to it
+    SBX_task_function_t function;
+    void*               userData;
+    uint32_t            argument;
+    /// @brief SBX_task_stage_t object used to store the stage the task is accounted to, below SBX_TASK_GRAPH_STAGE_COUNT
+    SBX_task_stage_t    stage;
+    /// @brief uint8_t object used to store the SBXTaskFlags of the task
+    uint8_t             flags;
+
+    /// @brief uint32_t object used to store the first edge of the list of tasks depending on this one, SBX_TASK_ID_UNSET if there is none
+    uint32_t            firstEdge;
+    /// @brief uint32_t objects used to store the number of tasks this one depends on, and the number of them not done yet in the current execution
+    uint32_t            dependencyCount, remaining;
+
+    /// @brief uint64_t objects used to store when the task started and ended in the last execution, in nanoseconds since it started
+    uint64_t            startNanoseconds, endNanoseconds;
+    /// @brief uint64_t object used to store the run time of the longest chain of tasks ending with this one in the last execution
+    uint64_t            pathNanoseconds;
+    /// @brief SBX_task_id_t object used to store the task before this one on that chain, SBX_TASK_ID_UNSET if it starts the chain
+    SBX_task_id_t       pathPrevious;
+};
+
+/// @brief Structure used by SBXTaskGraph* functions to store one dependency, as an entry in the list of dependents of a task
+struct SBXTaskEdge {
+    /// @brief SBX_task_id_t object used to store the dependent task
+    SBX_task_id_t successor;
+    /// @brief uint32_t object used to store the next edge of the list, SBX_TASK_ID_UNSET at its end
+    uint32_t      next;
+};
+
+/// @brief Structure used by SBXTaskGraphGetCriticalPath to report where the time of the last execution went
+struct SBXTaskGraphPath {
+    /// @brief uint64_t object used to store the nanoseconds the execution took from start to end
+    uint64_t             wallNanoseconds;
+    /// @brief uint64_t object used to store the nanoseconds every task ran for, summed over every thread
+    uint64_t             busyNanoseconds;
+    /// @brief uint64_t object used to store the nanoseconds the tasks of the longest chain of dependencies ran for, the execution can't be shorter with any number of threads
+    uint64_t             criticalNanoseconds;
+    /// @brief uint64_t array used to store the nanoseconds of the critical path spent in the tasks of every stage
+    uint64_t             stageNanoseconds[SBX_TASK_GRAPH_STAGE_COUNT];
+    /// @brief SBX_task_id_t array of the tasks of the critical path from first to last, valid until the graph is cleared or executed again
+    const SBX_task_id_t* tasks;
+    /// @brief uint32_t object used to store the number of tasks of the critical path
+    uint32_t             taskCount;
+};
+
+/// @brief Structure used by SBXTaskGraph* functions to store tasks and their dependencies, and to run them on a few threads as soon as their dependencies are done
+struct SBXTaskGraph {
+    /// @brief SBX_task_t array used to store the tasks, indexed by SBX_task_id_t, and the number of tasks and tasks it has room for
+    SBX_task_t*      tasks;
+    uint32_t         taskCount, taskCapacity;
+    /// @brief SBX_task_edge_t array used to store the dependencies, and the number of dependencies and dependencies it has room for
+    SBX_task_edge_t* edges;
+    uint32_t         edgeCount, edgeCapacity;
+
+    /// @brief mtx_t and cnd_t objects used to hand ready tasks to the threads of an execution, and to start helper threads on it
+    mtx_t            lock;
+    cnd_t            wake;
+    /// @brief cnd_t object used to wait for the helper threads to leave an execution
+    cnd_t            done;
+    /// @brief thrd_t array used to keep the helper threads started with the graph, they sleep between executions, and the number that started
+    thrd_t           threads[SBX_TASK_GRAPH_THREAD_COUNT - 1];
+    uint32_t         threadCount;
+    /// @brief uint32_t object used to count executions, helper threads join an execution when it changes
+    uint32_t         generation;
+    /// @brief uint32_t object used to count the helper threads that have not left the current execution yet
+    uint32_t         helping;
+    /// @brief SBX_bool_t object used to keep whether the helper threads have to exit
+    SBX_bool_t       stopping;
+    /// @brief SBX_task_id_t arrays used to store the ready tasks any thread may run, and the ready tasks only the executing thread may run, both used as stacks
+    SBX_task_id_t*   ready;
+    SBX_task_id_t*   readyMain;
+    uint32_t         readyCount, readyMainCount;
+    /// @brief SBX_task_id_t array used to store the tasks of the last execution in the order they ended, and the number that ended so far
+    SBX_task_id_t*   finished;
+    uint32_t         finishedCount;
+    /// @brief SBX_task_id_t array used to store the critical path of the last execution, and the number of its tasks
+    SBX_task_id_t*   path;
+    uint32_t         pathCount;
+    /// @brief uint32_t object used to store the number of tasks the execution arrays have room for
+    uint32_t         scratchCapacity;
+
+    /// @brief uint64_t objects used to store when the last execution started in nanoseconds, and how long it took
+    uint64_t         startNanoseconds, wallNanoseconds;
+};
+
+/// @brief Allocates memory for an empty SBXTaskGraph object and starts its SBX_TASK_GRAPH_THREAD_COUNT - 1 helper threads, which sleep until an execution.
+///        Helpers that fail to start leave their share to the others. The memory is accounted to SBX_MEMORY_SUBSYSTEM_TASKS of the default allocator.
+/// @param graph A pointer to a SBX_task_graph_t pointer that will be set to the new object, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the creation function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE, SBX_COMMON_ERROR_THREAD_FAILURE
+SBX_report_t SBXTaskGraphCreate(SBX_task_graph_t** graph);
+
+/// @brief Stops the helper threads of a SBXTaskGraph and deallocates its memory.
+/// @param graph A SBX_task_graph_t pointer to the desired SBXTaskGraph to be destroyed, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the destruction function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXTaskGraphDestroy(SBX_task_graph_t* graph);
+
+/// @brief Removes every task and dependency so the graph can be built again, the memory is kept for the next build.
+/// @param graph SBXTaskGraph struct used to store the tasks, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the clearing function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXTaskGraphClear(SBX_task_graph_t* graph);
+
+/// @brief Adds a task, IDs are given out in order from 0 starting with the first task after a clear.
+/// @param graph    SBXTaskGraph struct used to store the task, cannot be SBX_POINTER_UNSET
+/// @param function The function the task runs, cannot be SBX_POINTER_UNSET
+/// @param userData Pointer passed to the function untouched
+/// @param argument Value passed to the function untouched, usually the chunk the task works on
+/// @param stage    The stage the task is accounted to, below SBX_TASK_GRAPH_STAGE_COUNT
+/// @param flags    The SBXTaskFlags of the task
+/// @param task     A pointer to a SBX_task_id_t variable to store the ID of the task in, SBX_POINTER_UNSET if it isn't needed
+/// @return A SBXReport struct that reports the return state of the adding function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXTaskGraphAdd(SBX_task_graph_t* graph, SBX_task_function_t function, void* userData, uint32_t argument,
+                             SBX_task_stage_t stage, uint8_t flags, SBX_task_id_t* task);
+
+/// @brief Makes a task wait for another one to end before it starts.
+/// @param graph      SBXTaskGraph struct used to store the dependency, cannot be SBX_POINTER_UNSET
+/// @param task       The ID of the waiting task
+/// @param dependency The ID of the task it waits for, cannot be the waiting task
+/// @return A SBXReport struct that reports the return state of the dependency function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXTaskGraphDepend(SBX_task_graph_t* graph, SBX_task_id_t task, SBX_task_id_t dependency);
+
+/// @brief Runs every task of the graph once and waits for them to end. Tasks run on the calling thread and the helper threads of the graph
+///        as soon as the tasks they depend on are done, tasks flagged SBX_TASK_FLAG_MAIN_THREAD only run on the calling thread.
+///        The helpers are woken for the execution and go back to sleep after it, no thread is started or joined.
+///        The graph keeps its tasks, so it can be executed again unchanged.
+/// @param graph SBXTaskGraph struct used to retrieve the tasks and store when they ran, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the execution function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE, SBX_TASK_GRAPH_ERROR_CYCLE
+SBX_report_t SBXTaskGraphExecute(SBX_task_graph_t* graph);
+
+/// @brief Gets the critical path of the last execution, the chain of dependent tasks that ran the longest, with the time spent in every stage of it.
+/// @param graph SBXTaskGraph struct used to retrieve the execution, cannot be SBX_POINTER_UNSET
+/// @param path  A pointer to a SBX_task_graph_path_t variable to store the path in, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the query function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXTaskGraphGetCriticalPath(SBX_task_graph_t* graph, SBX_task_graph_path_t* path);
+
+#endif // SBX_GRAPH_H
@@ -0,0 +1,71 @@
+#ifndef SBX_LOD_H
+#define SBX_LOD_H
+
+// Project headers
+#include <SBX/types.h>
+#include <SBX/report.h>
+
+#define SBX_BOX_LOD_DEFAULT_NEAR_RADIUS  2
+#define SBX_BOX_LOD_DEFAULT_FAR_RADIUS   8
+#define SBX_BOX_LOD_DEFAULT_FAR_INTERVAL 4
+// Update interval of chunks that are not simulated at all
+#define SBX_BOX_LOD_INTERVAL_FROZEN      0
+
+/// @brief Structure used by SBXBox*LOD* functions to store how often the chunks of a box are simulated depending on their distance from the viewport.
+///        Distances are counted in chunks, as the number of chunk rings between a chunk and the chunks the viewport overlaps.
+struct SBXBoxLOD {
+    /// @brief SBX_bool_t object used to store whether the policy is applied, every chunk is simulated every tick while it is not
+    SBX_bool_t             enabled;
+
+    /// @brief SBX_box_position_t objects used to store the top left corner of the viewport in box positions
+    SBX_box_position_t     viewportX, viewportY;
+    /// @brief SBX_box_dimensions_t objects used to store the size of the viewport in box positions
+    SBX_box_dimensions_t   viewportWidth, viewportHeight;
+
+    /// @brief SBX_chunk_dimensions_t object used to store the distance up to which chunks are simulated every tick
+    SBX_chunk_dimensions_t nearRadius;
+    /// @brief SBX_chunk_dimensions_t object used to store the distance up to which chunks are simulated every farInterval ticks, chunks farther out are frozen
+    SBX_chunk_dimensions_t farRadius;
+    /// @brief uint32_t object used to store the number of ticks between updates of chunks past the near radius
+    uint32_t               farInterval;
+};
+
+/// @brief Sets up the level of detail policy of a box, disabled with the default radii and a viewport covering no chunks.
+/// @param lod SBXBoxLOD struct used to store the policy, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the initialization function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXBoxLODInit(SBX_box_lod_t* lod);
+
+/// @brief Sets the level of detail policy of the supplied box. Chunks skipped by the policy catch up on the ticks they missed when they are next simulated.
+/// @param box         SBXBox struct used to store the policy, cannot be SBX_POINTER_UNSET
+/// @param enabled     Whether chunks away from the viewport are simulated less often
+/// @param nearRadius  The distance in chunks up to which chunks are simulated every tick
+/// @param farRadius   The distance in chunks up to which chunks are simulated every farInterval ticks, cannot be less than nearRadius
+/// @param farInterval The number of ticks between updates of chunks past the near radius, at least 2
+/// @return A SBXReport struct that reports the return state of the setting function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXBoxSetLOD(SBX_box_t* box, SBX_bool_t enabled, SBX_chunk_dimensions_t nearRadius, SBX_chunk_dimensions_t farRadius, uint32_t farInterval);
+
+/// @brief Sets the part of the supplied box that is on screen, the level of detail policy measures distances from it.
+/// @param box    SBXBox struct used to store the viewport, cannot be SBX_POINTER_UNSET
+/// @param x      The x position of the top left corner of the viewport, may be outside the box
+/// @param y      The y position of the top left corner of the viewport, may be outside the box
+/// @param width  The width of the viewport in box positions
+/// @param height The height of the viewport in box positions
+/// @return A SBXReport struct that reports the return state of the setting function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXBoxSetViewport(SBX_box_t* box, SBX_box_position_t x, SBX_box_position_t y, SBX_box_dimensions_t width, SBX_box_dimensions_t height);
+
+/// @brief Gets the number of ticks between updates of a chunk under the level of detail policy of its box, called by the per chunk passes of SBXBoxStep.
+/// @param box        SBXBox struct used to retrieve the policy, cannot be SBX_POINTER_UNSET
+/// @param chunkIndex The index of the chunk in the chunk table
+/// @return 1 for chunks simulated every tick, SBX_BOX_LOD_INTERVAL_FROZEN for chunks that are not simulated
+uint32_t SBXBoxLODGetChunkInterval(const SBX_box_t* box, SBX_chunk_index_t chunkIndex);
+
+/// @brief Checks if a chunk is simulated on the current tick of its box, chunks sharing an interval are spread over its ticks by chunk index.
+/// @param box        SBXBox struct used to retrieve the policy and tick, cannot be SBX_POINTER_UNSET
+/// @param chunkIndex The index of the chunk in the chunk table
+/// @return true if the chunk is simulated this tick
+SBX_bool_t SBXBoxLODIsChunkDue(const SBX_box_t* box, SBX_chunk_index_t chunkIndex);
+
+#endif // SBX_LOD_H
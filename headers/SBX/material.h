@@ -0,0 +1,57 @@
+#ifndef SBX_MATERIAL_H
+#define SBX_MATERIAL_H
+
+// Project headers
+#include <SBX/plock.h>
+#include <SBX/types.h>
+#include <SBX/report.h>
+
+// Material files, one plock type each as "key = value" lines, blank lines and lines starting with # are skipped:
+//     id    = 1                  the plock type ID, 1 to 255, 0 is SBX_PLOCK_TYPE_ID_UNSET
+//     name  = sand               1 to SBX_MATERIAL_NAME_SIZE - 1 letters, digits, underscores, and dashes
+//     color = 0.76 0.70 0.50     red, green, and blue from 0 to 1
+// Every key is required and unknown keys make the file invalid, so typos don't fall back to defaults silently.
+// The build compiles resources/plocks into SBXMaterialTableEmbedded with SBXMaterialPack, so files are only read to override it during development.
+#define SBX_MATERIAL_EXTENSION     ".plk"
+// Size of a material name, terminator included
+#define SBX_MATERIAL_NAME_SIZE     32
+// Largest material file, bigger ones are invalid
+#define SBX_MATERIAL_FILE_MAXIMUM  4096
+
+/// @brief Structure used by SBXMaterialTable* functions to keep every plock type with the name of the material it came from
+struct SBXMaterialTable {
+    /// @brief SBX_plock_type_t array used to store every plock type, passed as is to SBXRendererCreate and SBXColorPyramidSetPalette
+    SBX_plock_type_t types[SBX_PLOCK_TYPE_COUNT];
+    /// @brief char arrays used to store the material name of every plock type, empty for types no material file defines
+    char             names[SBX_PLOCK_TYPE_COUNT][SBX_MATERIAL_NAME_SIZE];
+};
+
+/// @brief Material table compiled from resources/plocks at build time, const data defined by the source SBXMaterialPack generates so nothing is read or parsed at startup.
+///        The functions below never refer to it, as SBXMaterialPack links them to generate it
+extern const SBX_material_table_t SBXMaterialTableEmbedded;
+
+/// @brief Resets a material table to the types used before any material is defined, shades of grey lighter for higher IDs, without names.
+/// @param table SBXMaterialTable struct used to store the types, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the reset function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXMaterialTableReset(SBX_material_table_t* table);
+
+/// @brief Parses a material file into a material table, replacing the type it defines. The table is left as it was when the file is invalid.
+/// @param table SBXMaterialTable struct used to store the material, cannot be SBX_POINTER_UNSET
+/// @param path  The path of the material file, cannot be SBX_POINTER_UNSET
+/// @param id    A pointer to a SBX_plock_type_id_t variable to store the ID the file defines in, can be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the load function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_IO_FAILURE
+SBX_report_t SBXMaterialTableLoadFile(SBX_material_table_t* table, SBX_string_t path, SBX_plock_type_id_t* id);
+
+/// @brief Loads every material file of a directory into a material table, for trying out materials without a rebuild.
+///        On platforms without directory listing only the files named after materials already in the table are read, so new materials need a rebuild there.
+///        Loading stops at the first invalid file, with the files before it already loaded.
+/// @param table     SBXMaterialTable struct used to store the materials, cannot be SBX_POINTER_UNSET
+/// @param directory The path of the directory, cannot be SBX_POINTER_UNSET
+/// @param count     A pointer to a uint32_t variable to store the number of files loaded in, can be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the load function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_IO_FAILURE
+SBX_report_t SBXMaterialTableLoadDirectory(SBX_material_table_t* table, SBX_string_t directory, uint32_t* count);
+
+#endif // SBX_MATERIAL_H
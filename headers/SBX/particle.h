@@ -0,0 +1,83 @@
+#ifndef SBX_PARTICLE_H
+#define SBX_PARTICLE_H
+
+// Project headers
+#include <SBX/box.h>
+#include <SBX/types.h>
+#include <SBX/report.h>
+
+// Most substeps a particle pool step is split into, velocities are clamped so no particle moves more than a cell per substep
+#define SBX_PARTICLE_POOL_MAX_SUBSTEPS 16
+
+/// @brief Structure used by SBXParticlePool* functions to store plocks in free flight as a structure of arrays, one entry per particle in every array
+struct SBXParticlePool {
+    /// @brief SBX_allocator_t pointer to the allocator the structure and its arrays were allocated from
+    SBX_allocator_t*         allocator;
+
+    /// @brief SBX_particle_scalar_t array used to store the x positions of the particles in box cells
+    SBX_particle_scalar_t*   positionsX;
+    /// @brief SBX_particle_scalar_t array used to store the y positions of the particles in box cells, y grows in the direction of gravity
+    SBX_particle_scalar_t*   positionsY;
+    /// @brief SBX_particle_scalar_t array used to store the x velocities of the particles in box cells per second
+    SBX_particle_scalar_t*   velocitiesX;
+    /// @brief SBX_particle_scalar_t array used to store the y velocities of the particles in box cells per second
+    SBX_particle_scalar_t*   velocitiesY;
+
+    /// @brief SBX_plock_type_id_t array used to store the plock types the particles came from
+    SBX_plock_type_id_t*     types;
+    /// @brief SBX_plock_temperature_t array used to store the plock temperatures the particles came from
+    SBX_plock_temperature_t* temperatures;
+
+    /// @brief SBX_particle_scalar_t arrays used as scratch space for the positions at the start of a substep
+    SBX_particle_scalar_t*   previousX;
+    SBX_particle_scalar_t*   previousY;
+    /// @brief uint8_t array used as scratch space for the particles that collided during a substep
+    uint8_t*                 collided;
+
+    /// @brief SBX_particle_count_t object used to keep the number of particles in flight
+    SBX_particle_count_t     count;
+    /// @brief SBX_particle_count_t object used to keep the number of particles the arrays have room for
+    SBX_particle_count_t     capacity;
+};
+
+/// @brief Allocates memory for a SBXParticlePool object with room for capacity particles and no particles in flight.
+///        The memory is accounted to SBX_MEMORY_SUBSYSTEM_PARTICLE of the allocator.
+/// @param pool      A pointer to a SBX_particle_pool_t pointer that will be set to the new object, cannot be SBX_POINTER_UNSET
+/// @param capacity  The maximum amount of particles in flight at once, cannot be 0
+/// @param allocator The allocator to allocate the pool from, SBX_POINTER_UNSET for the default allocator
+/// @return A SBXReport struct that reports the return state of the creation function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXParticlePoolCreate(SBX_particle_pool_t** pool, SBX_particle_count_t capacity, SBX_allocator_t* allocator);
+
+/// @brief Deallocates a SBXParticlePool objects memory, particles still in flight are lost.
+/// @param pool A SBX_particle_pool_t pointer to the desired SBXParticlePool to be destroyed, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the destruction function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXParticlePoolDestroy(SBX_particle_pool_t* pool);
+
+/// @brief Takes the plock at a position out of the box and throws it into free flight from the center of its cell, unset positions are left alone.
+/// @param pool      SBXParticlePool struct used to store the new particle, cannot be SBX_POINTER_UNSET
+/// @param box       SBXBox struct used to retrieve and unset the plock, cannot be SBX_POINTER_UNSET
+/// @param x         The x position of the plock, must be less than the box width
+/// @param y         The y position of the plock, must be less than the box height
+/// @param velocityX The starting x velocity of the particle in box cells per second
+/// @param velocityY The starting y velocity of the particle in box cells per second
+/// @return A SBXReport struct that reports the return state of the eject function, this can be an error, or a success
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT,
+///                                  SBX_BOX_ERROR_OUT_OF_BOUNDS, SBX_PARTICLE_POOL_ERROR_FULL
+SBX_report_t SBXParticlePoolEject(SBX_particle_pool_t* pool, SBX_box_t* box, SBX_box_position_t x, SBX_box_position_t y,
+                                  SBX_particle_scalar_t velocityX, SBX_particle_scalar_t velocityY);
+
+/// @brief Moves every particle in flight by timeStep seconds of ballistic motion and puts particles that hit a set plock or the bottom of the box
+///        back into the box in the last free cell they passed through, diagonal moves hit the set plock of the side cell they cross first.
+///        The sides of the box are walls, the top is open, and particles over a column filled to the top rest on it in flight until it has room.
+///        Particles are integrated in branch-free passes over the arrays and tested against the plock ID matrices, costing O(particles).
+/// @param pool     SBXParticlePool struct used to retrieve and store the particles, cannot be SBX_POINTER_UNSET
+/// @param box      SBXBox struct used to test collisions and store particles coming to rest, cannot be SBX_POINTER_UNSET
+/// @param gravity  The acceleration along y in box cells per second squared
+/// @param timeStep The amount of seconds to move the particles by, must be above 0
+/// @return A SBXReport struct that reports the return state of the step function, this can be an error, or a success
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXParticlePoolStep(SBX_particle_pool_t* pool, SBX_box_t* box, SBX_particle_scalar_t gravity, SBX_particle_scalar_t timeStep);
+
+#endif // SBX_PARTICLE_H
@@ -2,6 +2,7 @@
 #define SBX_PLOCK_H
 
 // Project headers
+#include <SBX/allocator.h>
 #include <SBX/types.h>
 #include <SBX/report.h>
 
@@ -15,23 +16,50 @@ struct SBXPlock {
     SBX_plock_temperature_t temperature;
 };
 
+#define SBX_PLOCK_ID_TO_INDEX(id)    ((id) - 1)
+#define SBX_PLOCK_INDEX_TO_ID(index) ((index) + 1)
+
 struct SBXPlockArray {
+    SBX_allocator_t*  allocator;
+
     SBX_plock_t*      plocks;
 
     SBX_plock_count_t count;
+
+    SBX_plock_id_t*   freeIDs;
+    SBX_plock_count_t freeCount;
 };
 
 SBX_report_t SBXPlockArrayGetSize(SBX_plock_array_t* plockArray, SBX_plock_count_t* count);
 
 SBX_report_t SBXPlockArraySetSize(SBX_plock_array_t* plockArray, SBX_plock_count_t count);
 
+SBX_report_t SBXPlockArrayAcquire(SBX_plock_array_t* plockArray, SBX_plock_id_t* plockID);
+
+SBX_report_t SBXPlockArrayRelease(SBX_plock_array_t* plockArray, SBX_plock_id_t plockID);
+
 struct SBXPlockIDMatrix {
+    SBX_allocator_t*                 allocator;
+
     SBX_plock_id_t*                  plockIDs;
 
     SBX_plock_id_matrix_dimensions_t width, 
                                      height;
 };
 
+// Plock ID matrices are row-major, a chunk matrix of 64 by 64 32 bit plock IDs is 16 KiB and fits in L1 whole,
+// so tiled or Z-order layouts keep no neighbor any closer and a per access layout branch only costs time
+
+// Index of position x, y in the plockIDs array of a plock ID matrix, every argument is evaluated once
+static inline uint32_t SBXPlockIDMatrixIndex(const SBX_plock_id_matrix_t* plockIDMatrix, SBX_plock_id_matrix_dimensions_t x, SBX_plock_id_matrix_dimensions_t y) {
+    return (uint32_t)y * plockIDMatrix->width + x;
+}
+
+// Plock ID at position x, y of a plock ID matrix, the pointer can be written through
+static inline SBX_plock_id_t* SBXPlockIDMatrixAt(const SBX_plock_id_matrix_t* plockIDMatrix, SBX_plock_id_matrix_dimensions_t x, SBX_plock_id_matrix_dimensions_t y) {
+    return &plockIDMatrix->plockIDs[SBXPlockIDMatrixIndex(plockIDMatrix, x, y)];
+}
+
 SBX_report_t SBXPlockIDMatrixGetSize(SBX_plock_id_matrix_t* plockIDMatrix,
                                      SBX_plock_id_matrix_dimensions_t* width, SBX_plock_id_matrix_dimensions_t* height);
 
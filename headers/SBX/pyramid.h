@@ -0,0 +1,137 @@
+#ifndef SBX_PYRAMID_H
+#define SBX_PYRAMID_H
+
+// Project headers
+#include <SBX/box.h>
+#include <SBX/types.h>
+#include <SBX/report.h>
+
+// LibC headers
+#include <stdatomic.h>
+
+// Number of levels of a chunk, level 0 is one texel per position and level SBX_CHUNK_SHIFT is one texel per chunk
+#define SBX_COLOR_PYRAMID_LEVEL_COUNT  (SBX_CHUNK_SHIFT + 1)
+// Bytes of one RGBA8 texel
+#define SBX_COLOR_PYRAMID_TEXEL_SIZE   4
+// Texels of levels 1 to SBX_CHUNK_SHIFT of one chunk, level 0 is read from the plocks when it is written out
+#define SBX_COLOR_PYRAMID_CHUNK_TEXELS ((SBX_CHUNK_PLOCK_COUNT - 1) / 3)
+// Offset of a level from 1 to SBX_CHUNK_SHIFT in the texels of a chunk, the levels are stored largest first
+#define SBX_COLOR_PYRAMID_LEVEL_OFFSET(level) ((SBX_CHUNK_PLOCK_COUNT - (SBX_CHUNK_PLOCK_COUNT >> (2 * ((level) - 1)))) / 3)
+// Width and height in texels of a level of a chunk
+#define SBX_COLOR_PYRAMID_LEVEL_SIZE(level)   (SBX_CHUNK_SIZE >> (level))
+
+/// @brief Structure used by SBXColorPyramid* functions to keep the reduced colors of one chunk
+struct SBXColorPyramidChunk {
+    /// @brief uint64_t object used to keep the type hash the chunk had when its levels were built, colors only depend on plock types
+    uint64_t  hash;
+    /// @brief uint32_t object used to store the number of times the levels of the chunk were built, renderers compare it to find chunks to upload again
+    uint32_t  revision;
+    /// @brief uint8_t array used to keep SBX_COLOR_PYRAMID_CHUNK_TEXELS premultiplied RGBA8 texels, levels 1 to SBX_CHUNK_SHIFT row-major one after another,
+    ///        SBX_POINTER_UNSET for chunks without plocks
+    uint8_t*  texels;
+};
+
+/// @brief Structure used by SBXColorPyramidGetView to describe the level and chunks needed to draw a camera rectangle
+struct SBXColorPyramidView {
+    /// @brief uint8_t object used to store the level to draw, the largest one that still has at least one texel per screen pixel
+    uint8_t                level;
+    /// @brief SBX_chunk_dimensions_t objects used to store the first chunk column and row the camera overlaps
+    SBX_chunk_dimensions_t firstColumn, firstRow;
+    /// @brief SBX_chunk_dimensions_t objects used to store the number of chunk columns and rows the camera overlaps, 0 when the camera misses the box
+    SBX_chunk_dimensions_t columns, rows;
+};
+
+/// @brief Structure used by SBXColorPyramid* functions to keep a mip pyramid of plock colors for every chunk of a box, so zoomed out views only read a few texels per chunk.
+///        Only chunks whose type hash changed since the last update are reduced again, so temperature changes alone never rebuild a chunk.
+struct SBXColorPyramid {
+    /// @brief uint8_t array used to store the RGBA8 color of every plock type, unset type colors are transparent
+    uint8_t                    palette[SBX_PLOCK_TYPE_COUNT][SBX_COLOR_PYRAMID_TEXEL_SIZE];
+
+    /// @brief SBX_chunk_dimensions_t objects used to keep the chunk table size the pyramid was made for
+    SBX_chunk_dimensions_t     chunkColumns, chunkRows;
+    /// @brief SBX_color_pyramid_chunk_t array used to keep the levels of every chunk, indexed like the chunk table
+    SBX_color_pyramid_chunk_t* chunks;
+    /// @brief SBX_bool_t object used to keep whether every chunk has to be reduced again, set when the palette or the chunk table size change
+    SBX_bool_t                 stale;
+    /// @brief SBX_chunk_index_t object used to store the number of chunks the last update reduced again, counted by chunk updates on any thread
+    _Atomic SBX_chunk_index_t  rebuiltChunkCount;
+};
+
+/// @brief Allocates memory for a SBXColorPyramid object, nothing is reduced until the first update.
+///        The memory is accounted to SBX_MEMORY_SUBSYSTEM_RENDER of the default allocator.
+/// @param pyramid A pointer to a SBX_color_pyramid_t pointer that will be set to the new object, cannot be SBX_POINTER_UNSET
+/// @param types   SBX_plock_type_t array of SBX_PLOCK_TYPE_COUNT types whose colors make the palette, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the creation function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXColorPyramidCreate(SBX_color_pyramid_t** pyramid, const SBX_plock_type_t* types);
+
+/// @brief Deallocates a SBXColorPyramid objects memory.
+/// @param pyramid A SBX_color_pyramid_t pointer to the desired SBXColorPyramid to be destroyed, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the destruction function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXColorPyramidDestroy(SBX_color_pyramid_t* pyramid);
+
+/// @brief Sets the color of every plock type, the next update reduces every chunk again.
+/// @param pyramid SBXColorPyramid struct used to store the palette, cannot be SBX_POINTER_UNSET
+/// @param types   SBX_plock_type_t array of SBX_PLOCK_TYPE_COUNT types, colors are clamped to 0 to 1 and SBX_COLOR_UNSET is transparent, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the setting function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXColorPyramidSetPalette(SBX_color_pyramid_t* pyramid, const SBX_plock_type_t* types);
+
+/// @brief Brings the pyramid up to date with the box, the levels of chunks whose type hash changed are reduced again from their plocks.
+/// @param pyramid SBXColorPyramid struct used to retrieve and store the levels, cannot be SBX_POINTER_UNSET
+/// @param box     SBXBox struct used to retrieve the plocks to reduce, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the update function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXColorPyramidUpdate(SBX_color_pyramid_t* pyramid, SBX_box_t* box);
+
+/// @brief Starts an update done one chunk at a time, lays the pyramid out again if the chunk table of the box changed size.
+///        SBXColorPyramidUpdate is SBXColorPyramidBeginUpdate, SBXColorPyramidUpdateChunk for every chunk, and SBXColorPyramidEndUpdate.
+/// @param pyramid SBXColorPyramid struct used to store the layout, cannot be SBX_POINTER_UNSET
+/// @param box     SBXBox struct used to retrieve the chunk table size, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the update function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXColorPyramidBeginUpdate(SBX_color_pyramid_t* pyramid, SBX_box_t* box);
+
+/// @brief Reduces the levels of one chunk again if its type hash changed. Only reads that chunk of the box and only writes its levels,
+///        so different chunks can be updated on different threads at once, as long as nothing writes the chunks meanwhile.
+/// @param pyramid    SBXColorPyramid struct used to store the levels, must have begun an update for the box, cannot be SBX_POINTER_UNSET
+/// @param box        SBXBox struct used to retrieve the plocks to reduce, cannot be SBX_POINTER_UNSET
+/// @param chunkIndex The index of the chunk in the chunk table
+/// @return A SBXReport struct that reports the return state of the update function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXColorPyramidUpdateChunk(SBX_color_pyramid_t* pyramid, SBX_box_t* box, SBX_chunk_index_t chunkIndex);
+
+/// @brief Ends an update done one chunk at a time, only once every chunk was updated without error.
+/// @param pyramid SBXColorPyramid struct used to store the update state, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the update function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXColorPyramidEndUpdate(SBX_color_pyramid_t* pyramid);
+
+/// @brief Culls the chunks of the last update to a camera rectangle, and picks the level that draws it with at least one texel per screen pixel.
+/// @param pyramid      SBXColorPyramid struct used to retrieve the chunk table size, cannot be SBX_POINTER_UNSET
+/// @param cameraX      The x position of the top left corner of the camera in box positions, may be outside the box
+/// @param cameraY      The y position of the top left corner of the camera in box positions, may be outside the box
+/// @param cameraWidth  The width of the camera in box positions, must be above 0
+/// @param cameraHeight The height of the camera in box positions, must be above 0
+/// @param pixelWidth   The width in pixels the camera is drawn at, cannot be 0
+/// @param pixelHeight  The height in pixels the camera is drawn at, cannot be 0
+/// @param view         A pointer to a SBX_color_pyramid_view_t variable to store the view in, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the view function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXColorPyramidGetView(SBX_color_pyramid_t* pyramid, float cameraX, float cameraY, float cameraWidth, float cameraHeight,
+                                    uint32_t pixelWidth, uint32_t pixelHeight, SBX_color_pyramid_view_t* view);
+
+/// @brief Writes one level of a chunk as SBX_COLOR_PYRAMID_LEVEL_SIZE(level) rows of premultiplied RGBA8 texels, level 0 is read straight from the plocks of the box.
+/// @param pyramid    SBXColorPyramid struct used to retrieve the levels, cannot be SBX_POINTER_UNSET
+/// @param box        SBXBox struct used to retrieve the plocks of level 0, must be the box of the last update, cannot be SBX_POINTER_UNSET
+/// @param chunkIndex The index of the chunk in the chunk table, must be less than the chunk count of the last update
+/// @param level      The level to write, from 0 to SBX_CHUNK_SHIFT
+/// @param pixels     uint8_t array to write the texels to, cannot be SBX_POINTER_UNSET
+/// @param rowStride  The number of bytes between the starts of two rows of pixels, at least SBX_COLOR_PYRAMID_LEVEL_SIZE(level) * SBX_COLOR_PYRAMID_TEXEL_SIZE
+/// @return A SBXReport struct that reports the return state of the write function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_OUT_OF_BOUNDS
+SBX_report_t SBXColorPyramidWriteChunk(SBX_color_pyramid_t* pyramid, SBX_box_t* box, SBX_chunk_index_t chunkIndex, uint8_t level,
+                                       uint8_t* pixels, size_t rowStride);
+
+#endif // SBX_PYRAMID_H
@@ -0,0 +1,190 @@
+#ifndef SBX_RECORD_H
+#define SBX_RECORD_H
+
+// Project headers
+#include <SBX/box.h>
+#include <SBX/types.h>
+#include <SBX/report.h>
+
+// LibC headers
+#include <stdio.h>
+
+// Recording header, the magic, version, chunk size, and keyframe interval, followed by the frames
+#define SBX_RECORDING_MAGIC   "SBXR"
+#define SBX_RECORDING_VERSION 1
+
+// Ticks between keyframes when the recorder is started with an interval of 0
+#define SBX_RECORDING_DEFAULT_KEYFRAME_INTERVAL 600
+// Most spectators a recorder streams to at once, more connections are closed as soon as they are accepted
+#define SBX_RECORDING_SPECTATOR_COUNT           8
+// Most bytes a spectator can fall behind by before it is dropped
+#define SBX_RECORDING_SPECTATOR_BACKLOG         ((size_t)64 << 20)
+
+// Recording frame kinds
+enum SBXRecordingFrameKinds {
+    // Every chunk of the box, the type planes themselves. Players drop everything they had
+    SBX_RECORDING_FRAME_KEYFRAME = 1,
+    // The chunks whose plock types changed since the last frame, the type planes XORed with the ones before
+    SBX_RECORDING_FRAME_DELTA    = 2
+};
+
+/// @brief Structure used by SBXBoxRecorder to keep one connected spectator and the bytes it hasn't taken yet
+struct SBXRecordingSpectator {
+    /// @brief int object used to store the socket of the spectator, -1 for a free slot
+    int      socket;
+    /// @brief uint8_t array used to store the bytes waiting to be sent, and the number of them and the number it has room for
+    uint8_t* backlog;
+    size_t   backlogSize, backlogCapacity;
+};
+
+/// @brief Structure used by SBXBoxRecorderGetStats to report what recording has cost so far
+struct SBXBoxRecorderStats {
+    /// @brief uint64_t objects used to store the number of frames and keyframes recorded
+    uint64_t frameCount, keyframeCount;
+    /// @brief uint64_t object used to store the number of chunk planes recorded, keyframes included
+    uint64_t chunkCount;
+    /// @brief uint64_t object used to store the number of bytes of the recording, header included
+    uint64_t byteCount;
+    /// @brief uint64_t object used to store the nanoseconds spent recording on the thread stepping the box
+    uint64_t nanoseconds;
+    /// @brief uint32_t object used to store the number of connected spectators
+    uint32_t spectatorCount;
+};
+
+/// @brief Structure used by SBXBoxRecord* functions to record the plock types of a box as it is stepped, to a file and to spectators on a local socket.
+///        Every tick with changes becomes a frame holding only the chunks whose types changed, as the XOR of their type planes with the ones
+///        recorded before, run-length encoded, so unchanged positions cost next to nothing. Keyframes hold every chunk and let players start or seek.
+struct SBXBoxRecorder {
+    /// @brief SBX_allocator_t pointer to the allocator of the recorded box, the recorder and its buffers are allocated from it
+    SBX_allocator_t*          allocator;
+    /// @brief SBX_box_t pointer to the recorded box
+    SBX_box_t*                box;
+    /// @brief SBX_box_subscription_id_t object used to keep the change subscription frames are recorded from
+    SBX_box_subscription_id_t subscription;
+
+    /// @brief SBX_box_dimensions_t objects used to keep the box size of the last frame
+    SBX_box_dimensions_t      width, height;
+    /// @brief SBX_plock_type_id_t array used to keep the type plane of every chunk as of the last frame, SBX_CHUNK_PLOCK_COUNT row-major types per chunk
+    SBX_plock_type_id_t*      planes;
+    /// @brief SBX_chunk_index_t object used to keep the number of chunks the plane array has room for
+    SBX_chunk_index_t         planeCapacity;
+    /// @brief uint32_t object used to keep the ticks between keyframes
+    uint32_t                  keyframeInterval;
+    /// @brief SBX_box_tick_t object used to keep the tick of the last keyframe
+    SBX_box_tick_t            keyframeTick;
+
+    /// @brief uint8_t array used to build a frame before it is written, and the number of bytes of it and the number it has room for
+    uint8_t*                  frame;
+    size_t                    frameSize, frameCapacity;
+
+    /// @brief FILE pointer the frames are written to, SBX_POINTER_UNSET when only streaming
+    FILE*                     file;
+    /// @brief int object used to store the listening socket spectators connect to, -1 when only writing a file
+    int                       listener;
+    /// @brief char array used to keep a copy of the path of the listening socket, removed when recording ends
+    char*                     socketPath;
+    /// @brief SBX_recording_spectator_t array used to store the connected spectators
+    SBX_recording_spectator_t spectators[SBX_RECORDING_SPECTATOR_COUNT];
+
+    /// @brief SBX_box_recorder_stats_t object used to keep what recording has cost so far
+    SBX_box_recorder_stats_t  stats;
+    /// @brief SBX_report_t object used to keep the first error of a frame, frames are recorded from a change callback that can't return one.
+    ///        Recording stops at the first error, since players can't follow deltas past a missing frame
+    SBX_report_t              report;
+};
+
+/// @brief Structure used by SBXRecordingPlayer* functions to rebuild the plock types of a recorded box, frame by frame, from a file or a spectator socket
+struct SBXRecordingPlayer {
+    /// @brief FILE pointer the recording is read from, SBX_POINTER_UNSET when reading from a socket
+    FILE*                file;
+    /// @brief int object used to store the socket the recording is read from, -1 when reading from a file
+    int                  socket;
+
+    /// @brief uint8_t array used to store the bytes read but not decoded yet, and the number of them and the number it has room for
+    uint8_t*             buffer;
+    size_t               bufferSize, bufferCapacity;
+    /// @brief SBX_bool_t object used to keep whether the header was read
+    SBX_bool_t           started;
+    /// @brief SBX_bool_t object used to keep whether the recording ended, at the end of the file or when the recorder hung up
+    SBX_bool_t           ended;
+
+    /// @brief SBX_box_tick_t object used to store the tick of the last decoded frame
+    SBX_box_tick_t       tick;
+    /// @brief SBX_box_dimensions_t objects used to store the box size of the last decoded frame
+    SBX_box_dimensions_t width, height;
+    /// @brief SBX_chunk_dimensions_t objects used to store the number of chunk columns and rows of that size
+    SBX_chunk_dimensions_t chunkColumns, chunkRows;
+    /// @brief SBX_plock_type_id_t array used to store the type plane of every chunk, SBX_CHUNK_PLOCK_COUNT row-major types per chunk
+    SBX_plock_type_id_t* planes;
+    /// @brief uint8_t array used to keep which chunks changed since the last SBXRecordingPlayerApply, indexed like the chunk table
+    uint8_t*             changed;
+    /// @brief SBX_chunk_index_t object used to keep the number of chunks the arrays have room for
+    SBX_chunk_index_t    chunkCapacity;
+    /// @brief SBX_bool_t object used to keep whether the box size changed since the last SBXRecordingPlayerApply
+    SBX_bool_t           resized;
+};
+
+/// @brief Starts recording a box to a file, to spectators connecting to a Unix socket, or to both. The current state of the box is the first keyframe,
+///        then every tick SBXBoxStep or SBXFrameRun delivers changes on adds a frame from the thread stepping the box.
+///        Must be called from the thread that owns the box, between steps.
+/// @param box              SBXBox struct to record, cannot be SBX_POINTER_UNSET
+/// @param path             The path of the file to write, SBX_POINTER_UNSET to only stream
+/// @param socketPath       The path of the Unix socket spectators connect to, SBX_POINTER_UNSET to only write the file
+/// @param keyframeInterval The ticks between keyframes, 0 for SBX_RECORDING_DEFAULT_KEYFRAME_INTERVAL
+/// @param recorder         A pointer to a SBX_box_recorder_t pointer that will be set to the new recorder, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the recording start function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT, SBX_COMMON_ERROR_MEMORY_FAILURE, SBX_COMMON_ERROR_IO_FAILURE
+SBX_report_t SBXBoxRecordBegin(SBX_box_t* box, SBX_string_t path, SBX_string_t socketPath, uint32_t keyframeInterval, SBX_box_recorder_t** recorder);
+
+/// @brief Stops recording, closes the file and every spectator, and deallocates the recorder. Must be called from the thread that owns the box, between steps.
+/// @param recorder A SBX_box_recorder_t pointer to the recorder to stop, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the first error of the recording, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE, SBX_COMMON_ERROR_IO_FAILURE
+SBX_report_t SBXBoxRecordEnd(SBX_box_recorder_t* recorder);
+
+/// @brief Gets what recording has cost so far.
+/// @param recorder SBXBoxRecorder struct used to retrieve the stats, cannot be SBX_POINTER_UNSET
+/// @param stats    A pointer to a SBX_box_recorder_stats_t variable to store the stats in, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the query function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXBoxRecorderGetStats(SBX_box_recorder_t* recorder, SBX_box_recorder_stats_t* stats);
+
+/// @brief Opens a recording file written by SBXBoxRecordBegin for playing.
+/// @param player A pointer to a SBX_recording_player_t pointer that will be set to the new player, cannot be SBX_POINTER_UNSET
+/// @param path   The path of the file to read, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the open function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE, SBX_COMMON_ERROR_IO_FAILURE
+SBX_report_t SBXRecordingPlayerOpen(SBX_recording_player_t** player, SBX_string_t path);
+
+/// @brief Connects to the socket of a recorder to play its frames live, starting from a keyframe of the current state of the box.
+/// @param player     A pointer to a SBX_recording_player_t pointer that will be set to the new player, cannot be SBX_POINTER_UNSET
+/// @param socketPath The path of the Unix socket of the recorder, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the connect function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE, SBX_COMMON_ERROR_IO_FAILURE
+SBX_report_t SBXRecordingPlayerConnect(SBX_recording_player_t** player, SBX_string_t socketPath);
+
+/// @brief Closes the file or socket of a player and deallocates it.
+/// @param player A SBX_recording_player_t pointer to the player to close, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the close function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXRecordingPlayerClose(SBX_recording_player_t* player);
+
+/// @brief Decodes the next frame of the recording into the type planes of the player. Files are read until a frame is complete,
+///        sockets are only read as far as the recorder has sent, so a live player never waits on the recorder.
+/// @param player  SBXRecordingPlayer struct used to read and store the frame, cannot be SBX_POINTER_UNSET
+/// @param decoded A pointer to a SBX_bool_t variable set to whether a frame was decoded, false at the end of the recording or while waiting for one,
+///                cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the decoding function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE, SBX_COMMON_ERROR_IO_FAILURE
+SBX_report_t SBXRecordingPlayerNext(SBX_recording_player_t* player, SBX_bool_t* decoded);
+
+/// @brief Writes the plock types of the chunks that changed since the last call into a box, resizing or initializing it to the recorded size.
+///        Plocks the recording sets get the temperature given, temperatures aren't recorded.
+/// @param player      SBXRecordingPlayer struct used to retrieve the type planes, cannot be SBX_POINTER_UNSET
+/// @param box         SBXBox struct to write into, cannot be SBX_POINTER_UNSET
+/// @param temperature The temperature of the plocks written
+/// @return A SBXReport struct that reports the return state of the apply function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE, and any error of SBXBoxSetPlock
+SBX_report_t SBXRecordingPlayerApply(SBX_recording_player_t* player, SBX_box_t* box, SBX_plock_temperature_t temperature);
+
+#endif // SBX_RECORD_H
@@ -0,0 +1,89 @@
+#ifndef SBX_RENDERER_H
+#define SBX_RENDERER_H
+
+// Project headers
+#include <SBX/pyramid.h>
+#include <SBX/window.h>
+#include <SBX/box.h>
+#include <SBX/types.h>
+#include <SBX/report.h>
+
+/// @brief Structure used by SBXRenderer* functions to draw a box into a window through a SBXColorPyramid.
+///        Only the chunks overlapping the camera are kept in a texture, at the pyramid level matching the zoom, and only chunks whose pyramid revision changed are uploaded again.
+struct SBXRenderer {
+    /// @brief SBX_window_t pointer to the window drawn to, its OpenGL context must be current on the drawing thread
+    SBX_window_t*             window;
+    /// @brief SBX_color_pyramid_t pointer to the pyramid the chunk colors are read from, owned by the renderer
+    SBX_color_pyramid_t*      pyramid;
+
+    /// @brief GLuint objects used to store the texture holding the visible chunks and the framebuffer it is blitted from
+    GLuint                    texture, framebuffer;
+    /// @brief GLuint object used to store the framebuffer drawn to, 0 for the default framebuffer of the window
+    GLuint                    targetFramebuffer;
+    /// @brief uint32_t objects used to store the size of the target framebuffer in pixels, unused for the default framebuffer, which is as big as the window
+    uint32_t                  targetWidth, targetHeight;
+    /// @brief uint32_t objects used to keep the size of the texture in texels
+    uint32_t                  textureWidth, textureHeight;
+
+    /// @brief uint8_t array used as the RGBA8 staging image the visible chunks are written to before upload, laid out like the texture
+    uint8_t*                  staging;
+    /// @brief size_t object used to keep the size of the staging image in bytes
+    size_t                    stagingSize;
+
+    /// @brief SBX_color_pyramid_view_t object used to keep the view the texture holds
+    SBX_color_pyramid_view_t  view;
+    /// @brief SBX_bool_t object used to keep whether the texture holds the view, cleared when the chunk table changes
+    SBX_bool_t                viewUploaded;
+    /// @brief uint32_t array used to keep the pyramid revision every chunk had when it was last uploaded, indexed like the chunk table
+    uint32_t*                 uploadedRevisions;
+    /// @brief SBX_chunk_index_t object used to keep the number of chunks the revision array covers
+    SBX_chunk_index_t         chunkCount;
+    /// @brief SBX_chunk_index_t object used to store the number of chunks the last draw uploaded
+    SBX_chunk_index_t         uploadedChunkCount;
+};
+
+/// @brief Allocates memory for a SBXRenderer object drawing to an initialized window, and creates its pyramid, texture, and framebuffer.
+///        The memory is accounted to SBX_MEMORY_SUBSYSTEM_RENDER of the default allocator.
+/// @param renderer A pointer to a SBX_renderer_t pointer that will be set to the new object, cannot be SBX_POINTER_UNSET
+/// @param window   SBXWindow struct whose OpenGL context is drawn with, must be initialized and current, cannot be SBX_POINTER_UNSET
+/// @param types    SBX_plock_type_t array of SBX_PLOCK_TYPE_COUNT types whose colors make the palette, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the creation function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_WINDOW_ERROR_NOT_INIT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXRendererCreate(SBX_renderer_t** renderer, SBX_window_t* window, const SBX_plock_type_t* types);
+
+/// @brief Deletes the OpenGL objects of a SBXRenderer and deallocates its memory, the OpenGL context of its window must still be current.
+/// @param renderer A SBX_renderer_t pointer to the desired SBXRenderer to be destroyed, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the destruction function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXRendererDestroy(SBX_renderer_t* renderer);
+
+/// @brief Sets the color of every plock type, every visible chunk is uploaded again on the next draw.
+/// @param renderer SBXRenderer struct used to store the palette, cannot be SBX_POINTER_UNSET
+/// @param types    SBX_plock_type_t array of SBX_PLOCK_TYPE_COUNT types, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the setting function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXRendererSetPalette(SBX_renderer_t* renderer, const SBX_plock_type_t* types);
+
+/// @brief Sets the framebuffer draws go to, such as the one of a SBXCapture for offscreen windows, which have no usable default framebuffer.
+/// @param renderer    SBXRenderer struct used to store the target, cannot be SBX_POINTER_UNSET
+/// @param framebuffer The framebuffer to draw to, 0 for the default framebuffer of the window, which renderers start with
+/// @param width       The width of the framebuffer in pixels, cannot be 0 unless framebuffer is 0
+/// @param height      The height of the framebuffer in pixels, cannot be 0 unless framebuffer is 0
+/// @return A SBXReport struct that reports the return state of the setting function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXRendererSetTarget(SBX_renderer_t* renderer, GLuint framebuffer, uint32_t width, uint32_t height);
+
+/// @brief Draws the part of a box under a camera rectangle over the whole target framebuffer, the framebuffer is not cleared first.
+///        The pyramid is updated from the box, then the chunks overlapping the camera are uploaded when the view changed or their colors did.
+/// @param renderer     SBXRenderer struct used to retrieve and store the drawing state, cannot be SBX_POINTER_UNSET
+/// @param box          SBXBox struct used to retrieve the plocks to draw, cannot be SBX_POINTER_UNSET
+/// @param cameraX      The x position of the top left corner of the camera in box positions, may be outside the box
+/// @param cameraY      The y position of the top left corner of the camera in box positions, may be outside the box
+/// @param cameraWidth  The width of the camera in box positions, must be above 0
+/// @param cameraHeight The height of the camera in box positions, must be above 0
+/// @return A SBXReport struct that reports the return state of the drawing function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_WINDOW_ERROR_NOT_INIT, SBX_BOX_ERROR_NOT_INIT,
+///                                  SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXRendererDraw(SBX_renderer_t* renderer, SBX_box_t* box, float cameraX, float cameraY, float cameraWidth, float cameraHeight);
+
+#endif // SBX_RENDERER_H
@@ -57,7 +57,53 @@ enum SBXErrorFlags {
     /// @brief This error is generated when creating the plock array fails.
     SBX_BOX_ERROR_PLOCKS_INIT_FAILED     = 1 << 17,
     /// @brief This error is generated when creating the plock ID matrix fails.
-    SBX_BOX_ERROR_PLOCK_IDS_INIT_FAILED  = 1 << 18
+    SBX_BOX_ERROR_PLOCK_IDS_INIT_FAILED  = 1 << 18,
+
+    // Plock array error flags
+
+    /// @brief This error is generated when a plock ID is requested from a plock array with no free plock IDs left.
+    SBX_PLOCK_ARRAY_ERROR_FULL           = 1 << 19,
+
+    // Late common error flags
+
+    /// @brief This error is generated when a file operation fails (open, read, write, close) or a file has an invalid format.
+    SBX_COMMON_ERROR_IO_FAILURE          = 1 << 20,
+    /// @brief This error is generated when a thread operation fails (create, join).
+    SBX_COMMON_ERROR_THREAD_FAILURE      = 1 << 21,
+
+    // Late box error flags
+
+    /// @brief This error is generated when a position outside of the box is accessed.
+    SBX_BOX_ERROR_OUT_OF_BOUNDS          = 1 << 22,
+
+    // Particle pool error flags
+
+    /// @brief This error is generated when a plock is ejected into a particle pool with no free particles left.
+    SBX_PARTICLE_POOL_ERROR_FULL         = 1 << 24,
+
+    // Scenario error flags
+
+    /// @brief This error is generated when the chunk hashes of a scenario tick differ from its golden file.
+    SBX_SCENARIO_ERROR_DIVERGED          = 1 << 25,
+    /// @brief This error is generated when the mean step time of a scenario is over the timing threshold times its golden file baseline.
+    SBX_SCENARIO_ERROR_TOO_SLOW          = 1 << 26,
+
+    // Slab error flags
+
+    /// @brief This error is generated when a plock is sent to a slab whose migration queue has no free slots left.
+    SBX_SLAB_ERROR_MIGRATION_FULL        = 1 << 27,
+
+    // Task graph error flags
+
+    /// @brief This error is generated when a task graph is executed with tasks that depend on each other in a cycle.
+    SBX_TASK_GRAPH_ERROR_CYCLE           = 1 << 28,
+
+    // Capture error flags
+
+    /// @brief This error is generated when the framebuffer of a capture can not be drawn to, such as when its size is over the limits of the OpenGL context.
+    SBX_CAPTURE_ERROR_FRAMEBUFFER_INCOMPLETE = 1 << 29,
+    /// @brief This error is generated when reading a framebuffer back, waiting for the readback, or mapping its pixel buffer fails.
+    SBX_CAPTURE_ERROR_READBACK_FAILED    = 1 << 30
 };
 
 #endif // SBX_REPORT_H
@@ -0,0 +1,86 @@
+#ifndef SBX_SAVE_H
+#define SBX_SAVE_H
+
+// Project headers
+#include <SBX/box.h>
+#include <SBX/chunk.h>
+#include <SBX/types.h>
+#include <SBX/report.h>
+
+// LibC headers
+#include <stdio.h>
+#include <stdatomic.h>
+#include <threads.h>
+
+#define SBX_BOX_SAVE_MAGIC   "SBXB"
+#define SBX_BOX_SAVE_VERSION 2
+
+/// @brief Structure used by SBXBoxSave* functions to store a copy-on-write snapshot of a box chunk table while a writer thread streams it to disk
+struct SBXBoxSave {
+    /// @brief SBX_allocator_t pointer to the allocator of the saved box, the save and its buffers are allocated from it
+    SBX_allocator_t*       allocator;
+
+    /// @brief SBX_box_dimensions_t object used to keep the box width at the tick the snapshot was taken
+    SBX_box_dimensions_t   width;
+    /// @brief SBX_box_dimensions_t object used to keep the box height at the tick the snapshot was taken
+    SBX_box_dimensions_t   height;
+
+    /// @brief SBX_chunk_dimensions_t object used to keep the number of chunk columns in the snapshot
+    SBX_chunk_dimensions_t chunkColumns;
+    /// @brief SBX_chunk_dimensions_t object used to keep the number of chunk rows in the snapshot
+    SBX_chunk_dimensions_t chunkRows;
+
+    /// @brief SBX_chunk_data_t pointer array holding a reference to every non-empty chunk, each one is released as soon as it is written
+    SBX_chunk_data_t**     chunks;
+
+    /// @brief FILE pointer the writer thread streams the snapshot into
+    FILE*                  file;
+    /// @brief thrd_t object used to keep the writer thread handle
+    thrd_t                 writerThread;
+    /// @brief atomic_bool object set by the writer thread once the snapshot is fully written
+    atomic_bool            finished;
+    /// @brief SBX_report_t object used by the writer thread to store the result of the save
+    SBX_report_t           writerReport;
+};
+
+/// @brief Takes a snapshot of the box and starts a writer thread streaming it to a file, the box can keep being stepped and edited while the save runs.
+///        The snapshot only references the chunk storage, chunks written to while the save runs get copied on their first write.
+///        Must be called from the thread that owns the box, between steps.
+/// @param box  SBXBox struct used to retrieve and check the box data to save, cannot be SBX_POINTER_UNSET
+/// @param path The path of the file to write, cannot be SBX_POINTER_UNSET
+/// @param save A pointer to a SBX_box_save_t pointer that will be set to the new save object, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the save start function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT, SBX_COMMON_ERROR_MEMORY_FAILURE,
+///                                  SBX_COMMON_ERROR_IO_FAILURE, SBX_COMMON_ERROR_THREAD_FAILURE
+SBX_report_t SBXBoxSaveBegin(SBX_box_t* box, SBX_string_t path, SBX_box_save_t** save);
+
+/// @brief Checks if the writer thread of a save has finished without blocking.
+/// @param save     SBXBoxSave struct used to check the save state, cannot be SBX_POINTER_UNSET
+/// @param finished A pointer to a SBX_bool_t variable to store the finished state in, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the save poll function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXBoxSavePoll(SBX_box_save_t* save, SBX_bool_t* finished);
+
+/// @brief Waits for the writer thread of a save to finish, releases the snapshot, and deallocates the save object.
+/// @param save A SBX_box_save_t pointer to the save to finish, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the result of the save, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_IO_FAILURE, SBX_COMMON_ERROR_THREAD_FAILURE
+SBX_report_t SBXBoxSaveEnd(SBX_box_save_t* save);
+
+/// @brief Saves the box to a file and waits for the save to finish.
+/// @param box  SBXBox struct used to retrieve and check the box data to save, cannot be SBX_POINTER_UNSET
+/// @param path The path of the file to write, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the result of the save, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT, SBX_COMMON_ERROR_MEMORY_FAILURE,
+///                                  SBX_COMMON_ERROR_IO_FAILURE, SBX_COMMON_ERROR_THREAD_FAILURE
+SBX_report_t SBXBoxSave(SBX_box_t* box, SBX_string_t path);
+
+/// @brief Initializes a deinitialized box from a file written by SBXBoxSave or SBXBoxSaveBegin.
+/// @param box  SBXBox struct used to store the loaded box data, cannot be SBX_POINTER_UNSET
+/// @param path The path of the file to read, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the load function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_ALREADY_INIT, SBX_COMMON_ERROR_MEMORY_FAILURE,
+///                                  SBX_COMMON_ERROR_IO_FAILURE
+SBX_report_t SBXBoxLoad(SBX_box_t* box, SBX_string_t path);
+
+#endif // SBX_SAVE_H
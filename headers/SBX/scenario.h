@@ -0,0 +1,83 @@
+#ifndef SBX_SCENARIO_H
+#define SBX_SCENARIO_H
+
+// Project headers
+#include <SBX/box.h>
+#include <SBX/types.h>
+#include <SBX/report.h>
+
+#define SBX_SCENARIO_GOLDEN_MAGIC     "SBXG"
+#define SBX_SCENARIO_GOLDEN_VERSION   2
+#define SBX_SCENARIO_GOLDEN_EXTENSION ".sbxg"
+
+// Steps per degree temperatures are rounded to before hashing
+#define SBX_SCENARIO_TEMPERATURE_QUANTA 64
+
+/// @brief Structure used by SBXScenario* functions to describe one seeded run of a box, every edit is derived from the seed so reruns push identical commands
+struct SBXScenario {
+    /// @brief SBX_string_t object used to store the name of the scenario, also the name of its golden file
+    SBX_string_t         name;
+    /// @brief uint64_t object used to store the seed the edits are derived from
+    uint64_t             seed;
+
+    /// @brief SBX_box_dimensions_t objects used to store the size the box starts with
+    SBX_box_dimensions_t width, height;
+    /// @brief SBX_box_tick_t object used to store the number of ticks to step
+    SBX_box_tick_t       tickCount;
+    /// @brief uint32_t object used to store the number of edit commands pushed before every step
+    uint32_t             editsPerTick;
+    /// @brief SBX_bool_t object used to store whether resize commands are part of the edit mix
+    SBX_bool_t           resizes;
+};
+
+/// @brief Structure used by SBXScenarioRun to pick where golden files live and what counts as a failure
+struct SBXScenarioOptions {
+    /// @brief SBX_string_t object used to store the directory golden files are read from and written to, cannot be SBX_POINTER_UNSET
+    SBX_string_t goldenDirectory;
+    /// @brief SBX_bool_t object used to store whether to write the golden file from this run instead of comparing against it
+    SBX_bool_t   update;
+    /// @brief double object used to store how many times slower than the baseline the mean step time may get, 0 to not check timing.
+    ///        The baseline is the absolute step time of the machine that wrote the golden file, so only compare on that machine
+    double       timingThreshold;
+};
+
+/// @brief Structure filled by SBXScenarioRun with what the run measured
+struct SBXScenarioResult {
+    /// @brief SBX_box_tick_t object used to store the first tick whose chunk hashes differ from the golden file, SBX_SCENARIO_TICK_UNSET if none did
+    SBX_box_tick_t    divergedTick;
+    /// @brief SBX_chunk_index_t object used to store the first chunk that differs on divergedTick, SBX_SCENARIO_CHUNK_UNSET if the chunk table size differs
+    SBX_chunk_index_t divergedChunk;
+
+    /// @brief uint64_t objects used to store the mean SBXBoxStep time of this run and of the run that wrote the golden file, in nanoseconds
+    uint64_t          meanStepNanoseconds, baselineStepNanoseconds;
+};
+
+#define SBX_SCENARIO_TICK_UNSET  UINT64_MAX
+#define SBX_SCENARIO_CHUNK_UNSET UINT32_MAX
+
+/// @brief Gets the built-in scenario corpus, covering small and large boxes, dense and sparse edits, and resizes.
+/// @param scenarios A pointer to a SBX_scenario_t pointer to store the corpus in, cannot be SBX_POINTER_UNSET
+/// @param count     A pointer to a uint32_t variable to store the number of scenarios in, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the query function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXScenarioGetCorpus(const SBX_scenario_t** scenarios, uint32_t* count);
+
+/// @brief Gets a hash of every chunk of a box, in chunk table order, over the positions, types, and temperatures of its set plocks. Empty chunks hash to 0.
+///        Temperatures are rounded to SBX_SCENARIO_TEMPERATURE_QUANTA steps per degree first, diffusion runs in long double, which is 80 bit on x86
+///        and 64 or 128 bit elsewhere, so only the rounded temperatures are expected to match golden files written on another platform.
+/// @param box    SBXBox struct used to retrieve the chunks to hash, cannot be SBX_POINTER_UNSET
+/// @param hashes uint64_t array with room for one hash per chunk of the box, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the hash function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT
+SBX_report_t SBXScenarioHashChunks(SBX_box_t* box, uint64_t* hashes);
+
+/// @brief Runs a scenario headless through SBXBoxStep, hashing every chunk after every tick and comparing the hashes and mean step time against its golden file.
+/// @param scenario SBXScenario struct describing the run, cannot be SBX_POINTER_UNSET
+/// @param options  SBXScenarioOptions struct used to find the golden file and the timing threshold, cannot be SBX_POINTER_UNSET
+/// @param result   A pointer to a SBX_scenario_result_t variable to store what the run measured in, can be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the run, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE, SBX_COMMON_ERROR_IO_FAILURE,
+///                                  SBX_SCENARIO_ERROR_DIVERGED, SBX_SCENARIO_ERROR_TOO_SLOW
+SBX_report_t SBXScenarioRun(const SBX_scenario_t* scenario, const SBX_scenario_options_t* options, SBX_scenario_result_t* result);
+
+#endif // SBX_SCENARIO_H
@@ -0,0 +1,163 @@
+#ifndef SBX_SLAB_H
+#define SBX_SLAB_H
+
+// Project headers
+#include <SBX/box.h>
+#include <SBX/types.h>
+#include <SBX/report.h>
+
+// LibC headers
+#include <stdatomic.h>
+
+// Slab axes, which way a world is cut into slabs
+enum SBXSlabAxes {
+    // Slabs are bands of whole rows stacked top to bottom
+    SBX_SLAB_AXIS_HORIZONTAL = 0,
+    // Slabs are bands of whole columns side by side
+    SBX_SLAB_AXIS_VERTICAL   = 1
+};
+
+// Rows or columns of its neighbors every slab keeps a copy of, the thermal step reads one cell across
+#define SBX_SLAB_HALO_DEPTH           1
+// Ticks of border rows a halo channel holds, so a slab can publish the next tick before its neighbor read the last one
+#define SBX_SLAB_HALO_SLOTS           2
+// Milliseconds a slab waits for a neighbor before the step fails, so a crashed neighbor does not hang its peers forever
+#define SBX_SLAB_TIMEOUT_MILLISECONDS 10000
+// Value of the magic field of an initialized slab group
+#define SBX_SLAB_MAGIC                0x53425853u
+
+/// @brief Structure used by SBXSlab* functions as the header of the shared memory of a slab group, the halo channels and migration queues follow it
+struct SBXSlabShared {
+    /// @brief uint32_t object used to store SBX_SLAB_MAGIC once the group is laid out
+    _Atomic uint32_t      magic;
+    /// @brief SBX_slab_axis_t object used to store the SBXSlabAxes value the world is cut along
+    SBX_slab_axis_t       axis;
+    /// @brief uint16_t object used to store the number of slabs
+    uint16_t              slabCount;
+    /// @brief SBX_box_dimensions_t objects used to store the size of the whole world
+    SBX_box_dimensions_t  width, height;
+    /// @brief uint32_t object used to store the number of migrations every slab queue has room for, a power of 2
+    uint32_t              migrationCapacity;
+    /// @brief size_t object used to store the size of the shared memory in bytes
+    size_t                size;
+};
+
+/// @brief Structure used by SBXSlab* functions to carry the border rows of one slab to one neighbor, SBX_SLAB_HALO_SLOTS ticks of
+///        SBX_SLAB_HALO_DEPTH lines of SBX_plock_t follow it
+struct SBXSlabChannel {
+    /// @brief uint32_t object used as a futex counting the ticks the sending slab wrote
+    _Atomic uint32_t published;
+    /// @brief uint32_t object used as a futex counting the ticks the receiving slab read
+    _Atomic uint32_t consumed;
+};
+
+/// @brief Structure used by SBXSlab* functions to store one plock waiting in a migration queue
+struct SBXSlabMigration {
+    /// @brief uint32_t object used to order producers and the consumer over the slot, the slot is free for position p when it is p and full when it is p + 1
+    _Atomic uint32_t   sequence;
+    /// @brief uint32_t object used to store the tick the owning slab applies the plock at, the tick of the sender plus the distance between the slabs
+    uint32_t           tick;
+    /// @brief uint16_t object used to store the index of the sending slab, migrations due on the same tick are applied in sender order
+    uint16_t           sender;
+    /// @brief SBX_box_position_t objects used to store the world position the plock moves to
+    SBX_box_position_t x, y;
+    /// @brief SBX_plock_t object used to store the plock
+    SBX_plock_t        plock;
+};
+
+/// @brief Structure used by SBXSlab* functions as the multiple producer, single consumer queue of plocks moving into one slab, migrationCapacity slots follow it
+struct SBXSlabQueue {
+    /// @brief uint32_t object used to keep the next position producers claim
+    _Atomic uint32_t enqueuePosition;
+    /// @brief uint32_t object used to keep the next position the owning slab reads
+    _Atomic uint32_t dequeuePosition;
+};
+
+/// @brief Structure used by SBXSlab* functions to own one slab of a world shared between processes on the same host.
+///        The slab simulates a box holding its own lines and SBX_SLAB_HALO_DEPTH lines of every neighbor, refreshed from the neighbors every step.
+struct SBXSlab {
+    /// @brief SBX_slab_shared_t pointer to the shared memory of the group, mapped into this process
+    SBX_slab_shared_t*    shared;
+    /// @brief uint16_t object used to store the index of the slab in the group, slabs are numbered top to bottom or left to right
+    uint16_t              index;
+
+    /// @brief SBX_box_t pointer to the box simulating the slab and its halo lines, positions are local, see SBXSlabGetLocalPosition
+    SBX_box_t*            box;
+    /// @brief uint32_t objects used to store the first world line the slab owns and the line after its last one, along the axis
+    uint32_t              firstLine, lastLine;
+    /// @brief uint32_t objects used to store the number of halo lines before and after the owned lines, 0 at the world edges
+    uint32_t              haloBefore, haloAfter;
+
+    /// @brief uint32_t object used to keep the number of steps the slab took, the halo channels are indexed by it
+    uint32_t              tick;
+    /// @brief SBX_slab_migration_t array used to keep the migrations drained from the queue ordered by tick and sender, applied at the start of the step they are due
+    SBX_slab_migration_t* pending;
+    /// @brief uint32_t object used to keep the number of pending migrations
+    uint32_t              pendingCount;
+};
+
+/// @brief Creates and lays out the named shared memory of a slab group, slabs of the group are then attached by any process on the host.
+///        The shared memory only exists on Linux, where halo channels are signalled with futexes.
+/// @param name              The POSIX shared memory name of the group, starting with a slash, cannot be SBX_POINTER_UNSET
+/// @param axis              The SBXSlabAxes value to cut the world along
+/// @param width             The width of the whole world, cannot be SBX_DIMENSION_UNSET
+/// @param height            The height of the whole world, cannot be SBX_DIMENSION_UNSET
+/// @param slabCount         The number of slabs, from 1 to the number of lines along the axis
+/// @param migrationCapacity The number of migrations every slab queue has room for, rounded up to a power of 2, cannot be 0
+/// @return A SBXReport struct that reports the return state of the creation function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_IO_FAILURE
+SBX_report_t SBXSlabGroupCreate(SBX_string_t name, SBX_slab_axis_t axis, SBX_box_dimensions_t width, SBX_box_dimensions_t height,
+                                uint16_t slabCount, uint32_t migrationCapacity);
+
+/// @brief Removes the name of a slab group, slabs already attached keep their mapping until they detach.
+/// @param name The POSIX shared memory name of the group, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the destruction function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_IO_FAILURE
+SBX_report_t SBXSlabGroupDestroy(SBX_string_t name);
+
+/// @brief Maps a slab group and creates the box of one of its slabs, with every plock unset. Every slab of a group has to be attached by exactly one process.
+///        The memory is accounted to SBX_MEMORY_SUBSYSTEM_SLAB of the default allocator.
+/// @param slab  A pointer to a SBX_slab_t pointer that will be set to the new object, cannot be SBX_POINTER_UNSET
+/// @param name  The POSIX shared memory name of the group, cannot be SBX_POINTER_UNSET
+/// @param index The index of the slab to own, less than the slab count of the group
+/// @return A SBXReport struct that reports the return state of the attach function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_IO_FAILURE, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXSlabAttach(SBX_slab_t** slab, SBX_string_t name, uint16_t index);
+
+/// @brief Destroys the box of a slab and unmaps its group, pending migrations are lost.
+/// @param slab A SBX_slab_t pointer to the desired SBXSlab to be detached, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the detach function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXSlabDetach(SBX_slab_t* slab);
+
+/// @brief Converts a world position to a position of the box of the slab.
+/// @param slab   SBXSlab struct used to retrieve the bounds, cannot be SBX_POINTER_UNSET
+/// @param worldX The x position in the world
+/// @param worldY The y position in the world
+/// @param x      A pointer to a SBX_box_position_t variable to store the local x position in, cannot be SBX_POINTER_UNSET
+/// @param y      A pointer to a SBX_box_position_t variable to store the local y position in, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the conversion function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_OUT_OF_BOUNDS for positions outside the slab and its halo
+SBX_report_t SBXSlabGetLocalPosition(SBX_slab_t* slab, SBX_box_position_t worldX, SBX_box_position_t worldY, SBX_box_position_t* x, SBX_box_position_t* y);
+
+/// @brief Sets the plock at a world position. Positions the slab owns are written now, positions owned by other slabs are queued to their owner.
+///        The owner applies the plock at the start of its step numbered the tick of the sender plus the distance between the slabs, which every slab is
+///        guaranteed to have received by then, so the result does not depend on how the processes are scheduled.
+/// @param slab   SBXSlab struct used to retrieve the box and queues, cannot be SBX_POINTER_UNSET
+/// @param worldX The x position in the world, must be less than the world width
+/// @param worldY The y position in the world, must be less than the world height
+/// @param plock  The desired plock for the position
+/// @return A SBXReport struct that reports the return state of the setting function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_OUT_OF_BOUNDS, SBX_SLAB_ERROR_MIGRATION_FULL,
+///                                  SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXSlabSetPlock(SBX_slab_t* slab, SBX_box_position_t worldX, SBX_box_position_t worldY, SBX_plock_t plock);
+
+/// @brief Advances the slab by one tick in lockstep with its neighbors: queued migrations are applied, border lines are sent to the neighbors and
+///        their border lines copied into the halo, then the box is stepped. Must only be called from the process that attached the slab.
+/// @param slab SBXSlab struct used to retrieve and store the slab, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the step function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_IO_FAILURE when a neighbor times out,
+///                                  SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXSlabStep(SBX_slab_t* slab);
+
+#endif // SBX_SLAB_H
@@ -0,0 +1,43 @@
+#ifndef SBX_STATS_H
+#define SBX_STATS_H
+
+// Project headers
+#include <SBX/box.h>
+#include <SBX/types.h>
+#include <SBX/report.h>
+
+#define SBX_BOX_STATS_RECOUNT_THREAD_COUNT 4
+
+/// @brief Structure used by SBXBox*Stats functions to store plock type counts, thermal energy, active chunks, and temperature extremes of a box
+struct SBXBoxStats {
+    /// @brief SBX_plock_count_t array used to store the number of plocks of every plock type, SBX_PLOCK_TYPE_ID_UNSET counts unset positions
+    SBX_plock_count_t       plockTypeCounts[SBX_PLOCK_TYPE_COUNT];
+    /// @brief SBX_plock_count_t object used to store the number of set plocks
+    SBX_plock_count_t       plockCount;
+
+    /// @brief SBX_plock_temperature_t object used to store the sum of the temperatures of every set plock
+    SBX_plock_temperature_t thermalEnergy;
+    /// @brief SBX_plock_temperature_t object used to store the lowest temperature of any set plock, SBX_TEMPERATURE_UNSET when there are none
+    SBX_plock_temperature_t minimumTemperature;
+    /// @brief SBX_plock_temperature_t object used to store the highest temperature of any set plock, SBX_TEMPERATURE_UNSET when there are none
+    SBX_plock_temperature_t maximumTemperature;
+
+    /// @brief SBX_chunk_index_t object used to store the number of chunks holding at least one set plock
+    SBX_chunk_index_t       activeChunkCount;
+};
+
+/// @brief Gets the stats of the supplied box from counters kept up to date by every plock write, costs O(chunks) rather than O(plocks) and never writes to the box.
+/// @param box   SBXBox struct used to retrieve and check stats query related box data, cannot be SBX_POINTER_UNSET
+/// @param stats A pointer to a SBX_box_stats_t variable to store the stats in, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the stats query function, this can be an error, or a success
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT
+SBX_report_t SBXBoxGetStats(SBX_box_t* box, SBX_box_stats_t* stats);
+
+/// @brief Recounts the stats of the supplied box from every plock on SBX_BOX_STATS_RECOUNT_THREAD_COUNT threads, used to validate SBXBoxGetStats.
+/// @param box   SBXBox struct used to retrieve and check stats recount related box data, cannot be SBX_POINTER_UNSET
+/// @param stats A pointer to a SBX_box_stats_t variable to store the stats in, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the stats recount function, this can be an error, or a success
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT
+SBX_report_t SBXBoxRecountStats(SBX_box_t* box, SBX_box_stats_t* stats);
+
+#endif // SBX_STATS_H
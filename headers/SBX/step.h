@@ -0,0 +1,16 @@
+#ifndef SBX_STEP_H
+#define SBX_STEP_H
+
+// Project headers
+#include <SBX/box.h>
+#include <SBX/types.h>
+#include <SBX/report.h>
+
+/// @brief Advances the supplied box by one tick, starting with the edit commands pushed since the last step.
+///        Must only be called from the thread that owns the box.
+/// @param box SBXBox struct used to retrieve, store, and check step related box data, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the step function, this can be an error, or a success
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXBoxStep(SBX_box_t* box);
+
+#endif // SBX_STEP_H
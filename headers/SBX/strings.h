@@ -4,6 +4,8 @@
 // Common error strings
 #define SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT             "One or more required arguments set to an invalid value (NULL or 0)"
 #define SBX_REPORT_STRING_COMMON_MEMORY_FAILURE               "Error executing a memory operation (allocation, reallocation, and deallocation)"
+#define SBX_REPORT_STRING_COMMON_IO_FAILURE                   "Error executing a file operation (open, read, write, and close)"
+#define SBX_REPORT_STRING_COMMON_THREAD_FAILURE               "Error executing a thread operation (create, and join)"
 
 // Common success string
 #define SBX_REPORT_STRING_COMMON_CREATION_SUCCESSFUL          "Successfully created/allocated object"
@@ -39,18 +41,60 @@
 #define SBX_REPORT_STRING_BOX_NOT_DEINIT                      "Box not deinitialized"
 #define SBX_REPORT_STRING_BOX_PLOCKS_FAILED                   "Failed to create plocks"
 #define SBX_REPORT_STRING_BOX_PLOCK_IDS_FAILED                "Failed to create plock id matrix"
+#define SBX_REPORT_STRING_BOX_OUT_OF_BOUNDS                   "Position is outside of the box"
+#define SBX_REPORT_STRING_BOX_SAVE_INVALID_FILE               "File is not a valid box save"
 
 // SBXBox success strings
 #define SBX_REPORT_STRING_BOX_INIT_SUCCESSFUL                 "Successfully initialized box"
 #define SBX_REPORT_STRING_BOX_DEINIT_SUCCESSFUL               "Successfully deinitialized box"
 #define SBX_REPORT_STRING_BOX_GET_SIZE_SUCCESSFUL             "Successfully got box size"
 #define SBX_REPORT_STRING_BOX_SET_SIZE_SUCCESSFUL             "Successfully set box size"
+#define SBX_REPORT_STRING_BOX_GET_PLOCK_SUCCESSFUL            "Successfully got box plock"
+#define SBX_REPORT_STRING_BOX_GET_HASH_SUCCESSFUL             "Successfully got box hash"
+#define SBX_REPORT_STRING_BOX_SET_PLOCK_SUCCESSFUL            "Successfully set box plock"
+#define SBX_REPORT_STRING_BOX_CLONE_SUCCESSFUL                "Successfully cloned box"
+#define SBX_REPORT_STRING_BOX_DEFRAGMENT_SUCCESSFUL           "Successfully defragmented box"
+#define SBX_REPORT_STRING_BOX_GET_STATS_SUCCESSFUL            "Successfully got box stats"
+#define SBX_REPORT_STRING_BOX_RECOUNT_STATS_SUCCESSFUL        "Successfully recounted box stats"
+#define SBX_REPORT_STRING_BOX_SAVE_BEGIN_SUCCESSFUL           "Successfully started box save"
+#define SBX_REPORT_STRING_BOX_SAVE_POLL_SUCCESSFUL            "Successfully polled box save"
+#define SBX_REPORT_STRING_BOX_SAVE_SUCCESSFUL                 "Successfully saved box"
+#define SBX_REPORT_STRING_BOX_LOAD_SUCCESSFUL                 "Successfully loaded box"
+#define SBX_REPORT_STRING_BOX_COMMAND_QUEUE_INIT_SUCCESSFUL   "Successfully initialized box command queue"
+#define SBX_REPORT_STRING_BOX_COMMAND_QUEUE_DEINIT_SUCCESSFUL "Successfully deinitialized box command queue"
+#define SBX_REPORT_STRING_BOX_PUSH_COMMAND_SUCCESSFUL         "Successfully pushed box command"
+#define SBX_REPORT_STRING_BOX_APPLY_COMMANDS_SUCCESSFUL       "Successfully applied box commands"
+#define SBX_REPORT_STRING_BOX_DISCARD_COMMANDS_SUCCESSFUL     "Successfully discarded box commands"
+#define SBX_REPORT_STRING_BOX_STEP_SUCCESSFUL                 "Successfully stepped box"
+#define SBX_REPORT_STRING_BOX_CHANGE_TRACKER_INIT_SUCCESSFUL  "Successfully initialized box change tracker"
+#define SBX_REPORT_STRING_BOX_SUBSCRIBE_SUCCESSFUL            "Successfully subscribed to box changes"
+#define SBX_REPORT_STRING_BOX_UNSUBSCRIBE_SUCCESSFUL          "Successfully unsubscribed from box changes"
+#define SBX_REPORT_STRING_BOX_TRACK_CHANGE_SUCCESSFUL         "Successfully tracked box change"
+#define SBX_REPORT_STRING_BOX_NOTIFY_CHANGES_SUCCESSFUL       "Successfully notified box changes"
+#define SBX_REPORT_STRING_BOX_THERMAL_INIT_SUCCESSFUL         "Successfully initialized box thermal state"
+#define SBX_REPORT_STRING_BOX_THERMAL_DEINIT_SUCCESSFUL       "Successfully deinitialized box thermal state"
+#define SBX_REPORT_STRING_BOX_SET_THERMAL_SUCCESSFUL          "Successfully set box thermal settings"
+#define SBX_REPORT_STRING_BOX_GET_THERMAL_SUCCESSFUL          "Successfully got box thermal active chunk count"
+#define SBX_REPORT_STRING_BOX_THERMAL_ACTIVATE_SUCCESSFUL     "Successfully activated box thermal chunks"
+#define SBX_REPORT_STRING_BOX_THERMAL_STEP_SUCCESSFUL         "Successfully diffused box temperatures"
+#define SBX_REPORT_STRING_BOX_THERMAL_BEGIN_SUCCESSFUL        "Successfully began box thermal pass"
+#define SBX_REPORT_STRING_BOX_THERMAL_COMPUTE_SUCCESSFUL      "Successfully computed box thermal chunk"
+#define SBX_REPORT_STRING_BOX_THERMAL_APPLY_SUCCESSFUL        "Successfully applied box thermal chunk"
+#define SBX_REPORT_STRING_BOX_THERMAL_END_SUCCESSFUL          "Successfully ended box thermal pass"
+#define SBX_REPORT_STRING_BOX_SET_BOUNDARY_SUCCESSFUL         "Successfully set box boundary plock"
+#define SBX_REPORT_STRING_GHOST_PLANE_REFRESH_SUCCESSFUL      "Successfully refreshed ghost plane"
+#define SBX_REPORT_STRING_BOX_LOD_INIT_SUCCESSFUL             "Successfully initialized box level of detail policy"
+#define SBX_REPORT_STRING_BOX_SET_LOD_SUCCESSFUL              "Successfully set box level of detail policy"
+#define SBX_REPORT_STRING_BOX_SET_VIEWPORT_SUCCESSFUL         "Successfully set box viewport"
 
 // SBXPlockArray error strings
+#define SBX_REPORT_STRING_PLOCK_ARRAY_FULL                    "Plock array has no free plock IDs left"
 
 // SBXPlockArray success strings
 #define SBX_REPORT_STRING_PLOCK_ARRAY_GET_SIZE_SUCCESSFUL     "Successfully got plock array size"
 #define SBX_REPORT_STRING_PLOCK_ARRAY_SET_SIZE_SUCCESSFUL     "Successfully set plock array size"
+#define SBX_REPORT_STRING_PLOCK_ARRAY_ACQUIRE_SUCCESSFUL      "Successfully acquired plock ID"
+#define SBX_REPORT_STRING_PLOCK_ARRAY_RELEASE_SUCCESSFUL      "Successfully released plock ID"
 
 // SBXPlockIDMatrix error strings
 
@@ -58,4 +102,124 @@
 #define SBX_REPORT_STRING_PLOCK_ID_MATRIX_GET_SIZE_SUCCESSFUL "Successfully got plock ID matrix size"
 #define SBX_REPORT_STRING_PLOCK_ID_MATRIX_SET_SIZE_SUCCESSFUL "Successfully set plock ID matrix size"
 
+// SBXChunk success strings
+#define SBX_REPORT_STRING_CHUNK_RETAIN_SUCCESSFUL             "Successfully retained chunk data"
+#define SBX_REPORT_STRING_CHUNK_RELEASE_SUCCESSFUL            "Successfully released chunk data"
+#define SBX_REPORT_STRING_CHUNK_DUPLICATE_SUCCESSFUL          "Successfully duplicated chunk data"
+#define SBX_REPORT_STRING_CHUNK_MAKE_WRITABLE_SUCCESSFUL      "Successfully made chunk writable"
+#define SBX_REPORT_STRING_CHUNK_DEFRAGMENT_SUCCESSFUL         "Successfully defragmented chunk"
+#define SBX_REPORT_STRING_CHUNK_RECOUNT_HASH_SUCCESSFUL       "Successfully recounted chunk content hash"
+#define SBX_REPORT_STRING_CHUNK_RECOUNT_STATS_SUCCESSFUL      "Successfully recounted chunk stats"
+
+// SBXParticlePool error strings
+#define SBX_REPORT_STRING_PARTICLE_POOL_FULL                  "Particle pool has no free particles left"
+
+// SBXParticlePool success strings
+#define SBX_REPORT_STRING_PARTICLE_POOL_EJECT_SUCCESSFUL      "Successfully ejected plock into particle pool"
+#define SBX_REPORT_STRING_PARTICLE_POOL_STEP_SUCCESSFUL       "Successfully stepped particle pool"
+
+// SBXGasField success strings
+#define SBX_REPORT_STRING_GAS_FIELD_SET_PARAMETERS_SUCCESSFUL "Successfully set gas field parameters"
+#define SBX_REPORT_STRING_GAS_FIELD_ADD_SUCCESSFUL            "Successfully added gas to gas field"
+#define SBX_REPORT_STRING_GAS_FIELD_ABSORB_SUCCESSFUL         "Successfully absorbed plock into gas field"
+#define SBX_REPORT_STRING_GAS_FIELD_STEP_SUCCESSFUL           "Successfully stepped gas field"
+#define SBX_REPORT_STRING_GAS_FIELD_GET_DENSITY_SUCCESSFUL    "Successfully got gas field density"
+#define SBX_REPORT_STRING_GAS_FIELD_GET_OVERLAY_SUCCESSFUL    "Successfully got gas field overlay"
+
+// SBXComponentLabels success strings
+#define SBX_REPORT_STRING_COMPONENT_LABELS_SET_CLASSES_SUCCESSFUL "Successfully set component label classes"
+#define SBX_REPORT_STRING_COMPONENT_LABELS_UPDATE_SUCCESSFUL      "Successfully updated component labels"
+#define SBX_REPORT_STRING_COMPONENT_LABELS_GET_SUCCESSFUL         "Successfully got component"
+
+// SBXColorPyramid success strings
+#define SBX_REPORT_STRING_COLOR_PYRAMID_SET_PALETTE_SUCCESSFUL "Successfully set color pyramid palette"
+#define SBX_REPORT_STRING_COLOR_PYRAMID_UPDATE_SUCCESSFUL      "Successfully updated color pyramid"
+#define SBX_REPORT_STRING_COLOR_PYRAMID_GET_VIEW_SUCCESSFUL    "Successfully got color pyramid view"
+#define SBX_REPORT_STRING_COLOR_PYRAMID_WRITE_CHUNK_SUCCESSFUL "Successfully wrote color pyramid chunk"
+
+// SBXRenderer success strings
+#define SBX_REPORT_STRING_RENDERER_DRAW_SUCCESSFUL             "Successfully drew box"
+#define SBX_REPORT_STRING_RENDERER_SET_TARGET_SUCCESSFUL       "Successfully set renderer target"
+
+// SBXCapture error strings
+#define SBX_REPORT_STRING_CAPTURE_FRAMEBUFFER_INCOMPLETE       "Capture framebuffer is incomplete"
+#define SBX_REPORT_STRING_CAPTURE_READBACK_FAILED              "Reading the capture framebuffer back failed"
+
+// SBXCapture success strings
+#define SBX_REPORT_STRING_CAPTURE_READ_SUCCESSFUL              "Successfully started capture readback"
+#define SBX_REPORT_STRING_CAPTURE_COLLECT_SUCCESSFUL           "Successfully collected capture readbacks"
+
+// SBXSlab error strings
+#define SBX_REPORT_STRING_SLAB_MIGRATION_FULL                 "Slab migration queue has no free slots left"
+#define SBX_REPORT_STRING_SLAB_UNSUPPORTED                    "Slab groups need shared memory and futexes, which are only supported on Linux"
+#define SBX_REPORT_STRING_SLAB_INVALID_GROUP                  "Shared memory is not a valid slab group"
+#define SBX_REPORT_STRING_SLAB_TIMEOUT                        "Timed out waiting for a neighboring slab"
+
+// SBXSlab success strings
+#define SBX_REPORT_STRING_SLAB_GROUP_CREATE_SUCCESSFUL        "Successfully created slab group"
+#define SBX_REPORT_STRING_SLAB_GROUP_DESTROY_SUCCESSFUL       "Successfully destroyed slab group"
+#define SBX_REPORT_STRING_SLAB_ATTACH_SUCCESSFUL              "Successfully attached slab"
+#define SBX_REPORT_STRING_SLAB_DETACH_SUCCESSFUL              "Successfully detached slab"
+#define SBX_REPORT_STRING_SLAB_GET_LOCAL_POSITION_SUCCESSFUL  "Successfully got slab local position"
+#define SBX_REPORT_STRING_SLAB_SET_PLOCK_SUCCESSFUL           "Successfully set slab plock"
+#define SBX_REPORT_STRING_SLAB_STEP_SUCCESSFUL                "Successfully stepped slab"
+
+// SBXWorkers success strings
+#define SBX_REPORT_STRING_WORKERS_SET_SUCCESSFUL              "Successfully set box workers"
+#define SBX_REPORT_STRING_WORKERS_PLACE_SUCCESSFUL            "Successfully placed box chunks"
+#define SBX_REPORT_STRING_WORKERS_RUN_SUCCESSFUL              "Successfully ran job on workers"
+#define SBX_REPORT_STRING_WORKERS_GET_STATS_SUCCESSFUL        "Successfully got worker stats"
+
+// SBXTaskGraph error strings
+#define SBX_REPORT_STRING_TASK_GRAPH_CYCLE                    "Task graph has tasks depending on each other in a cycle"
+
+// SBXTaskGraph success strings
+#define SBX_REPORT_STRING_TASK_GRAPH_CLEAR_SUCCESSFUL         "Successfully cleared task graph"
+#define SBX_REPORT_STRING_TASK_GRAPH_ADD_SUCCESSFUL           "Successfully added task"
+#define SBX_REPORT_STRING_TASK_GRAPH_DEPEND_SUCCESSFUL        "Successfully added task dependency"
+#define SBX_REPORT_STRING_TASK_GRAPH_EXECUTE_SUCCESSFUL       "Successfully executed task graph"
+#define SBX_REPORT_STRING_TASK_GRAPH_GET_CRITICAL_PATH_SUCCESSFUL "Successfully got task graph critical path"
+
+// SBXFrame success strings
+#define SBX_REPORT_STRING_FRAME_RUN_SUCCESSFUL                "Successfully ran frame"
+#define SBX_REPORT_STRING_FRAME_GET_TIMING_SUCCESSFUL         "Successfully got frame timing"
+
+// SBXBoxRecorder and SBXRecordingPlayer error strings
+#define SBX_REPORT_STRING_RECORDING_UNSUPPORTED               "Recording spectator sockets need Unix domain sockets, which are only supported on Unix-like systems"
+#define SBX_REPORT_STRING_RECORDING_INVALID                   "Stream is not a valid box recording"
+
+// SBXBoxRecorder and SBXRecordingPlayer success strings
+#define SBX_REPORT_STRING_BOX_RECORD_BEGIN_SUCCESSFUL         "Successfully started recording box"
+#define SBX_REPORT_STRING_BOX_RECORD_END_SUCCESSFUL           "Successfully stopped recording box"
+#define SBX_REPORT_STRING_BOX_RECORDER_GET_STATS_SUCCESSFUL   "Successfully got box recorder stats"
+#define SBX_REPORT_STRING_RECORDING_PLAYER_OPEN_SUCCESSFUL    "Successfully opened recording"
+#define SBX_REPORT_STRING_RECORDING_PLAYER_CONNECT_SUCCESSFUL "Successfully connected to recorder"
+#define SBX_REPORT_STRING_RECORDING_PLAYER_CLOSE_SUCCESSFUL   "Successfully closed recording"
+#define SBX_REPORT_STRING_RECORDING_PLAYER_NEXT_SUCCESSFUL    "Successfully decoded recording frame"
+#define SBX_REPORT_STRING_RECORDING_PLAYER_APPLY_SUCCESSFUL   "Successfully applied recording frame"
+
+// SBXMaterialTable error strings
+#define SBX_REPORT_STRING_MATERIAL_INVALID                    "File is not a valid material file"
+
+// SBXMaterialTable success strings
+#define SBX_REPORT_STRING_MATERIAL_TABLE_RESET_SUCCESSFUL     "Successfully reset material table"
+#define SBX_REPORT_STRING_MATERIAL_TABLE_LOAD_FILE_SUCCESSFUL "Successfully loaded material file"
+#define SBX_REPORT_STRING_MATERIAL_TABLE_LOAD_DIRECTORY_SUCCESSFUL "Successfully loaded material directory"
+
+// SBXScenario error strings
+#define SBX_REPORT_STRING_SCENARIO_DIVERGED                   "Scenario chunk hashes differ from the golden file"
+#define SBX_REPORT_STRING_SCENARIO_TOO_SLOW                   "Scenario steps are slower than the golden file baseline allows"
+#define SBX_REPORT_STRING_SCENARIO_INVALID_GOLDEN             "File is not a valid scenario golden file"
+
+// SBXScenario success strings
+#define SBX_REPORT_STRING_SCENARIO_GET_CORPUS_SUCCESSFUL      "Successfully got scenario corpus"
+#define SBX_REPORT_STRING_SCENARIO_HASH_SUCCESSFUL            "Successfully hashed box chunks"
+#define SBX_REPORT_STRING_SCENARIO_RUN_SUCCESSFUL             "Successfully ran scenario"
+#define SBX_REPORT_STRING_SCENARIO_UPDATE_SUCCESSFUL          "Successfully wrote scenario golden file"
+
+// SBXAllocator success strings
+#define SBX_REPORT_STRING_ALLOCATOR_GET_DEFAULT_SUCCESSFUL    "Successfully got default allocator"
+#define SBX_REPORT_STRING_ALLOCATOR_GET_USAGE_SUCCESSFUL      "Successfully got allocator usage"
+#define SBX_REPORT_STRING_ALLOCATOR_GET_PREFAULT_SUCCESSFUL   "Successfully got allocator prefault progress"
+
 #endif // SBX_STRINGS_H
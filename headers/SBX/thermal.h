@@ -0,0 +1,150 @@
+#ifndef SBX_THERMAL_H
+#define SBX_THERMAL_H
+
+// Project headers
+#include <SBX/types.h>
+#include <SBX/report.h>
+#include <SBX/ghost.h>
+
+// Box thermal modes
+enum SBXBoxThermalModes {
+    // Temperatures only change through edits
+    SBX_BOX_THERMAL_MODE_OFF    = 0,
+    // Every chunk holding a set plock is diffused every tick
+    SBX_BOX_THERMAL_MODE_DENSE  = 1,
+    // Only chunks written since the last tick and their neighbors are diffused, gives the same temperatures as SBX_BOX_THERMAL_MODE_DENSE
+    SBX_BOX_THERMAL_MODE_SPARSE = 2
+};
+
+#define SBX_BOX_THERMAL_DEFAULT_DIFFUSIVITY 0.2L
+#define SBX_BOX_THERMAL_DEFAULT_EPSILON     0.01L
+// Largest diffusivity that keeps the explicit four neighbor update stable
+#define SBX_BOX_THERMAL_MAXIMUM_DIFFUSIVITY 0.25L
+
+/// @brief Structure used by SBXBoxThermal* functions to store the scratch space of one working chunk of a pass
+struct SBXBoxThermalChunk {
+    /// @brief SBX_ghost_plane_t object used to store the plocks of the chunk and of the ring around it the changes are worked out from
+    SBX_ghost_plane_t       plane;
+    /// @brief SBX_plock_temperature_t array used to store the temperature change of every position of the chunk
+    SBX_plock_temperature_t deltas[SBX_CHUNK_PLOCK_COUNT];
+};
+
+/// @brief Structure used by SBXBoxThermal* functions to store the thermal settings of a box and the chunks that may still be out of equilibrium
+struct SBXBoxThermal {
+    /// @brief SBX_allocator_t pointer to the allocator the active set and change buffers are allocated from
+    SBX_allocator_t*         allocator;
+
+    /// @brief SBX_box_thermal_mode_t object used to store the SBXBoxThermalModes value of the box
+    SBX_box_thermal_mode_t   mode;
+    /// @brief SBX_plock_temperature_t object used to store the fraction of a temperature difference that flows between neighbors every tick
+    SBX_plock_temperature_t  diffusivity;
+    /// @brief SBX_plock_temperature_t object used to store the temperature difference between neighbors at or below which no heat flows
+    SBX_plock_temperature_t  epsilon;
+
+    /// @brief uint8_t array used to keep whether every chunk is in the active set and in the working set of the current pass, indexed like the chunk table
+    uint8_t*                 chunkFlags;
+    /// @brief SBX_chunk_index_t array used to keep the active set, chunks written since the last thermal pass
+    SBX_chunk_index_t*       activeChunks;
+    /// @brief SBX_chunk_index_t array used as scratch space for the chunks a pass diffuses, filled from the front, and the chunks it defers, filled from the back
+    SBX_chunk_index_t*       workingChunks;
+    /// @brief uint32_t array used to keep the number of passes every chunk was deferred by the level of detail policy since it was last diffused, indexed like the chunk table
+    uint32_t*                owedTicks;
+    /// @brief SBX_chunk_index_t objects used to keep the number of active chunks and the number of chunks the arrays have room for
+    SBX_chunk_index_t        activeChunkCount, chunkCapacity;
+    /// @brief SBX_bool_t object used to keep whether a chunk could not be added to the active set, the next pass diffuses every chunk instead
+    SBX_bool_t               saturated;
+
+    /// @brief SBX_chunk_index_t objects used to keep the number of chunks the current pass diffuses and defers, 0 between passes
+    SBX_chunk_index_t        workingChunkCount, deferredChunkCount;
+
+    /// @brief SBX_box_thermal_chunk_t array used as scratch space for the working chunks, their ghost planes and temperature changes
+    SBX_box_thermal_chunk_t* scratch;
+    /// @brief SBX_chunk_index_t object used to keep the number of chunks the scratch array has room for
+    SBX_chunk_index_t        scratchCapacity;
+};
+
+/// @brief Sets up the thermal state of a box with the default settings and an empty active set.
+/// @param thermal   SBXBoxThermal struct used to store the thermal state, cannot be SBX_POINTER_UNSET
+/// @param allocator The allocator to allocate the active set and change buffers from, SBX_POINTER_UNSET for the default allocator
+/// @return A SBXReport struct that reports the return state of the thermal initialization function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXBoxThermalInit(SBX_box_thermal_t* thermal, SBX_allocator_t* allocator);
+
+/// @brief Frees the active set and change buffers of the thermal state of a box.
+/// @param thermal SBXBoxThermal struct used to retrieve the buffers to free, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the thermal deinitialization function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXBoxThermalDeinit(SBX_box_thermal_t* thermal);
+
+/// @brief Sets how the supplied box diffuses temperature between neighboring set plocks every step, unset positions and the box edges do not conduct.
+///        Heat only flows between neighbors whose temperatures differ by more than epsilon, so chunks settle and leave the active set.
+/// @param box         SBXBox struct used to store the thermal settings, cannot be SBX_POINTER_UNSET
+/// @param mode        The SBXBoxThermalModes value to use
+/// @param diffusivity The fraction of a temperature difference that flows every tick, above 0 and at most SBX_BOX_THERMAL_MAXIMUM_DIFFUSIVITY
+/// @param epsilon     The temperature difference at or below which no heat flows, cannot be negative
+/// @return A SBXReport struct that reports the return state of the thermal setting function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXBoxSetThermal(SBX_box_t* box, SBX_box_thermal_mode_t mode, SBX_plock_temperature_t diffusivity, SBX_plock_temperature_t epsilon);
+
+/// @brief Gets the number of chunks in the active set of the supplied box, the chunks the next sparse pass starts from.
+/// @param box   SBXBox struct used to retrieve the active set, cannot be SBX_POINTER_UNSET
+/// @param count A pointer to a SBX_chunk_index_t variable to store the count in, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the query function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXBoxGetThermalActiveChunkCount(SBX_box_t* box, SBX_chunk_index_t* count);
+
+/// @brief Adds a chunk to the active set of a box, called by every plock write of the box.
+///        If the active set can't grow the next pass diffuses every chunk instead.
+/// @param box        SBXBox struct used to retrieve the active set, cannot be SBX_POINTER_UNSET
+/// @param chunkIndex The index of the chunk in the chunk table
+/// @return A SBXReport struct that reports the return state of the activation function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXBoxThermalActivate(SBX_box_t* box, SBX_chunk_index_t chunkIndex);
+
+/// @brief Replaces the active set of a box with every chunk holding a set plock, called whenever the chunk table is replaced or filled in bulk.
+/// @param box SBXBox struct used to retrieve the chunk table and active set, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the activation function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXBoxThermalActivateAll(SBX_box_t* box);
+
+/// @brief Starts a thermal pass, picks the chunks to diffuse this tick and makes room for their changes.
+///        A pass is SBXBoxThermalBegin, SBXBoxThermalComputeChunk for every working chunk, SBXBoxThermalApplyChunk for every working chunk
+///        once no computation reads it anymore, and SBXBoxThermalEnd. Nothing else may write the box until the pass ends.
+/// @param box          SBXBox struct used to retrieve the active set, cannot be SBX_POINTER_UNSET
+/// @param workingCount A pointer to a SBX_chunk_index_t variable to store the number of working chunks in, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the thermal begin function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXBoxThermalBegin(SBX_box_t* box, SBX_chunk_index_t* workingCount);
+
+/// @brief Works out the temperature changes of one working chunk of the current pass. Only reads plocks and only writes the changes of that chunk,
+///        so any number of working chunks can be computed at once, as long as none of the chunk or its four neighbors is applied meanwhile.
+/// @param box          SBXBox struct used to retrieve the plocks, cannot be SBX_POINTER_UNSET
+/// @param workingIndex The position of the chunk in the working set, below the count given by SBXBoxThermalBegin
+/// @return A SBXReport struct that reports the return state of the thermal compute function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXBoxThermalComputeChunk(SBX_box_t* box, SBX_chunk_index_t workingIndex);
+
+/// @brief Writes the temperature changes of one working chunk of the current pass through the box.
+///        Writes touch box wide state, so chunks are applied one at a time and only once the chunk and its four neighbors are computed.
+/// @param box          SBXBox struct used to store the plocks, cannot be SBX_POINTER_UNSET
+/// @param workingIndex The position of the chunk in the working set, below the count given by SBXBoxThermalBegin
+/// @return A SBXReport struct that reports the return state of the thermal apply function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXBoxThermalApplyChunk(SBX_box_t* box, SBX_chunk_index_t workingIndex);
+
+/// @brief Ends the current thermal pass once every working chunk is applied.
+/// @param box SBXBox struct used to retrieve the pass, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the thermal end function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXBoxThermalEnd(SBX_box_t* box);
+
+/// @brief Diffuses temperature for one tick, called by SBXBoxStep after the edit commands are applied.
+///        Temperatures are changed through plock writes so stats, content hashes, and subscribers see them.
+///        Chunks the level of detail policy skips this tick stay in the active set and do not exchange heat with their neighbors,
+///        when they are next diffused every pair they are part of uses the diffusivity times the ticks it missed, up to SBX_BOX_THERMAL_MAXIMUM_DIFFUSIVITY.
+/// @param box SBXBox struct used to retrieve and store the plocks, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the thermal step function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXBoxThermalStep(SBX_box_t* box);
+
+#endif // SBX_THERMAL_H
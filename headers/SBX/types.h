@@ -14,12 +14,99 @@ typedef uint64_t                SBX_bit_flags_t;
 typedef const char*             SBX_string_t;
 typedef vec3s                   SBX_color_t;
 
+typedef struct SBXAllocator     SBX_allocator_t;
+typedef uint8_t                 SBX_memory_subsystem_t;
+
 typedef struct SBXWindow        SBX_window_t;
 typedef int                     SBX_window_dimensions_t;
 typedef int                     SBX_window_position_t;
 
 typedef struct SBXBox           SBX_box_t;
 typedef uint16_t                SBX_box_dimensions_t;
+typedef uint16_t                SBX_box_position_t;
+
+typedef uint64_t                SBX_box_tick_t;
+
+typedef struct SBXBoxCommand      SBX_box_command_t;
+typedef struct SBXBoxCommandQueue SBX_box_command_queue_t;
+typedef struct SBXBoxCommandCell  SBX_box_command_cell_t;
+typedef uint8_t                   SBX_box_command_type_t;
+
+typedef struct SBXBoxChanges       SBX_box_changes_t;
+typedef struct SBXBoxChangeTracker SBX_box_change_tracker_t;
+typedef struct SBXBoxDirtyRect     SBX_box_dirty_rect_t;
+typedef struct SBXBoxTransition    SBX_box_transition_t;
+typedef struct SBXBoxSubscription  SBX_box_subscription_t;
+typedef uint32_t                   SBX_box_subscription_id_t;
+typedef void                     (*SBX_box_change_callback_t)(SBX_box_t* box, const SBX_box_changes_t* changes, void* userData);
+
+typedef struct SBXBoxThermal      SBX_box_thermal_t;
+typedef uint8_t                   SBX_box_thermal_mode_t;
+typedef struct SBXBoxThermalChunk SBX_box_thermal_chunk_t;
+typedef struct SBXBoxLOD          SBX_box_lod_t;
+
+typedef struct SBXScenario        SBX_scenario_t;
+typedef struct SBXScenarioOptions SBX_scenario_options_t;
+typedef struct SBXScenarioResult  SBX_scenario_result_t;
+
+typedef struct SBXBoxSave       SBX_box_save_t;
+typedef struct SBXBoxStats      SBX_box_stats_t;
+
+typedef struct SBXChunk         SBX_chunk_t;
+typedef struct SBXChunkData     SBX_chunk_data_t;
+typedef struct SBXChunkBounds   SBX_chunk_bounds_t;
+typedef uint16_t                SBX_chunk_dimensions_t;
+typedef uint32_t                SBX_chunk_index_t;
+typedef uint32_t                SBX_reference_count_t;
+
+typedef struct SBXParticlePool  SBX_particle_pool_t;
+typedef uint32_t                SBX_particle_count_t;
+typedef float                   SBX_particle_scalar_t;
+
+typedef struct SBXGasField      SBX_gas_field_t;
+typedef float                   SBX_gas_scalar_t;
+
+typedef struct SBXComponentLabels SBX_component_labels_t;
+typedef struct SBXComponent     SBX_component_t;
+typedef struct SBXComponentChunk SBX_component_chunk_t;
+typedef uint32_t                SBX_component_id_t;
+typedef uint8_t                 SBX_component_class_t;
+
+typedef struct SBXColorPyramid      SBX_color_pyramid_t;
+typedef struct SBXColorPyramidChunk SBX_color_pyramid_chunk_t;
+typedef struct SBXColorPyramidView  SBX_color_pyramid_view_t;
+typedef struct SBXRenderer          SBX_renderer_t;
+typedef struct SBXCapture           SBX_capture_t;
+
+typedef struct SBXSlab          SBX_slab_t;
+typedef struct SBXSlabShared    SBX_slab_shared_t;
+typedef struct SBXSlabChannel   SBX_slab_channel_t;
+typedef struct SBXSlabMigration SBX_slab_migration_t;
+typedef struct SBXSlabQueue     SBX_slab_queue_t;
+typedef uint8_t                 SBX_slab_axis_t;
+
+typedef struct SBXWorkers       SBX_workers_t;
+typedef struct SBXWorker        SBX_worker_t;
+typedef struct SBXWorkersStats  SBX_workers_stats_t;
+
+typedef struct SBXTaskGraph     SBX_task_graph_t;
+typedef struct SBXTask          SBX_task_t;
+typedef struct SBXTaskEdge      SBX_task_edge_t;
+typedef struct SBXTaskGraphPath SBX_task_graph_path_t;
+typedef uint32_t                SBX_task_id_t;
+typedef uint8_t                 SBX_task_stage_t;
+
+typedef struct SBXFrame         SBX_frame_t;
+typedef struct SBXFrameTiming   SBX_frame_timing_t;
+
+typedef struct SBXGhostPlane    SBX_ghost_plane_t;
+
+typedef struct SBXBoxRecorder        SBX_box_recorder_t;
+typedef struct SBXBoxRecorderStats   SBX_box_recorder_stats_t;
+typedef struct SBXRecordingSpectator SBX_recording_spectator_t;
+typedef struct SBXRecordingPlayer    SBX_recording_player_t;
+
+typedef struct SBXMaterialTable SBX_material_table_t;
 
 typedef struct SBXPlockType     SBX_plock_type_t;
 typedef uint8_t                 SBX_plock_type_id_t;
@@ -37,6 +124,12 @@ typedef struct SBXPlockIDMatrix SBX_plock_id_matrix_t;
 typedef SBX_box_dimensions_t    SBX_plock_id_matrix_dimensions_t;
 
 #define SBX_MAX_PLOCK_COUNT     UINT32_MAX
+#define SBX_PLOCK_TYPE_COUNT    (UINT8_MAX + 1)
+
+#define SBX_CHUNK_SHIFT         6
+#define SBX_CHUNK_SIZE          (1 << SBX_CHUNK_SHIFT)
+#define SBX_CHUNK_MASK          (SBX_CHUNK_SIZE - 1)
+#define SBX_CHUNK_PLOCK_COUNT   (SBX_CHUNK_SIZE * SBX_CHUNK_SIZE)
 
 #define SBX_COLOR_UNSET         ((SBX_color_t){-1.0f, -1.0f, -1.0f})
 #define SBX_POINTER_UNSET       NULL
@@ -44,5 +137,7 @@ typedef SBX_box_dimensions_t    SBX_plock_id_matrix_dimensions_t;
 #define SBX_PLOCK_TYPE_ID_UNSET 0
 #define SBX_PLOCK_ID_UNSET      0
 #define SBX_TEMPERATURE_UNSET   -1000.0f
+#define SBX_COMPONENT_ID_UNSET  0
+#define SBX_COMPONENT_CLASS_NONE 0
 
 #endif // SBX_TYPES_H
@@ -0,0 +1,150 @@
+#ifndef SBX_UNCHECKED_H
+#define SBX_UNCHECKED_H
+
+// Project headers
+#include <SBX/box.h>
+#include <SBX/chunk.h>
+#include <SBX/plock.h>
+#include <SBX/strings.h>
+#include <SBX/types.h>
+#include <SBX/report.h>
+
+// LibC headers
+#include <assert.h>
+
+// Unchecked accessors, for per plock and per chunk work on a box that is known to be initialized. Arguments are only checked by assertions,
+// so out of range positions are undefined behavior once NDEBUG is defined. With SBX_UNCHECKED_API defined the validated SBXBoxGetPlock,
+// SBXBoxSetPlock, and SBXBoxGetSize calls are routed through them too, still returning a SBX_report_t but never an argument error.
+
+/// @brief Gets the index of the chunk a position is in.
+/// @param box SBXBox struct used to retrieve the chunk table size, must be initialized
+/// @param x   The x position, must be inside the box
+/// @param y   The y position, must be inside the box
+/// @return The row-major index of the chunk in the chunk table
+static inline SBX_chunk_index_t SBXBoxGetChunkIndexUnchecked(const SBX_box_t* box, SBX_box_position_t x, SBX_box_position_t y) {
+    assert((box != SBX_POINTER_UNSET) && box->initialized && (x < box->width) && (y < box->height));
+    return (SBX_chunk_index_t)(y >> SBX_CHUNK_SHIFT) * box->chunkColumns + (x >> SBX_CHUNK_SHIFT);
+}
+
+/// @brief Gets the storage of a chunk, for walking the chunk table. Storage may be shared with snapshots and other boxes, so it is only read.
+/// @param box        SBXBox struct used to retrieve the chunk, must be initialized
+/// @param chunkIndex The row-major index of the chunk, must be below chunkColumns times chunkRows
+/// @return The chunk storage, SBX_POINTER_UNSET for chunks without plocks
+static inline const SBX_chunk_data_t* SBXBoxGetChunkDataUnchecked(const SBX_box_t* box, SBX_chunk_index_t chunkIndex) {
+    assert((box != SBX_POINTER_UNSET) && box->initialized && (chunkIndex < (SBX_chunk_index_t)box->chunkColumns * box->chunkRows));
+    return box->chunks[chunkIndex].data;
+}
+
+/// @brief Gets the plock at a local position of chunk storage.
+/// @param data   The chunk storage, SBX_POINTER_UNSET reads as an empty chunk
+/// @param localX The x position in the chunk, must be below SBX_CHUNK_SIZE
+/// @param localY The y position in the chunk, must be below SBX_CHUNK_SIZE
+/// @return The plock, a SBX_PLOCK_TYPE_ID_UNSET plock at SBX_TEMPERATURE_UNSET for unset positions
+static inline SBX_plock_t SBXChunkGetPlockUnchecked(const SBX_chunk_data_t* data, SBX_box_position_t localX, SBX_box_position_t localY) {
+    assert((localX < SBX_CHUNK_SIZE) && (localY < SBX_CHUNK_SIZE));
+    SBX_plock_id_t plockID = data != SBX_POINTER_UNSET ? *SBXPlockIDMatrixAt(&data->plockIDMatrix, localX, localY) : SBX_PLOCK_ID_UNSET;
+    if(plockID == SBX_PLOCK_ID_UNSET) {
+        return (SBX_plock_t){.type = SBX_PLOCK_TYPE_ID_UNSET, .temperature = SBX_TEMPERATURE_UNSET};
+    }
+    return data->plockArray.plocks[SBX_PLOCK_ID_TO_INDEX(plockID)];
+}
+
+/// @brief Gets the plock type at a local position of chunk storage, without copying the temperature.
+/// @param data   The chunk storage, SBX_POINTER_UNSET reads as an empty chunk
+/// @param localX The x position in the chunk, must be below SBX_CHUNK_SIZE
+/// @param localY The y position in the chunk, must be below SBX_CHUNK_SIZE
+/// @return The plock type, SBX_PLOCK_TYPE_ID_UNSET for unset positions
+static inline SBX_plock_type_id_t SBXChunkGetTypeUnchecked(const SBX_chunk_data_t* data, SBX_box_position_t localX, SBX_box_position_t localY) {
+    assert((localX < SBX_CHUNK_SIZE) && (localY < SBX_CHUNK_SIZE));
+    SBX_plock_id_t plockID = data != SBX_POINTER_UNSET ? *SBXPlockIDMatrixAt(&data->plockIDMatrix, localX, localY) : SBX_PLOCK_ID_UNSET;
+    return plockID == SBX_PLOCK_ID_UNSET ? SBX_PLOCK_TYPE_ID_UNSET : data->plockArray.plocks[SBX_PLOCK_ID_TO_INDEX(plockID)].type;
+}
+
+/// @brief Gets the plock at a position, the same plock SBXBoxGetPlock gets.
+/// @param box SBXBox struct used to retrieve the plock, must be initialized
+/// @param x   The x position, must be inside the box
+/// @param y   The y position, must be inside the box
+/// @return The plock, a SBX_PLOCK_TYPE_ID_UNSET plock at SBX_TEMPERATURE_UNSET for unset positions
+static inline SBX_plock_t SBXBoxGetPlockUnchecked(const SBX_box_t* box, SBX_box_position_t x, SBX_box_position_t y) {
+    return SBXChunkGetPlockUnchecked(box->chunks[SBXBoxGetChunkIndexUnchecked(box, x, y)].data, x & SBX_CHUNK_MASK, y & SBX_CHUNK_MASK);
+}
+
+/// @brief Gets the plock type at a position.
+/// @param box SBXBox struct used to retrieve the plock, must be initialized
+/// @param x   The x position, must be inside the box
+/// @param y   The y position, must be inside the box
+/// @return The plock type, SBX_PLOCK_TYPE_ID_UNSET for unset positions
+static inline SBX_plock_type_id_t SBXBoxGetTypeUnchecked(const SBX_box_t* box, SBX_box_position_t x, SBX_box_position_t y) {
+    return SBXChunkGetTypeUnchecked(box->chunks[SBXBoxGetChunkIndexUnchecked(box, x, y)].data, x & SBX_CHUNK_MASK, y & SBX_CHUNK_MASK);
+}
+
+/// @brief Gets the plock at an offset from a position, positions outside the box read as the boundary plock like they do for the thermal pass.
+/// @param box     SBXBox struct used to retrieve the plock, must be initialized
+/// @param x       The x position, must be inside the box
+/// @param y       The y position, must be inside the box
+/// @param offsetX The x offset of the neighbor, such as -1 or 1
+/// @param offsetY The y offset of the neighbor, such as -1 or 1
+/// @return The plock of the neighbor
+static inline SBX_plock_t SBXBoxGetNeighborUnchecked(const SBX_box_t* box, SBX_box_position_t x, SBX_box_position_t y, int32_t offsetX, int32_t offsetY) {
+    assert((box != SBX_POINTER_UNSET) && box->initialized && (x < box->width) && (y < box->height));
+    int32_t neighborX = (int32_t)x + offsetX, neighborY = (int32_t)y + offsetY;
+    if((neighborX < 0) || (neighborY < 0) || (neighborX >= box->width) || (neighborY >= box->height)) {
+        return box->boundary;
+    }
+    return SBXBoxGetPlockUnchecked(box, (SBX_box_position_t)neighborX, (SBX_box_position_t)neighborY);
+}
+
+/// @brief Sets the plock at a position with the same effects as SBXBoxSetPlock, subscribers, stats, and the thermal pass included.
+/// @param box   SBXBox struct used to store the plock, must be initialized
+/// @param x     The x position, must be inside the box
+/// @param y     The y position, must be inside the box
+/// @param plock The plock to set, a SBX_PLOCK_TYPE_ID_UNSET plock unsets the position
+/// @return A SBXReport struct that reports the return state of the write, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MEMORY_FAILURE
+static inline SBX_report_t SBXBoxSetPlockUnchecked(SBX_box_t* box, SBX_box_position_t x, SBX_box_position_t y, SBX_plock_t plock) {
+    SBX_chunk_t* chunk = &box->chunks[SBXBoxGetChunkIndexUnchecked(box, x, y)];
+
+    // Unsetting a plock in an empty chunk is a no-op, so don't create storage for it
+    if((chunk->data == SBX_POINTER_UNSET) && (plock.type == SBX_PLOCK_TYPE_ID_UNSET)) {
+        return (SBX_report_t){
+            .errorFlags    = 0,
+            .reportMessage = SBX_REPORT_STRING_BOX_SET_PLOCK_SUCCESSFUL
+        };
+    }
+
+    return SBXBoxWriteChunkPlock(box, chunk, x & SBX_CHUNK_MASK, y & SBX_CHUNK_MASK, plock);
+}
+
+#if defined(SBX_UNCHECKED_API)
+    // Validated calls routed through the accessors, box.c defines the validated functions with their names in parentheses so these don't apply there
+
+    static inline SBX_report_t SBXBoxGetPlockRouted(SBX_box_t* box, SBX_box_position_t x, SBX_box_position_t y, SBX_plock_t* plock) {
+        assert(plock != SBX_POINTER_UNSET);
+        *plock = SBXBoxGetPlockUnchecked(box, x, y);
+        return (SBX_report_t){
+            .errorFlags    = 0,
+            .reportMessage = SBX_REPORT_STRING_BOX_GET_PLOCK_SUCCESSFUL
+        };
+    }
+
+    static inline SBX_report_t SBXBoxGetSizeRouted(SBX_box_t* box, SBX_box_dimensions_t* width, SBX_box_dimensions_t* height) {
+        assert((box != SBX_POINTER_UNSET) && box->initialized);
+        if(width != SBX_POINTER_UNSET) {
+            *width = box->width;
+        }
+        if(height != SBX_POINTER_UNSET) {
+            *height = box->height;
+        }
+        return (SBX_report_t){
+            .errorFlags    = 0,
+            .reportMessage = SBX_REPORT_STRING_BOX_GET_SIZE_SUCCESSFUL
+        };
+    }
+
+    // Variadic so compound literal arguments, whose commas aren't inside parentheses, pass through whole
+    #define SBXBoxGetPlock(...) SBXBoxGetPlockRouted(__VA_ARGS__)
+    #define SBXBoxSetPlock(...) SBXBoxSetPlockUnchecked(__VA_ARGS__)
+    #define SBXBoxGetSize(...)  SBXBoxGetSizeRouted(__VA_ARGS__)
+#endif
+
+#endif // SBX_UNCHECKED_H
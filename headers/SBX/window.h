@@ -2,6 +2,7 @@
 #define SBX_WINDOW_H
 
 // Project headers
+#include <SBX/allocator.h>
 #include <SBX/types.h>
 #include <SBX/report.h>
 
@@ -11,8 +12,13 @@
 
 /// @brief Structure used by SBXWindow* functions to store window and OpenGl context handles required to represent a window
 struct SBXWindow {
+    /// @brief SBX_allocator_t pointer to the allocator the window and its OpenGL context are allocated from, SBX_POINTER_UNSET for the default allocator
+    SBX_allocator_t* allocator;
+
     /// @brief SBX_bool_t object used to keep initialization state
     SBX_bool_t initialized;
+    /// @brief SBX_bool_t object used to keep whether the window was initialized by SBXWindowInitOffscreen, so it is never shown and has no usable default framebuffer
+    SBX_bool_t offscreen;
 
     /// @brief GLFWwindow* object that points to the internal window handle
     GLFWwindow*     windowHandle;
@@ -26,6 +32,13 @@ struct SBXWindow {
 ///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE
 SBX_report_t SBXWindowCreate(SBX_window_t** window);
 
+/// @brief Allocates memory for a SBXWindow object from an allocator and then sets values to a deinitialized state, the allocator must outlive the window.
+/// @param window    A pointer to a SBX_window_t pointer that will be set to the new object, cannot be SBX_POINTER_UNSET
+/// @param allocator The allocator to allocate from, SBX_POINTER_UNSET for the default allocator
+/// @return A SBXReport struct that reports the return state of the creation function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXWindowCreateWithAllocator(SBX_window_t** window, SBX_allocator_t* allocator);
+
 /// @brief Deallocates a SBXWindow objects memory after check for deinitialization
 /// @param window A SBX_window_t pointer to the desired SBXWindow to be destroyed, cannot be SBX_POINTER_UNSET
 /// @return A SBXReport struct that reports the return state of the destruction function, this can be an error, or a success.
@@ -46,6 +59,18 @@ SBX_report_t SBXWindowInit(SBX_window_t* window,
                                   SBX_window_dimensions_t width,
                                   SBX_window_dimensions_t height);
 
+/// @brief Creates a hidden window and OpenGl context handle for rendering without a display, into framebuffers such as the one of a SBXCapture.
+///        When GLFW isn't initialized yet it is initialized on its null platform, with an EGL context on Mesa's surfaceless platform or an OSMesa one,
+///        both of which run on llvmpipe without a GPU. Otherwise the window is a hidden one on the platform GLFW already runs on.
+/// @param window SBXWindow struct used to retrieve, store, and check initialization related window data, cannot be SBX_POINTER_UNSET
+/// @param width  The width of the window, cannot be SBX_DIMENSION_UNSET
+/// @param height The height of the window, cannot be SBX_DIMENSION_UNSET
+/// @return A SBXReport struct that reports the return state of the initialization function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_WINDOW_ERROR_ALREADY_INIT,
+///                                  SBX_WINDOW_ERROR_GLFW_INIT_FAILED, SBX_WINDOW_ERROR_HANDLE_INIT_FAILED,
+///                                  SBX_WINDOW_ERROR_CONTEXT_INIT_FAILED, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXWindowInitOffscreen(SBX_window_t* window, SBX_window_dimensions_t width, SBX_window_dimensions_t height);
+
 /// @brief Destroys the window and OpenGl context handles, sets initialization state, title, width, and height parameters to unset values.
 /// @param window SBXWindow struct used to retrieve, store, and check deinitialization related window data, cannot be SBX_POINTER_UNSET
 /// @return A SBXReport struct that reports the return state of the deinitialization function, this can be an error, or a success
@@ -0,0 +1,166 @@
+#ifndef SBX_WORKERS_H
+#define SBX_WORKERS_H
+
+// Project headers
+#include <SBX/types.h>
+#include <SBX/report.h>
+
+// LibC headers
+#include <stdatomic.h>
+#include <threads.h>
+
+// Most worker threads a pool can have
+#define SBX_WORKERS_MAXIMUM_THREADS 64
+// Most NUMA nodes a pool spreads its workers over, machines with more have the rest folded onto these
+#define SBX_WORKERS_MAXIMUM_NODES   16
+// Most CPUs a worker can be pinned to
+#define SBX_WORKERS_MAXIMUM_CPUS    1024
+// Items a worker claims at once from its own range or a victim's, enough to keep claims off the hot path without starving stealers
+#define SBX_WORKERS_BATCH_SIZE      4
+// Node of chunk storage whose pages could not be located
+#define SBX_WORKERS_NODE_UNKNOWN    UINT16_MAX
+
+/// @brief Function run by SBXWorkersRun for every item, on the worker thread given by worker.
+typedef void (*SBX_workers_job_t)(void* userData, uint32_t item, uint32_t worker);
+
+/// @brief Structure used by SBXWorkers* functions to report where the items of runs were processed, counted since the pool was created
+struct SBXWorkersStats {
+    /// @brief uint64_t object used to store the number of runs
+    uint64_t runs;
+    /// @brief uint64_t objects used to store the number of items processed on the node their chunk storage is on, and on another node
+    uint64_t localItems, remoteItems;
+    /// @brief uint64_t object used to store the bytes of chunk storage remote items read across nodes, counting the plocks and plock IDs of their chunk
+    uint64_t crossNodeBytes;
+    /// @brief uint64_t objects used to store the number of items workers took from a worker on their own node, and on another node
+    uint64_t sameNodeSteals, crossNodeSteals;
+    /// @brief uint64_t objects used to store the number of chunks placements checked, and the number found off their home node and copied onto it
+    uint64_t placedChunks, migratedChunks;
+};
+
+/// @brief Structure used by SBXWorkers* functions to store one worker thread, its node, and the range of the current run it owns
+struct SBXWorker {
+    /// @brief SBX_workers_t pointer to the pool the worker belongs to
+    SBX_workers_t*      workers;
+    /// @brief thrd_t object used to keep the thread handle
+    thrd_t              thread;
+    /// @brief uint32_t object used to store the index of the worker in the pool
+    uint32_t            index;
+    /// @brief uint16_t object used to store the NUMA node the worker is pinned to
+    uint16_t            node;
+    /// @brief SBX_bool_t object used to keep whether pinning the thread to the CPUs of its node worked
+    SBX_bool_t          pinned;
+    /// @brief SBX_workers_stats_t object used to count the current run, only written by the worker and added to the pool when the run ends
+    SBX_workers_stats_t stats;
+    /// @brief uint64_t array used to store the CPUs of the node of the worker as a bit set
+    uint64_t            cpus[SBX_WORKERS_MAXIMUM_CPUS / 64];
+
+    /// @brief uint32_t array used to store the workers to steal from, the ones on the same node first
+    uint32_t            victims[SBX_WORKERS_MAXIMUM_THREADS];
+    /// @brief uint32_t object used to store the number of victims
+    uint32_t            victimCount;
+
+    /// @brief uint32_t object used as the next position of the owned range in the ordered items of the current run, claimed by the worker and stealers alike.
+    ///        It is kept away from the counts the worker writes by the arrays above, so stealers claiming it do not slow the owner down
+    _Atomic uint32_t    cursor;
+    /// @brief uint32_t object used to store the position after the owned range
+    uint32_t            end;
+};
+
+/// @brief Structure used by SBXWorkers* functions to store a pool of persistent worker threads pinned to NUMA nodes.
+///        Every chunk of a box has a home worker, the chunk table is cut into one band of rows per worker, so a worker and its chunk storage
+///        stay on one node and most stencil reads across chunk borders stay there too.
+struct SBXWorkers {
+    /// @brief SBX_worker_t array used to store the workers, consecutive workers share a node
+    SBX_worker_t*       threads;
+    /// @brief uint32_t object used to store the number of workers
+    uint32_t            threadCount;
+    /// @brief uint16_t object used to store the number of NUMA nodes the workers are spread over, 1 where nodes can't be found
+    uint16_t            nodeCount;
+
+    /// @brief mtx_t and cnd_t objects used to start runs and wait for them to end
+    mtx_t               lock;
+    cnd_t               start, done;
+    /// @brief uint32_t object used to count runs, workers start a run when it changes
+    uint32_t            generation;
+    /// @brief uint32_t object used to count the workers done with the current run
+    uint32_t            finished;
+    /// @brief SBX_bool_t object used to keep whether the workers have to exit
+    SBX_bool_t          stopping;
+
+    /// @brief Current run, the box, the chunk of every item, and the function run for every item
+    SBX_box_t*               box;
+    const SBX_chunk_index_t* chunks;
+    SBX_workers_job_t        job;
+    void*                    userData;
+    /// @brief SBX_bool_t object used to keep whether workers may take items from each other in the current run, placements neither steal nor count items
+    SBX_bool_t               stealing;
+    /// @brief uint32_t array used to store the items of the current run ordered by home worker, and the number of items it has room for
+    uint32_t*           order;
+    uint32_t            orderCapacity;
+
+    /// @brief SBX_box_t pointer to the box the placement arrays describe, placing another box starts over
+    SBX_box_t*          placedBox;
+    /// @brief SBX_chunk_data_t pointer array used to keep the storage every chunk had when it was last placed, so only new storage is placed again
+    SBX_chunk_data_t**  placedData;
+    /// @brief uint16_t array used to keep the node the storage of every chunk was found on or copied to, SBX_WORKERS_NODE_UNKNOWN if it was not found
+    uint16_t*           chunkNodes;
+    /// @brief SBX_chunk_index_t array used as scratch space for the chunks a placement checks
+    SBX_chunk_index_t*  placeChunks;
+    /// @brief SBX_chunk_index_t object used to keep the number of chunks the placement arrays have room for
+    SBX_chunk_index_t   chunkCapacity;
+
+    /// @brief SBX_workers_stats_t object used to store the counts of every run so far
+    SBX_workers_stats_t stats;
+};
+
+/// @brief Allocates a SBXWorkers pool and starts its threads, spread evenly over the NUMA nodes of the machine and pinned to the CPUs of their node.
+///        Nodes are read from /sys/devices/system/node on Linux, elsewhere the workers share one node and are not pinned.
+///        The memory is accounted to SBX_MEMORY_SUBSYSTEM_WORKERS of the default allocator.
+/// @param workers     A pointer to a SBX_workers_t pointer that will be set to the new object, cannot be SBX_POINTER_UNSET
+/// @param threadCount The number of worker threads, from 1 to SBX_WORKERS_MAXIMUM_THREADS
+/// @return A SBXReport struct that reports the return state of the creation function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE, SBX_COMMON_ERROR_THREAD_FAILURE
+SBX_report_t SBXWorkersCreate(SBX_workers_t** workers, uint32_t threadCount);
+
+/// @brief Stops the threads of a SBXWorkers pool and deallocates its memory, no box may still use the pool.
+/// @param workers A SBX_workers_t pointer to the desired SBXWorkers to be destroyed, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the destruction function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXWorkersDestroy(SBX_workers_t* workers);
+
+/// @brief Sets the pool the per chunk passes of SBXBoxStep run on, every step then first places new chunk storage on its home node.
+/// @param box     SBXBox struct used to store the pool, cannot be SBX_POINTER_UNSET
+/// @param workers The pool to use, SBX_POINTER_UNSET to run the passes on the stepping thread
+/// @return A SBXReport struct that reports the return state of the setting function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXBoxSetWorkers(SBX_box_t* box, SBX_workers_t* workers);
+
+/// @brief Makes the storage of every chunk of a box live on the node of its home worker. Storage is checked on its home worker once, when it first appears,
+///        and storage found on another node that no snapshot shares is copied by the home worker, whose writes fault the copy in on its own node.
+///        Storage from an arena allocator is placed wherever the arena was first touched, so such boxes should not be prefaulted from one thread.
+/// @param workers SBXWorkers struct used to run the placement, cannot be SBX_POINTER_UNSET
+/// @param box     SBXBox struct used to retrieve and store the chunk storage, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the placement function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_BOX_ERROR_NOT_INIT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXWorkersPlace(SBX_workers_t* workers, SBX_box_t* box);
+
+/// @brief Runs a job for every item on the workers and waits for it to end. Every worker first takes the items whose chunk it is home to,
+///        then takes items from the other workers, workers on its own node first. The job must only write what belongs to its item.
+/// @param workers   SBXWorkers struct used to run the job, cannot be SBX_POINTER_UNSET
+/// @param box       SBXBox struct whose chunk table the chunks index, cannot be SBX_POINTER_UNSET
+/// @param chunks    SBX_chunk_index_t array of the chunk every item works on, cannot be SBX_POINTER_UNSET unless itemCount is 0
+/// @param itemCount The number of items
+/// @param job       The function to run for every item, cannot be SBX_POINTER_UNSET
+/// @param userData  Pointer passed to the job untouched
+/// @return A SBXReport struct that reports the return state of the run function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT, SBX_COMMON_ERROR_MEMORY_FAILURE
+SBX_report_t SBXWorkersRun(SBX_workers_t* workers, SBX_box_t* box, const SBX_chunk_index_t* chunks, uint32_t itemCount, SBX_workers_job_t job, void* userData);
+
+/// @brief Gets the counts of every run of a pool so far.
+/// @param workers SBXWorkers struct used to retrieve the counts, cannot be SBX_POINTER_UNSET
+/// @param stats   A pointer to a SBX_workers_stats_t variable to store the counts in, cannot be SBX_POINTER_UNSET
+/// @return A SBXReport struct that reports the return state of the query function, this can be an error, or a success.
+///         Possible errors include: SBX_COMMON_ERROR_MISSING_ARGUMENT
+SBX_report_t SBXWorkersGetStats(SBX_workers_t* workers, SBX_workers_stats_t* stats);
+
+#endif // SBX_WORKERS_H
@@ -0,0 +1,685 @@
+// mmap, madvise, and their huge page flags are extensions on top of C17
+#if defined(__linux__)
+    #define _GNU_SOURCE
+#endif
+
+// Project headers
+#include <SBX/allocator.h>
+#include <SBX/strings.h>
+
+// LibC headers
+#include <stdlib.h>
+#include <string.h>
+
+// Platform headers
+#if defined(__unix__) || defined(__APPLE__)
+    #define SBX_ALLOCATOR_MMAP
+    #include <sys/mman.h>
+#endif
+
+// Granularity the prefault thread touches pages at when the kernel can't populate them for it
+#define SBX_ALLOCATOR_PAGE_SIZE ((size_t)4096)
+
+// Rounds a size up so every arena and pool allocation stays aligned for any type
+#define SBX_ALLOCATOR_ALIGN(size) (((size) + _Alignof(max_align_t) - 1) & ~(_Alignof(max_align_t) - 1))
+
+// Allocation function of the default allocator and of allocators created without a callback
+static void* SBXAllocatorDefaultCallback(void* userData, void* pointer, size_t oldSize, size_t newSize) {
+    (void)userData;
+    (void)oldSize;
+
+    if(!newSize) {
+        free(pointer);
+        return SBX_POINTER_UNSET;
+    }
+    return realloc(pointer, newSize);
+}
+
+// Finds the free list of an aligned size, claiming an unused size class if claim is set, SBX_POINTER_UNSET if there is none
+static void** SBXAllocatorArenaFreeList(SBX_allocator_t* allocator, size_t size, SBX_bool_t claim) {
+    // Size classes are claimed in order, so nothing past the first unused one can match
+    for(uint32_t i = 0; i < SBX_ALLOCATOR_SIZE_CLASS_COUNT; i++) {
+        if(allocator->arenaClassSizes[i] == size) {
+            return &allocator->arenaClassFreeLists[i];
+        }
+        if(!allocator->arenaClassSizes[i]) {
+            if(!claim) {
+                return SBX_POINTER_UNSET;
+            }
+            allocator->arenaClassSizes[i] = size;
+            return &allocator->arenaClassFreeLists[i];
+        }
+    }
+    return SBX_POINTER_UNSET;
+}
+
+// Hands out size aligned bytes from the free list of their size, or from the top of the arena, must hold the lock
+static void* SBXAllocatorArenaTake(SBX_allocator_t* allocator, size_t size) {
+    void** freeList = SBXAllocatorArenaFreeList(allocator, size, false);
+    if((freeList != SBX_POINTER_UNSET) && (*freeList != SBX_POINTER_UNSET)) {
+        void* result = *freeList;
+        *freeList = *(void**)result;
+        return result;
+    }
+
+    if(allocator->arenaUsed + size > allocator->arenaSize) {
+        return SBX_POINTER_UNSET;
+    }
+    void* result = allocator->arena + allocator->arenaUsed;
+    allocator->arenaUsed += size;
+    return result;
+}
+
+// Gives size aligned bytes back, lowering the top if they were the last allocation and keeping them for their size otherwise, must hold the lock
+static void SBXAllocatorArenaGive(SBX_allocator_t* allocator, void* pointer, size_t size) {
+    if((uint8_t*)pointer + size == allocator->arena + allocator->arenaUsed) {
+        allocator->arenaUsed -= size;
+        return;
+    }
+
+    // Memory of a size without a size class stays unused until the allocator is destroyed
+    void** freeList = SBXAllocatorArenaFreeList(allocator, size, true);
+    if(freeList != SBX_POINTER_UNSET) {
+        *(void**)pointer = *freeList;
+        *freeList        = pointer;
+    }
+}
+
+// Allocation function of arena and mapped allocators
+static void* SBXAllocatorArenaCallback(void* userData, void* pointer, size_t oldSize, size_t newSize) {
+    SBX_allocator_t* allocator = userData;
+    if(newSize > allocator->arenaSize) {
+        return SBX_POINTER_UNSET;
+    }
+
+    size_t oldAligned = SBX_ALLOCATOR_ALIGN(oldSize);
+    size_t newAligned = SBX_ALLOCATOR_ALIGN(newSize);
+
+    mtx_lock(&allocator->lock);
+
+    void* result = SBX_POINTER_UNSET;
+    if(!newSize) {
+        SBXAllocatorArenaGive(allocator, pointer, oldAligned);
+    }
+    else if((pointer != SBX_POINTER_UNSET) && (oldAligned == newAligned)) {
+        result = pointer;
+    }
+    // The top allocation can grow and shrink in place
+    else if((pointer != SBX_POINTER_UNSET) && ((uint8_t*)pointer + oldAligned == allocator->arena + allocator->arenaUsed) &&
+            (allocator->arenaUsed - oldAligned + newAligned <= allocator->arenaSize)) {
+        allocator->arenaUsed = allocator->arenaUsed - oldAligned + newAligned;
+        result = pointer;
+    }
+    else {
+        result = SBXAllocatorArenaTake(allocator, newAligned);
+        if((result != SBX_POINTER_UNSET) && (pointer != SBX_POINTER_UNSET)) {
+            memcpy(result, pointer, oldSize < newSize ? oldSize : newSize);
+            SBXAllocatorArenaGive(allocator, pointer, oldAligned);
+        }
+    }
+
+    mtx_unlock(&allocator->lock);
+    return result;
+}
+
+// Prefault thread entry, faults the arena in one huge page at a time from the start so the first chunks get there first
+static int SBXAllocatorPrefaultThread(void* argument) {
+    SBX_allocator_t* allocator = argument;
+
+    for(size_t offset = 0; (offset < allocator->arenaSize) && !atomic_load_explicit(&allocator->prefaultStop, memory_order_relaxed);
+        offset += SBX_ALLOCATOR_HUGE_PAGE_SIZE) {
+        size_t length = allocator->arenaSize - offset < SBX_ALLOCATOR_HUGE_PAGE_SIZE ? allocator->arenaSize - offset : SBX_ALLOCATOR_HUGE_PAGE_SIZE;
+
+#if defined(MADV_POPULATE_WRITE)
+        // Let the kernel populate the pages without touching their contents, this is safe on memory already handed out
+        if(!madvise(allocator->arena + offset, length, MADV_POPULATE_WRITE)) {
+            atomic_store_explicit(&allocator->prefaulted, offset + length, memory_order_relaxed);
+            continue;
+        }
+#endif
+
+        // Otherwise write to every page not handed out yet, pages already handed out got faulted in by their user
+        for(size_t page = offset; page < offset + length; page += SBX_ALLOCATOR_PAGE_SIZE) {
+            mtx_lock(&allocator->lock);
+            if(page >= allocator->arenaUsed) {
+                allocator->arena[page] = 0;
+            }
+            mtx_unlock(&allocator->lock);
+        }
+        atomic_store_explicit(&allocator->prefaulted, offset + length, memory_order_relaxed);
+    }
+
+    return 0;
+}
+
+// Maps size bytes for an arena, on huge pages if asked to and the platform has them, SBX_POINTER_UNSET on failure
+static uint8_t* SBXAllocatorMapArena(size_t size, SBX_bit_flags_t flags) {
+#if defined(SBX_ALLOCATOR_MMAP)
+    #if defined(MAP_HUGETLB)
+    // Explicit huge pages only work while the reserved pool has room, otherwise fall through to a normal mapping
+    if(flags & SBX_ALLOCATOR_FLAG_EXPLICIT_HUGE_PAGES) {
+        void* arena = mmap(SBX_POINTER_UNSET, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if(arena != MAP_FAILED) {
+            return arena;
+        }
+        flags |= SBX_ALLOCATOR_FLAG_HUGE_PAGES;
+    }
+    #endif
+
+    // Over-map by a huge page so the arena can start on a huge page boundary, transparent huge pages only back aligned ranges
+    size_t   mappedSize = size + SBX_ALLOCATOR_HUGE_PAGE_SIZE;
+    uint8_t* mapping    = mmap(SBX_POINTER_UNSET, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if((void*)mapping == MAP_FAILED) {
+        return SBX_POINTER_UNSET;
+    }
+
+    // Give back the unaligned head and the tail past the arena
+    uint8_t* arena = (uint8_t*)(((uintptr_t)mapping + SBX_ALLOCATOR_HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(SBX_ALLOCATOR_HUGE_PAGE_SIZE - 1));
+    if(arena > mapping) {
+        munmap(mapping, (size_t)(arena - mapping));
+    }
+    if(mapping + mappedSize > arena + size) {
+        munmap(arena + size, (size_t)(mapping + mappedSize - (arena + size)));
+    }
+
+    #if defined(MADV_HUGEPAGE)
+    if(flags & SBX_ALLOCATOR_FLAG_HUGE_PAGES) {
+        madvise(arena, size, MADV_HUGEPAGE);
+    }
+    #endif
+
+    return arena;
+#else
+    (void)flags;
+    return malloc(size);
+#endif
+}
+
+// Gives an arena back to where it came from
+static void SBXAllocatorUnmapArena(SBX_allocator_t* allocator) {
+#if defined(SBX_ALLOCATOR_MMAP)
+    if(allocator->arenaMapped) {
+        munmap(allocator->arena, allocator->arenaSize);
+        return;
+    }
+#endif
+    free(allocator->arena);
+}
+
+// Gives a block back to the free list of a pool allocator, or to free if it came from malloc
+static void SBXAllocatorPoolRelease(SBX_allocator_t* allocator, void* pointer) {
+    uint8_t* block = pointer;
+    if((block < allocator->pool) || (block >= allocator->pool + allocator->poolBlockSize * allocator->poolBlockCount)) {
+        free(pointer);
+        return;
+    }
+
+    mtx_lock(&allocator->lock);
+    *(void**)block          = allocator->poolFreeList;
+    allocator->poolFreeList = block;
+    mtx_unlock(&allocator->lock);
+}
+
+// Allocation function of pool allocators, allocations that fit a block come from the free list and the rest from malloc
+static void* SBXAllocatorPoolCallback(void* userData, void* pointer, size_t oldSize, size_t newSize) {
+    SBX_allocator_t* allocator = userData;
+    uint8_t* block  = pointer;
+    SBX_bool_t pooled = (block >= allocator->pool) && (block < allocator->pool + allocator->poolBlockSize * allocator->poolBlockCount);
+
+    if(!newSize) {
+        if(pointer != SBX_POINTER_UNSET) {
+            SBXAllocatorPoolRelease(allocator, pointer);
+        }
+        return SBX_POINTER_UNSET;
+    }
+
+    // Blocks can shrink and grow up to the block size in place
+    if(pooled && (newSize <= allocator->poolBlockSize)) {
+        return pointer;
+    }
+
+    void* result = SBX_POINTER_UNSET;
+    if(newSize <= allocator->poolBlockSize) {
+        mtx_lock(&allocator->lock);
+        result = allocator->poolFreeList;
+        if(result != SBX_POINTER_UNSET) {
+            allocator->poolFreeList = *(void**)result;
+        }
+        mtx_unlock(&allocator->lock);
+    }
+
+    // Fall back to malloc when the pool is out of blocks or the allocation is bigger than a block
+    if(result == SBX_POINTER_UNSET) {
+        if((pointer != SBX_POINTER_UNSET) && !pooled) {
+            return realloc(pointer, newSize);
+        }
+        result = malloc(newSize);
+        if(result == SBX_POINTER_UNSET) {
+            return SBX_POINTER_UNSET;
+        }
+    }
+
+    if(pointer != SBX_POINTER_UNSET) {
+        memcpy(result, pointer, oldSize < newSize ? oldSize : newSize);
+        SBXAllocatorPoolRelease(allocator, pointer);
+    }
+    return result;
+}
+
+// Allocator used whenever SBX_POINTER_UNSET is passed as an allocator
+static SBX_allocator_t SBXDefaultAllocator = {.callback = SBXAllocatorDefaultCallback};
+
+// Counts bytes against the budget, failing without counting them if the budget would be exceeded
+static SBX_bool_t SBXAllocatorReserve(SBX_allocator_t* allocator, size_t size) {
+    size_t total = atomic_fetch_add_explicit(&allocator->totalBytes, size, memory_order_relaxed) + size;
+    if(allocator->budget && (total > allocator->budget)) {
+        atomic_fetch_sub_explicit(&allocator->totalBytes, size, memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+// Allocates and sets up the counters of a SBXAllocator object
+static SBX_report_t SBXAllocatorCreateCommon(SBX_allocator_t** allocator, size_t budget) {
+    // Allocate memory for the SBXAllocator struture
+    *allocator = malloc(sizeof(SBX_allocator_t));
+
+    // Check for a memory allocation error
+    if(!*allocator) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    // Set SBXAllocator members to a callback allocator with nothing allocated
+    (*allocator)->callback       = SBXAllocatorDefaultCallback;
+    (*allocator)->userData       = SBX_POINTER_UNSET;
+    (*allocator)->budget         = budget;
+    atomic_init(&(*allocator)->totalBytes, 0);
+    for(SBX_memory_subsystem_t i = 0; i < SBX_MEMORY_SUBSYSTEM_COUNT; i++) {
+        atomic_init(&(*allocator)->bytes[i], 0);
+        atomic_init(&(*allocator)->allocations[i], 0);
+    }
+    (*allocator)->arena          = SBX_POINTER_UNSET;
+    (*allocator)->arenaSize      = 0;
+    (*allocator)->arenaUsed      = 0;
+    (*allocator)->arenaMapped    = false;
+    for(uint32_t i = 0; i < SBX_ALLOCATOR_SIZE_CLASS_COUNT; i++) {
+        (*allocator)->arenaClassSizes[i]     = 0;
+        (*allocator)->arenaClassFreeLists[i] = SBX_POINTER_UNSET;
+    }
+    (*allocator)->pool           = SBX_POINTER_UNSET;
+    (*allocator)->poolFreeList   = SBX_POINTER_UNSET;
+    (*allocator)->poolBlockSize  = 0;
+    (*allocator)->poolBlockCount = 0;
+    (*allocator)->prefaulting    = false;
+    atomic_init(&(*allocator)->prefaultStop, false);
+    atomic_init(&(*allocator)->prefaulted, 0);
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMMON_CREATION_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXAllocatorCreate(SBX_allocator_t** allocator, SBX_allocator_callback_t callback, void* userData, size_t budget) {
+    // Check if required arguments are provided
+    if(allocator == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    SBX_report_t report = SBXAllocatorCreateCommon(allocator, budget);
+    if(report.errorFlags) {
+        return report;
+    }
+
+    if(callback != SBX_POINTER_UNSET) {
+        (*allocator)->callback = callback;
+        (*allocator)->userData = userData;
+    }
+
+    return report;
+}
+
+SBX_report_t SBXAllocatorCreateArena(SBX_allocator_t** allocator, size_t size, size_t budget) {
+    // Check if required arguments are provided
+    if((allocator == SBX_POINTER_UNSET) || !size) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    SBX_report_t report = SBXAllocatorCreateCommon(allocator, budget);
+    if(report.errorFlags) {
+        return report;
+    }
+
+    // Allocate the arena
+    (*allocator)->arena = malloc(size);
+
+    // Check for a memory allocation error
+    if((*allocator)->arena == SBX_POINTER_UNSET) {
+        free(*allocator);
+        *allocator = SBX_POINTER_UNSET;
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    // Check for a mutex creation error
+    if(mtx_init(&(*allocator)->lock, mtx_plain) != thrd_success) {
+        free((*allocator)->arena);
+        free(*allocator);
+        *allocator = SBX_POINTER_UNSET;
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_THREAD_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_THREAD_FAILURE
+        };
+    }
+
+    (*allocator)->arenaSize = size;
+    (*allocator)->callback  = SBXAllocatorArenaCallback;
+    (*allocator)->userData  = *allocator;
+
+    return report;
+}
+
+SBX_report_t SBXAllocatorCreateMapped(SBX_allocator_t** allocator, size_t size, SBX_bit_flags_t flags, size_t budget) {
+    // Check if required arguments are provided
+    if((allocator == SBX_POINTER_UNSET) || !size) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    SBX_report_t report = SBXAllocatorCreateCommon(allocator, budget);
+    if(report.errorFlags) {
+        return report;
+    }
+
+    // Map the arena in whole huge pages
+    size = (size + SBX_ALLOCATOR_HUGE_PAGE_SIZE - 1) & ~(SBX_ALLOCATOR_HUGE_PAGE_SIZE - 1);
+    (*allocator)->arena = SBXAllocatorMapArena(size, flags);
+
+    // Check for a memory allocation error
+    if((*allocator)->arena == SBX_POINTER_UNSET) {
+        free(*allocator);
+        *allocator = SBX_POINTER_UNSET;
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+#if defined(SBX_ALLOCATOR_MMAP)
+    (*allocator)->arenaMapped = true;
+#endif
+    (*allocator)->arenaSize   = size;
+
+    // Check for a mutex or prefault thread creation error
+    SBX_bool_t threadFailed = mtx_init(&(*allocator)->lock, mtx_plain) != thrd_success;
+    if(!threadFailed && (flags & SBX_ALLOCATOR_FLAG_PREFAULT)) {
+        threadFailed = thrd_create(&(*allocator)->prefaultThread, SBXAllocatorPrefaultThread, *allocator) != thrd_success;
+        if(threadFailed) {
+            mtx_destroy(&(*allocator)->lock);
+        }
+        (*allocator)->prefaulting = !threadFailed;
+    }
+    if(threadFailed) {
+        SBXAllocatorUnmapArena(*allocator);
+        free(*allocator);
+        *allocator = SBX_POINTER_UNSET;
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_THREAD_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_THREAD_FAILURE
+        };
+    }
+
+    (*allocator)->callback = SBXAllocatorArenaCallback;
+    (*allocator)->userData = *allocator;
+
+    return report;
+}
+
+SBX_report_t SBXAllocatorCreatePool(SBX_allocator_t** allocator, size_t blockSize, size_t blockCount, size_t budget) {
+    // Check if required arguments are provided
+    if((allocator == SBX_POINTER_UNSET) || !blockSize || !blockCount) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    SBX_report_t report = SBXAllocatorCreateCommon(allocator, budget);
+    if(report.errorFlags) {
+        return report;
+    }
+
+    // Blocks hold the free list link while free and must keep allocations aligned
+    blockSize = SBX_ALLOCATOR_ALIGN(blockSize < sizeof(void*) ? sizeof(void*) : blockSize);
+
+    // Allocate the blocks
+    (*allocator)->pool = malloc(blockSize * blockCount);
+
+    // Check for a memory allocation error
+    if((*allocator)->pool == SBX_POINTER_UNSET) {
+        free(*allocator);
+        *allocator = SBX_POINTER_UNSET;
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    // Check for a mutex creation error
+    if(mtx_init(&(*allocator)->lock, mtx_plain) != thrd_success) {
+        free((*allocator)->pool);
+        free(*allocator);
+        *allocator = SBX_POINTER_UNSET;
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_THREAD_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_THREAD_FAILURE
+        };
+    }
+
+    // Thread every block onto the free list, lowest address first
+    for(size_t i = blockCount; i > 0; i--) {
+        void* block = (*allocator)->pool + blockSize * (i - 1);
+        *(void**)block = (*allocator)->poolFreeList;
+        (*allocator)->poolFreeList = block;
+    }
+
+    (*allocator)->poolBlockSize  = blockSize;
+    (*allocator)->poolBlockCount = blockCount;
+    (*allocator)->callback       = SBXAllocatorPoolCallback;
+    (*allocator)->userData       = *allocator;
+
+    return report;
+}
+
+SBX_report_t SBXAllocatorDestroy(SBX_allocator_t* allocator) {
+    // Check if required arguments are provided, the default allocator can't be destroyed
+    if((allocator == SBX_POINTER_UNSET) || (allocator == &SBXDefaultAllocator)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Stop the prefault thread before the arena goes away
+    if(allocator->prefaulting) {
+        atomic_store_explicit(&allocator->prefaultStop, true, memory_order_relaxed);
+        thrd_join(allocator->prefaultThread, SBX_POINTER_UNSET);
+    }
+
+    if((allocator->arena != SBX_POINTER_UNSET) || (allocator->pool != SBX_POINTER_UNSET)) {
+        mtx_destroy(&allocator->lock);
+    }
+    if(allocator->arena != SBX_POINTER_UNSET) {
+        SBXAllocatorUnmapArena(allocator);
+    }
+    free(allocator->pool);
+    free(allocator);
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMMON_DESTRUCTION_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXAllocatorGetPrefaultProgress(SBX_allocator_t* allocator, size_t* prefaulted) {
+    // Check if required arguments are provided
+    if((allocator == SBX_POINTER_UNSET) || (prefaulted == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    *prefaulted = atomic_load_explicit(&allocator->prefaulted, memory_order_relaxed);
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_ALLOCATOR_GET_PREFAULT_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXAllocatorGetDefault(SBX_allocator_t** allocator) {
+    // Check if required arguments are provided
+    if(allocator == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    *allocator = &SBXDefaultAllocator;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_ALLOCATOR_GET_DEFAULT_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXAllocatorGetUsage(SBX_allocator_t* allocator, SBX_memory_subsystem_t subsystem, size_t* bytes, size_t* allocations) {
+    // Check if required arguments are provided
+    if(subsystem > SBX_MEMORY_SUBSYSTEM_COUNT) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    if(allocator == SBX_POINTER_UNSET) {
+        allocator = &SBXDefaultAllocator;
+    }
+
+    // SBX_MEMORY_SUBSYSTEM_COUNT sums every subsystem
+    size_t totalBytes = 0, totalAllocations = 0;
+    for(SBX_memory_subsystem_t i = 0; i < SBX_MEMORY_SUBSYSTEM_COUNT; i++) {
+        if((subsystem == i) || (subsystem == SBX_MEMORY_SUBSYSTEM_COUNT)) {
+            totalBytes       += atomic_load_explicit(&allocator->bytes[i], memory_order_relaxed);
+            totalAllocations += atomic_load_explicit(&allocator->allocations[i], memory_order_relaxed);
+        }
+    }
+
+    if(bytes != SBX_POINTER_UNSET) {
+        *bytes = totalBytes;
+    }
+    if(allocations != SBX_POINTER_UNSET) {
+        *allocations = totalAllocations;
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_ALLOCATOR_GET_USAGE_SUCCESSFUL
+    };
+}
+
+void* SBXAllocatorAllocate(SBX_allocator_t* allocator, SBX_memory_subsystem_t subsystem, size_t size) {
+    if(allocator == SBX_POINTER_UNSET) {
+        allocator = &SBXDefaultAllocator;
+    }
+    if(!size || !SBXAllocatorReserve(allocator, size)) {
+        return SBX_POINTER_UNSET;
+    }
+
+    void* pointer = allocator->callback(allocator->userData, SBX_POINTER_UNSET, 0, size);
+    if(pointer == SBX_POINTER_UNSET) {
+        atomic_fetch_sub_explicit(&allocator->totalBytes, size, memory_order_relaxed);
+        return SBX_POINTER_UNSET;
+    }
+
+    atomic_fetch_add_explicit(&allocator->bytes[subsystem], size, memory_order_relaxed);
+    atomic_fetch_add_explicit(&allocator->allocations[subsystem], 1, memory_order_relaxed);
+    return pointer;
+}
+
+void* SBXAllocatorReallocate(SBX_allocator_t* allocator, SBX_memory_subsystem_t subsystem, void* pointer, size_t oldSize, size_t newSize) {
+    if(pointer == SBX_POINTER_UNSET) {
+        return SBXAllocatorAllocate(allocator, subsystem, newSize);
+    }
+    if(allocator == SBX_POINTER_UNSET) {
+        allocator = &SBXDefaultAllocator;
+    }
+
+    // Only growth counts against the budget
+    size_t growth = newSize > oldSize ? newSize - oldSize : 0;
+    if(!newSize || !SBXAllocatorReserve(allocator, growth)) {
+        return SBX_POINTER_UNSET;
+    }
+
+    void* newPointer = allocator->callback(allocator->userData, pointer, oldSize, newSize);
+    if(newPointer == SBX_POINTER_UNSET) {
+        atomic_fetch_sub_explicit(&allocator->totalBytes, growth, memory_order_relaxed);
+        return SBX_POINTER_UNSET;
+    }
+
+    if(newSize < oldSize) {
+        atomic_fetch_sub_explicit(&allocator->totalBytes, oldSize - newSize, memory_order_relaxed);
+    }
+    atomic_fetch_add_explicit(&allocator->bytes[subsystem], newSize, memory_order_relaxed);
+    atomic_fetch_sub_explicit(&allocator->bytes[subsystem], oldSize, memory_order_relaxed);
+    return newPointer;
+}
+
+void SBXAllocatorFree(SBX_allocator_t* allocator, SBX_memory_subsystem_t subsystem, void* pointer, size_t size) {
+    if(pointer == SBX_POINTER_UNSET) {
+        return;
+    }
+    if(allocator == SBX_POINTER_UNSET) {
+        allocator = &SBXDefaultAllocator;
+    }
+
+    allocator->callback(allocator->userData, pointer, size, 0);
+
+    atomic_fetch_sub_explicit(&allocator->totalBytes, size, memory_order_relaxed);
+    atomic_fetch_sub_explicit(&allocator->bytes[subsystem], size, memory_order_relaxed);
+    atomic_fetch_sub_explicit(&allocator->allocations[subsystem], 1, memory_order_relaxed);
+}
@@ -2,13 +2,22 @@
 #include <SBX/box.h>
 #include <SBX/strings.h>
 #include <SBX/plock.h>
+#include <SBX/chunk.h>
 
 // LibC headers
 #include <stdlib.h>
 #include <string.h>
 
+// SBXBoxGetSize, SBXBoxGetPlock, and SBXBoxSetPlock are defined with their names in parentheses, so with SBX_UNCHECKED_API
+// the macros routing calls to the unchecked accessors don't replace the validated functions themselves
+
 // Box creation function
 SBX_report_t SBXBoxCreate(SBX_box_t** box) {
+    return SBXBoxCreateWithAllocator(box, SBX_POINTER_UNSET);
+}
+
+// Box creation function with an allocator
+SBX_report_t SBXBoxCreateWithAllocator(SBX_box_t** box, SBX_allocator_t* allocator) {
     // Check if required arguments are provided
     if(box == SBX_POINTER_UNSET) {
         // Return error
@@ -19,7 +28,7 @@ SBX_report_t SBXBoxCreate(SBX_box_t** box) {
     }
 
     // Allocate memory for the SBXBox struture
-    *box = malloc(sizeof(SBX_box_t));
+    *box = SBXAllocatorAllocate(allocator, SBX_MEMORY_SUBSYSTEM_BOX, sizeof(SBX_box_t));
 
     // Check for a memory allocation error
     if(!*box) {
@@ -31,11 +40,27 @@ SBX_report_t SBXBoxCreate(SBX_box_t** box) {
     }
 
     // Set SBXBox members to values a deinitialized state
-    (*box)->initialized   = false;
-    (*box)->width         = SBX_DIMENSION_UNSET;
-    (*box)->height        = SBX_DIMENSION_UNSET;
-    (*box)->plockArray    = (SBX_plock_array_t){.plocks = NULL, .count = 0};
-    (*box)->plockIDMatrix = (SBX_plock_id_matrix_t){.plockIDs = NULL, .width = SBX_DIMENSION_UNSET, .height = SBX_DIMENSION_UNSET};
+    (*box)->allocator        = allocator;
+    (*box)->initialized      = false;
+    (*box)->width            = SBX_DIMENSION_UNSET;
+    (*box)->height           = SBX_DIMENSION_UNSET;
+    (*box)->chunkColumns     = 0;
+    (*box)->chunkRows        = 0;
+    (*box)->chunks           = NULL;
+    (*box)->defragmentCursor = 0;
+    memset((*box)->plockTypeCounts, 0, sizeof((*box)->plockTypeCounts));
+    (*box)->tick                 = 0;
+    (*box)->commandBatch         = NULL;
+    (*box)->commandBatchCapacity = 0;
+    (*box)->commandCells         = NULL;
+    (*box)->commandCellCapacity  = 0;
+    (*box)->commandGeneration    = 0;
+    (*box)->boundary             = (SBX_plock_t){.type = SBX_PLOCK_TYPE_ID_UNSET, .temperature = SBX_TEMPERATURE_UNSET};
+    SBXBoxCommandQueueInit(&(*box)->commandQueue, allocator);
+    SBXBoxChangeTrackerInit(&(*box)->changes, allocator);
+    SBXBoxThermalInit(&(*box)->thermal, allocator);
+    SBXBoxLODInit(&(*box)->lod);
+    (*box)->workers = SBX_POINTER_UNSET;
 
     return (SBX_report_t){
         .errorFlags    = 0,
@@ -62,7 +87,15 @@ SBX_report_t SBXBoxDestroy(SBX_box_t* box) {
         };
     }
 
-    free(box);
+    // Free commands that were never applied, the spare queue nodes, and the coalescing scratch space
+    SBXBoxDiscardCommands(box);
+    SBXBoxCommandQueueDeinit(&box->commandQueue);
+    SBXAllocatorFree(box->allocator, SBX_MEMORY_SUBSYSTEM_COMMAND, box->commandBatch, sizeof(SBX_box_command_t*) * box->commandBatchCapacity);
+    SBXAllocatorFree(box->allocator, SBX_MEMORY_SUBSYSTEM_COMMAND, box->commandCells, sizeof(SBX_box_command_cell_t) * box->commandCellCapacity);
+    SBXBoxChangeTrackerDeinit(&box->changes);
+    SBXBoxThermalDeinit(&box->thermal);
+
+    SBXAllocatorFree(box->allocator, SBX_MEMORY_SUBSYSTEM_BOX, box, sizeof(SBX_box_t));
 
     return (SBX_report_t){
         .errorFlags    = 0,
@@ -70,6 +103,199 @@ SBX_report_t SBXBoxDestroy(SBX_box_t* box) {
     };
 }
 
+// Adds a plock about to be set at position to the box and chunk stats
+static void SBXBoxCountPlock(SBX_box_t* box, SBX_chunk_data_t* data, SBX_plock_count_t position, SBX_plock_t* plock) {
+    box->plockTypeCounts[plock->type]++;
+    data->contentHash += SBXChunkHashPlock(position, plock);
+    data->typeHash    += SBXChunkHashPlockType(position, plock->type);
+
+    data->thermalEnergy += plock->temperature;
+    data->plockCount++;
+}
+
+// Removes a plock at position about to be overwritten or unset from the box and chunk stats
+static void SBXBoxUncountPlock(SBX_box_t* box, SBX_chunk_data_t* data, SBX_plock_count_t position, SBX_plock_t* plock) {
+    box->plockTypeCounts[plock->type]--;
+    data->contentHash -= SBXChunkHashPlock(position, plock);
+    data->typeHash    -= SBXChunkHashPlockType(position, plock->type);
+
+    data->thermalEnergy -= plock->temperature;
+    data->plockCount--;
+}
+
+// Removes every plock of a chunk leaving the box from the box plock type counts, and reports them as unset to subscribers
+static void SBXBoxUncountChunk(SBX_box_t* box, SBX_chunk_index_t chunkIndex, SBX_chunk_data_t* data) {
+    for(SBX_box_position_t localY = 0; localY < SBX_CHUNK_SIZE; localY++) {
+        for(SBX_box_position_t localX = 0; localX < SBX_CHUNK_SIZE; localX++) {
+            SBX_plock_id_t plockID = *SBXPlockIDMatrixAt(&data->plockIDMatrix, localX, localY);
+            if(plockID != SBX_PLOCK_ID_UNSET) {
+                SBX_plock_type_id_t type = data->plockArray.plocks[SBX_PLOCK_ID_TO_INDEX(plockID)].type;
+                box->plockTypeCounts[type]--;
+                SBXBoxTrackChange(box, chunkIndex, localX, localY, type, SBX_PLOCK_TYPE_ID_UNSET);
+            }
+        }
+    }
+}
+
+// Writes a plock into a writable chunk, acquiring or releasing its plock ID as needed
+SBX_report_t SBXBoxWriteChunkPlock(SBX_box_t* box, SBX_chunk_t* chunk, SBX_box_position_t localX, SBX_box_position_t localY, SBX_plock_t plock) {
+    // Make sure the chunk storage is not shared before writing in place
+    SBX_report_t report = SBXChunkMakeWritable(chunk, box->allocator);
+    if(report.errorFlags) {
+        return report;
+    }
+
+    SBX_plock_id_t* plockID = SBXPlockIDMatrixAt(&chunk->data->plockIDMatrix, localX, localY);
+    SBX_plock_count_t position = ((SBX_plock_count_t)localY << SBX_CHUNK_SHIFT) | localX;
+
+    // Take the plock being replaced out of the stats
+    SBX_plock_type_id_t previousType = SBX_PLOCK_TYPE_ID_UNSET;
+    if(*plockID != SBX_PLOCK_ID_UNSET) {
+        previousType = chunk->data->plockArray.plocks[SBX_PLOCK_ID_TO_INDEX(*plockID)].type;
+        SBXBoxUncountPlock(box, chunk->data, position, &chunk->data->plockArray.plocks[SBX_PLOCK_ID_TO_INDEX(*plockID)]);
+    }
+
+    // Let subscribers and the thermal pass know, tracking failures turn into full refreshes rather than failing the write
+    SBXBoxTrackChange(box, (SBX_chunk_index_t)(chunk - box->chunks), localX, localY, previousType, plock.type);
+    SBXBoxThermalActivate(box, (SBX_chunk_index_t)(chunk - box->chunks));
+
+    // Unsetting a plock gives its plock ID back to the chunk
+    if(plock.type == SBX_PLOCK_TYPE_ID_UNSET) {
+        if(*plockID != SBX_PLOCK_ID_UNSET) {
+            SBXPlockArrayRelease(&chunk->data->plockArray, *plockID);
+            SBXChunkDataUpdateExtremes(chunk->data, SBX_PLOCK_ID_TO_INDEX(*plockID));
+            *plockID = SBX_PLOCK_ID_UNSET;
+            chunk->data->spatiallyOrdered = false;
+        }
+    } else {
+        if(*plockID == SBX_PLOCK_ID_UNSET) {
+            report = SBXPlockArrayAcquire(&chunk->data->plockArray, plockID);
+            if(report.errorFlags) {
+                return report;
+            }
+            chunk->data->spatiallyOrdered = false;
+        }
+        chunk->data->plockArray.plocks[SBX_PLOCK_ID_TO_INDEX(*plockID)] = plock;
+        SBXChunkDataUpdateExtremes(chunk->data, SBX_PLOCK_ID_TO_INDEX(*plockID));
+        SBXBoxCountPlock(box, chunk->data, position, &plock);
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_SET_PLOCK_SUCCESSFUL
+    };
+}
+
+// Checks whether the chunk at chunkX, chunkY holds set plocks outside of a box of width by height plocks
+static SBX_bool_t SBXBoxChunkHasPlocksOutside(SBX_chunk_data_t* data, SBX_chunk_dimensions_t chunkX, SBX_chunk_dimensions_t chunkY,
+                                              SBX_box_dimensions_t width, SBX_box_dimensions_t height) {
+    // Chunks entirely inside the box have nothing outside of it
+    if(((chunkX + 1) * SBX_CHUNK_SIZE <= width) && ((chunkY + 1) * SBX_CHUNK_SIZE <= height)) {
+        return false;
+    }
+
+    for(SBX_box_position_t localY = 0; localY < SBX_CHUNK_SIZE; localY++) {
+        for(SBX_box_position_t localX = 0; localX < SBX_CHUNK_SIZE; localX++) {
+            SBX_bool_t outside = (chunkX * SBX_CHUNK_SIZE + localX >= width) || (chunkY * SBX_CHUNK_SIZE + localY >= height);
+            if(outside && *SBXPlockIDMatrixAt(&data->plockIDMatrix, localX, localY) != SBX_PLOCK_ID_UNSET) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Resizes the chunk table to cover width by height plocks, keeping chunks that still overlap and unsetting plocks left outside
+static SBX_report_t SBXBoxResizeChunkTable(SBX_box_t* box, SBX_box_dimensions_t width, SBX_box_dimensions_t height) {
+    SBX_chunk_dimensions_t chunkColumns = (width  + SBX_CHUNK_MASK) >> SBX_CHUNK_SHIFT;
+    SBX_chunk_dimensions_t chunkRows    = (height + SBX_CHUNK_MASK) >> SBX_CHUNK_SHIFT;
+
+    // Allocate the new chunk table
+    SBX_chunk_t* newChunks = SBXAllocatorAllocate(box->allocator, SBX_MEMORY_SUBSYSTEM_BOX, sizeof(SBX_chunk_t) * chunkColumns * chunkRows);
+
+    // Check for a memory allocation error
+    if(newChunks == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    // Every chunk starts out empty
+    memset(newChunks, 0, sizeof(SBX_chunk_t) * chunkColumns * chunkRows);
+
+    // Make the kept edge chunks holding plocks that end up outside of the box writable before anything changes,
+    // copying a shared chunk is the only step of the resize that can fail, so a failure leaves the box as it was
+    for(SBX_chunk_dimensions_t y = 0; y < box->chunkRows && y < chunkRows; y++) {
+        for(SBX_chunk_dimensions_t x = 0; x < box->chunkColumns && x < chunkColumns; x++) {
+            SBX_chunk_t* chunk = &box->chunks[y * box->chunkColumns + x];
+            if((chunk->data == SBX_POINTER_UNSET) || !SBXBoxChunkHasPlocksOutside(chunk->data, x, y, width, height)) {
+                continue;
+            }
+
+            SBX_report_t report = SBXChunkMakeWritable(chunk, box->allocator);
+            if(report.errorFlags) {
+                // Free the new chunk table before exiting, chunks copied so far hold the same plocks so they can stay
+                SBXAllocatorFree(box->allocator, SBX_MEMORY_SUBSYSTEM_BOX, newChunks, sizeof(SBX_chunk_t) * chunkColumns * chunkRows);
+
+                // Return error
+                return report;
+            }
+        }
+    }
+
+    // Chunk indices are about to change, subscribers get a full refresh so the old indices given to SBXBoxTrackChange below are never used
+    SBXBoxTrackResize(box);
+
+    // Move over chunks that are still inside the box, and release the rest
+    for(SBX_chunk_dimensions_t y = 0; y < box->chunkRows; y++) {
+        for(SBX_chunk_dimensions_t x = 0; x < box->chunkColumns; x++) {
+            SBX_chunk_t* chunk = &box->chunks[y * box->chunkColumns + x];
+            if(x < chunkColumns && y < chunkRows) {
+                newChunks[y * chunkColumns + x] = *chunk;
+            } else if(chunk->data != SBX_POINTER_UNSET) {
+                SBXBoxUncountChunk(box, y * box->chunkColumns + x, chunk->data);
+                SBXChunkDataRelease(chunk->data);
+            }
+        }
+    }
+    SBXAllocatorFree(box->allocator, SBX_MEMORY_SUBSYSTEM_BOX, box->chunks, sizeof(SBX_chunk_t) * box->chunkColumns * box->chunkRows);
+
+    box->chunks           = newChunks;
+    box->chunkColumns     = chunkColumns;
+    box->chunkRows        = chunkRows;
+    box->defragmentCursor = 0;
+
+    // Unset plocks in the edge chunks that ended up outside of the box so they do not come back when it grows again,
+    // the chunks are writable already and unsetting acquires nothing, so these writes cannot fail
+    for(SBX_chunk_dimensions_t y = 0; y < chunkRows; y++) {
+        for(SBX_chunk_dimensions_t x = 0; x < chunkColumns; x++) {
+            SBX_chunk_t* chunk = &box->chunks[y * chunkColumns + x];
+            if((chunk->data == SBX_POINTER_UNSET) || !SBXBoxChunkHasPlocksOutside(chunk->data, x, y, width, height)) {
+                continue;
+            }
+
+            for(SBX_box_position_t localY = 0; localY < SBX_CHUNK_SIZE; localY++) {
+                for(SBX_box_position_t localX = 0; localX < SBX_CHUNK_SIZE; localX++) {
+                    SBX_bool_t outside = (x * SBX_CHUNK_SIZE + localX >= width) || (y * SBX_CHUNK_SIZE + localY >= height);
+                    if(outside && *SBXPlockIDMatrixAt(&chunk->data->plockIDMatrix, localX, localY) != SBX_PLOCK_ID_UNSET) {
+                        SBXBoxWriteChunkPlock(box, chunk, localX, localY, (SBX_plock_t){.type = SBX_PLOCK_TYPE_ID_UNSET, .temperature = SBX_TEMPERATURE_UNSET});
+                    }
+                }
+            }
+        }
+    }
+
+    // Chunk indices changed, so the thermal pass starts over from every chunk
+    SBXBoxThermalActivateAll(box);
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_SET_SIZE_SUCCESSFUL
+    };
+}
+
 SBX_report_t SBXBoxInit(SBX_box_t* box,
                         SBX_box_dimensions_t width,
                         SBX_box_dimensions_t height)
@@ -91,28 +317,13 @@ SBX_report_t SBXBoxInit(SBX_box_t* box,
         };
     }
 
-    // Create plock array
-    SBX_report_t report = SBXPlockArraySetSize(&box->plockArray, width * height);
-
-    // Check if plock array creation failed
-    if(report.errorFlags) {
-        // Return error
-        return (SBX_report_t){
-            .errorFlags    = SBX_BOX_ERROR_PLOCKS_INIT_FAILED,
-            .reportMessage = SBX_REPORT_STRING_BOX_PLOCKS_FAILED
-        };
-    }
-
-    // Create plock array
-    report = SBXPlockIDMatrixSetSize(&box->plockIDMatrix, width, height);
+    // Create chunk table
+    SBX_report_t report = SBXBoxResizeChunkTable(box, width, height);
 
-    // Check if plock ID matrix creation failed
+    // Check if chunk table creation failed
     if(report.errorFlags) {
         // Return error
-        return (SBX_report_t){
-            .errorFlags    = SBX_BOX_ERROR_PLOCK_IDS_INIT_FAILED,
-            .reportMessage = SBX_REPORT_STRING_BOX_PLOCK_IDS_FAILED
-        };
+        return report;
     }
 
     // Set box parameters
@@ -146,15 +357,24 @@ SBX_report_t SBXBoxDeinit(SBX_box_t* box) {
         };
     }
 
-    // Check if plock array exists, then destroy it
-    if(box->plockArray.plocks) {
-        SBXPlockArraySetSize(&box->plockArray, 0);
+    // Release every chunk, storage still referenced by a snapshot or another box stays alive until that releases it
+    for(SBX_chunk_index_t i = 0; i < (SBX_chunk_index_t)box->chunkColumns * box->chunkRows; i++) {
+        if(box->chunks[i].data != SBX_POINTER_UNSET) {
+            SBXChunkDataRelease(box->chunks[i].data);
+        }
     }
 
-    // Check if plock ID matrix exists, then destroy it
-    if(box->plockIDMatrix.plockIDs) {
-        SBXPlockIDMatrixSetSize(&box->plockIDMatrix, 0, 0);
-    }
+    // Destroy the chunk table
+    SBXBoxTrackResize(box);
+    SBXAllocatorFree(box->allocator, SBX_MEMORY_SUBSYSTEM_BOX, box->chunks, sizeof(SBX_chunk_t) * box->chunkColumns * box->chunkRows);
+    box->chunks       = SBX_POINTER_UNSET;
+    box->chunkColumns = 0;
+    box->chunkRows    = 0;
+    SBXBoxThermalActivateAll(box);
+    box->width        = SBX_DIMENSION_UNSET;
+    box->height       = SBX_DIMENSION_UNSET;
+    memset(box->plockTypeCounts, 0, sizeof(box->plockTypeCounts));
+    box->tick         = 0;
 
     // Set the init state to deinit
     box->initialized = false;
@@ -165,7 +385,7 @@ SBX_report_t SBXBoxDeinit(SBX_box_t* box) {
     };
 }
 
-SBX_report_t SBXBoxGetSize(SBX_box_t* box, SBX_box_dimensions_t* width, SBX_box_dimensions_t* height) {
+SBX_report_t (SBXBoxGetSize)(SBX_box_t* box, SBX_box_dimensions_t* width, SBX_box_dimensions_t* height) {
     // Check if required arguments are provided
     if(box == SBX_POINTER_UNSET) {
         // Return error
@@ -216,37 +436,290 @@ SBX_report_t SBXBoxSetSize(SBX_box_t* box, SBX_box_dimensions_t width, SBX_box_d
         };
     }
 
-    // Resize plock array
-    SBX_report_t report = SBXPlockArraySetSize(&box->plockArray, width * height);
+    // Resize chunk table
+    SBX_report_t report = SBXBoxResizeChunkTable(box, width, height);
 
-    // Check if plock array recreation failed
+    // Check if chunk table recreation failed
     if(report.errorFlags) {
+        // Return error
+        return report;
+    }
+
+    // Set box parameters
+    box->width  = width;
+    box->height = height;
+
+    // Return success
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_SET_SIZE_SUCCESSFUL
+    };
+}
+
+SBX_report_t (SBXBoxGetPlock)(SBX_box_t* box, SBX_box_position_t x, SBX_box_position_t y, SBX_plock_t* plock) {
+    // Check if required arguments are provided
+    if((box == SBX_POINTER_UNSET) || (plock == SBX_POINTER_UNSET)) {
         // Return error
         return (SBX_report_t){
-            .errorFlags    = SBX_BOX_ERROR_PLOCKS_INIT_FAILED,
-            .reportMessage = SBX_REPORT_STRING_BOX_PLOCKS_FAILED
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for box initialized
+    if(!box->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_NOT_INIT,
+            .reportMessage = SBX_REPORT_STRING_BOX_NOT_INIT
+        };
+    }
+    // Check for position inside the box
+    if((x >= box->width) || (y >= box->height)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_OUT_OF_BOUNDS,
+            .reportMessage = SBX_REPORT_STRING_BOX_OUT_OF_BOUNDS
         };
     }
 
-    // Create/Resize plock array
-    report = SBXPlockIDMatrixSetSize(&box->plockIDMatrix, width, height);
+    // Look up the plock through the chunk it is in, empty chunks and unset plock IDs give an unset plock
+    SBX_chunk_t* chunk = &box->chunks[(y >> SBX_CHUNK_SHIFT) * box->chunkColumns + (x >> SBX_CHUNK_SHIFT)];
+    SBX_plock_id_t plockID = SBX_PLOCK_ID_UNSET;
+    if(chunk->data != SBX_POINTER_UNSET) {
+        plockID = *SBXPlockIDMatrixAt(&chunk->data->plockIDMatrix, x & SBX_CHUNK_MASK, y & SBX_CHUNK_MASK);
+    }
+    if(plockID == SBX_PLOCK_ID_UNSET) {
+        *plock = (SBX_plock_t){.type = SBX_PLOCK_TYPE_ID_UNSET, .temperature = SBX_TEMPERATURE_UNSET};
+    } else {
+        *plock = chunk->data->plockArray.plocks[SBX_PLOCK_ID_TO_INDEX(plockID)];
+    }
 
-    // Check if plock ID matrix creation failed
-    if(report.errorFlags) {
+    // Return success
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_GET_PLOCK_SUCCESSFUL
+    };
+}
+
+SBX_report_t (SBXBoxSetPlock)(SBX_box_t* box, SBX_box_position_t x, SBX_box_position_t y, SBX_plock_t plock) {
+    // Check if required arguments are provided
+    if(box == SBX_POINTER_UNSET) {
         // Return error
         return (SBX_report_t){
-            .errorFlags    = SBX_BOX_ERROR_PLOCK_IDS_INIT_FAILED,
-            .reportMessage = SBX_REPORT_STRING_BOX_PLOCK_IDS_FAILED
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for box initialized
+    if(!box->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_NOT_INIT,
+            .reportMessage = SBX_REPORT_STRING_BOX_NOT_INIT
+        };
+    }
+    // Check for position inside the box
+    if((x >= box->width) || (y >= box->height)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_OUT_OF_BOUNDS,
+            .reportMessage = SBX_REPORT_STRING_BOX_OUT_OF_BOUNDS
         };
     }
 
-    // Set box parameters
-    box->width  = width;
-    box->height = height;
+    // Unsetting a plock in an empty chunk is a no-op, so don't create storage for it
+    SBX_chunk_t* chunk = &box->chunks[(y >> SBX_CHUNK_SHIFT) * box->chunkColumns + (x >> SBX_CHUNK_SHIFT)];
+    if((chunk->data == SBX_POINTER_UNSET) && (plock.type == SBX_PLOCK_TYPE_ID_UNSET)) {
+        return (SBX_report_t){
+            .errorFlags    = 0,
+            .reportMessage = SBX_REPORT_STRING_BOX_SET_PLOCK_SUCCESSFUL
+        };
+    }
+
+    // Write the plock
+    return SBXBoxWriteChunkPlock(box, chunk, x & SBX_CHUNK_MASK, y & SBX_CHUNK_MASK, plock);
+}
+
+SBX_report_t SBXBoxClone(SBX_box_t* box, SBX_box_t* clone) {
+    // Check if required arguments are provided
+    if((box == SBX_POINTER_UNSET) || (clone == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for box initialized
+    if(!box->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_NOT_INIT,
+            .reportMessage = SBX_REPORT_STRING_BOX_NOT_INIT
+        };
+    }
+    // Check for clone not already initialized
+    if(clone->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_ALREADY_INIT,
+            .reportMessage = SBX_REPORT_STRING_BOX_ALREADY_INIT
+        };
+    }
+
+    // Allocate the clone chunk table
+    SBX_chunk_index_t chunkCount = (SBX_chunk_index_t)box->chunkColumns * box->chunkRows;
+    clone->chunks = SBXAllocatorAllocate(clone->allocator, SBX_MEMORY_SUBSYSTEM_BOX, sizeof(SBX_chunk_t) * chunkCount);
+
+    // Check for a memory allocation error
+    if(clone->chunks == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    // Share every chunk with the clone, SBXChunkMakeWritable copies a chunk the first time either box writes to it
+    memcpy(clone->chunks, box->chunks, sizeof(SBX_chunk_t) * chunkCount);
+    for(SBX_chunk_index_t i = 0; i < chunkCount; i++) {
+        if(clone->chunks[i].data != SBX_POINTER_UNSET) {
+            SBXChunkDataRetain(clone->chunks[i].data);
+        }
+    }
+
+    // Set clone parameters
+    clone->chunkColumns     = box->chunkColumns;
+    clone->chunkRows        = box->chunkRows;
+    clone->defragmentCursor = 0;
+    clone->tick             = box->tick;
+    SBXBoxTrackResize(clone);
+    memcpy(clone->plockTypeCounts, box->plockTypeCounts, sizeof(clone->plockTypeCounts));
+    clone->width        = box->width;
+    clone->height       = box->height;
+    clone->thermal.mode        = box->thermal.mode;
+    clone->thermal.diffusivity = box->thermal.diffusivity;
+    clone->thermal.epsilon     = box->thermal.epsilon;
+    clone->lod                 = box->lod;
+    clone->boundary            = box->boundary;
+    SBXBoxThermalActivateAll(clone);
+
+    // Set init state to init
+    clone->initialized = true;
 
-    // Return success
     return (SBX_report_t){
         .errorFlags    = 0,
-        .reportMessage = SBX_REPORT_STRING_BOX_SET_SIZE_SUCCESSFUL
+        .reportMessage = SBX_REPORT_STRING_BOX_CLONE_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxDefragment(SBX_box_t* box, SBX_chunk_index_t chunkBudget) {
+    // Check if required arguments are provided
+    if(box == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for box initialized
+    if(!box->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_NOT_INIT,
+            .reportMessage = SBX_REPORT_STRING_BOX_NOT_INIT
+        };
+    }
+
+    // Visit every chunk at most once, starting where the last call stopped
+    SBX_chunk_index_t chunkCount = (SBX_chunk_index_t)box->chunkColumns * box->chunkRows;
+    SBX_chunk_index_t renumbered = 0;
+    for(SBX_chunk_index_t visited = 0; visited < chunkCount && (!chunkBudget || renumbered < chunkBudget); visited++) {
+        SBX_chunk_t* chunk = &box->chunks[box->defragmentCursor];
+        box->defragmentCursor = (box->defragmentCursor + 1) % chunkCount;
+
+        // Renumbering a shared chunk would copy it just to reorder it, leave it until it is copied by a write
+        if((chunk->data == SBX_POINTER_UNSET) || chunk->data->spatiallyOrdered ||
+           (atomic_load_explicit(&chunk->data->referenceCount, memory_order_acquire) > 1)) {
+            continue;
+        }
+
+        SBX_report_t report = SBXChunkDataDefragment(chunk->data);
+        if(report.errorFlags) {
+            return report;
+        }
+        renumbered++;
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_DEFRAGMENT_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxGetChunkHash(SBX_box_t* box, SBX_chunk_index_t chunkIndex, uint64_t* hash) {
+    // Check if required arguments are provided
+    if((box == SBX_POINTER_UNSET) || (hash == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for box initialized
+    if(!box->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_NOT_INIT,
+            .reportMessage = SBX_REPORT_STRING_BOX_NOT_INIT
+        };
+    }
+    // Check for chunk inside the chunk table
+    if(chunkIndex >= (SBX_chunk_index_t)box->chunkColumns * box->chunkRows) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_OUT_OF_BOUNDS,
+            .reportMessage = SBX_REPORT_STRING_BOX_OUT_OF_BOUNDS
+        };
+    }
+
+    SBX_chunk_data_t* data = box->chunks[chunkIndex].data;
+    *hash = data == SBX_POINTER_UNSET ? 0 : data->contentHash;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_GET_HASH_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxGetHash(SBX_box_t* box, uint64_t* hash) {
+    // Check if required arguments are provided
+    if((box == SBX_POINTER_UNSET) || (hash == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for box initialized
+    if(!box->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_NOT_INIT,
+            .reportMessage = SBX_REPORT_STRING_BOX_NOT_INIT
+        };
+    }
+
+    // Fold the size and every chunk hash in chunk table order, FNV-1a style over 64 bit words
+    uint64_t value = 0xCBF29CE484222325ULL;
+    value = (value ^ (((uint64_t)box->width << 32) | box->height)) * 0x100000001B3ULL;
+    for(SBX_chunk_index_t i = 0; i < (SBX_chunk_index_t)box->chunkColumns * box->chunkRows; i++) {
+        SBX_chunk_data_t* data = box->chunks[i].data;
+        value = (value ^ (data == SBX_POINTER_UNSET ? 0 : data->contentHash)) * 0x100000001B3ULL;
+    }
+    *hash = value;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_GET_HASH_SUCCESSFUL
     };
 }
@@ -0,0 +1,249 @@
+// Project headers
+#include <SBX/capture.h>
+#include <SBX/strings.h>
+
+// LibC headers
+#include <string.h>
+
+// Hands the oldest pending readback to the callback once its fence signaled, finished is left false when it isn't done and wait is false
+static SBX_report_t SBXCaptureFinishOldest(SBX_capture_t* capture, SBX_bool_t wait, SBX_bool_t* finished) {
+    GladGLContext* gl    = capture->window->openglContext;
+    uint32_t       index = capture->oldest;
+    *finished = false;
+
+    // Flush so the fence is sure to signal, waits are split into bounded steps so a timeout can't be mistaken for a failure
+    GLenum status;
+    do {
+        status = gl->ClientWaitSync(capture->fences[index], GL_SYNC_FLUSH_COMMANDS_BIT, wait ? SBX_CAPTURE_WAIT_TIMEOUT : 0);
+    } while(wait && (status == GL_TIMEOUT_EXPIRED));
+    if(status == GL_TIMEOUT_EXPIRED) {
+        return (SBX_report_t){
+            .errorFlags    = 0,
+            .reportMessage = SBX_REPORT_STRING_CAPTURE_COLLECT_SUCCESSFUL
+        };
+    }
+
+    // The readback is done with either way, a failed one is dropped
+    gl->DeleteSync(capture->fences[index]);
+    capture->fences[index] = 0;
+    capture->oldest        = (capture->oldest + 1) % SBX_CAPTURE_BUFFER_COUNT;
+    capture->pendingCount--;
+    *finished = true;
+
+    size_t         size   = (size_t)capture->width * capture->height * SBX_CAPTURE_PIXEL_SIZE;
+    const uint8_t* pixels = status != GL_WAIT_FAILED ? gl->MapNamedBufferRange(capture->pixelBuffers[index], 0, (GLsizeiptr)size, GL_MAP_READ_BIT) : SBX_POINTER_UNSET;
+    if(pixels == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_CAPTURE_ERROR_READBACK_FAILED,
+            .reportMessage = SBX_REPORT_STRING_CAPTURE_READBACK_FAILED
+        };
+    }
+    SBX_report_t report = capture->callback(capture->userData, capture->tags[index], pixels, capture->width, capture->height);
+    gl->UnmapNamedBuffer(capture->pixelBuffers[index]);
+
+    return report.errorFlags ? report : (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_CAPTURE_COLLECT_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXCaptureCreate(SBX_capture_t** capture, SBX_window_t* window, uint32_t width, uint32_t height, SBX_capture_callback_t callback, void* userData) {
+    // Check if required arguments are provided
+    if((capture == SBX_POINTER_UNSET) || (window == SBX_POINTER_UNSET) || !width || !height || (callback == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for window initialized
+    if(!window->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_WINDOW_ERROR_NOT_INIT,
+            .reportMessage = SBX_REPORT_STRING_WINDOW_NOT_INIT
+        };
+    }
+
+    // Allocate memory for the SBXCapture struture
+    *capture = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_RENDER, sizeof(SBX_capture_t));
+
+    // Check for a memory allocation error
+    if(!*capture) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+    memset(*capture, 0, sizeof(SBX_capture_t));
+    (*capture)->window   = window;
+    (*capture)->width    = width;
+    (*capture)->height   = height;
+    (*capture)->callback = callback;
+    (*capture)->userData = userData;
+
+    // Framebuffer with a renderbuffer to draw to, offscreen windows have no usable default framebuffer
+    GladGLContext* gl = window->openglContext;
+    gl->CreateRenderbuffers(1, &(*capture)->colorbuffer);
+    gl->NamedRenderbufferStorage((*capture)->colorbuffer, GL_RGBA8, (GLsizei)width, (GLsizei)height);
+    gl->CreateFramebuffers(1, &(*capture)->framebuffer);
+    gl->NamedFramebufferRenderbuffer((*capture)->framebuffer, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, (*capture)->colorbuffer);
+
+    // Pixel buffers only the CPU reads from, kept in client memory where the driver supports it so mapping doesn't copy again
+    gl->CreateBuffers(SBX_CAPTURE_BUFFER_COUNT, (*capture)->pixelBuffers);
+    for(uint32_t i = 0; i < SBX_CAPTURE_BUFFER_COUNT; i++) {
+        gl->NamedBufferStorage((*capture)->pixelBuffers[i], (GLsizeiptr)((size_t)width * height * SBX_CAPTURE_PIXEL_SIZE), NULL,
+                               GL_MAP_READ_BIT | GL_CLIENT_STORAGE_BIT);
+    }
+
+    if(gl->CheckNamedFramebufferStatus((*capture)->framebuffer, GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        // Delete the objects and free the memory before exiting
+        SBXCaptureDestroy(*capture);
+        *capture = SBX_POINTER_UNSET;
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_CAPTURE_ERROR_FRAMEBUFFER_INCOMPLETE,
+            .reportMessage = SBX_REPORT_STRING_CAPTURE_FRAMEBUFFER_INCOMPLETE
+        };
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMMON_CREATION_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXCaptureDestroy(SBX_capture_t* capture) {
+    // Check if required arguments are provided
+    if(capture == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // The OpenGL objects can only be deleted while the context of the window still exists
+    SBX_report_t report = {
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMMON_DESTRUCTION_SUCCESSFUL
+    };
+    if(capture->window->initialized) {
+        GladGLContext* gl = capture->window->openglContext;
+        report = SBXCaptureCollect(capture, true);
+
+        // Fences of readbacks an error stopped the collection at
+        for(uint32_t i = 0; i < SBX_CAPTURE_BUFFER_COUNT; i++) {
+            if(capture->fences[i]) {
+                gl->DeleteSync(capture->fences[i]);
+            }
+        }
+        gl->DeleteBuffers(SBX_CAPTURE_BUFFER_COUNT, capture->pixelBuffers);
+        gl->DeleteFramebuffers(1, &capture->framebuffer);
+        gl->DeleteRenderbuffers(1, &capture->colorbuffer);
+    }
+
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_RENDER, capture, sizeof(SBX_capture_t));
+
+    return report.errorFlags ? report : (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMMON_DESTRUCTION_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXCaptureRead(SBX_capture_t* capture, uint64_t tag) {
+    // Check if required arguments are provided
+    if(capture == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for window initialized
+    if(!capture->window->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_WINDOW_ERROR_NOT_INIT,
+            .reportMessage = SBX_REPORT_STRING_WINDOW_NOT_INIT
+        };
+    }
+
+    // Hand out what is done, then make room by waiting for the oldest readback if every pixel buffer is still in use
+    SBX_report_t report = SBXCaptureCollect(capture, false);
+    if(report.errorFlags) {
+        return report;
+    }
+    if(capture->pendingCount == SBX_CAPTURE_BUFFER_COUNT) {
+        SBX_bool_t finished = false;
+        capture->stallCount++;
+        report = SBXCaptureFinishOldest(capture, true, &finished);
+        if(report.errorFlags) {
+            return report;
+        }
+    }
+
+    // Queue the copy into the pixel buffer, ReadPixels returns right away as the destination is a buffer object
+    GladGLContext* gl    = capture->window->openglContext;
+    uint32_t       index = (capture->oldest + capture->pendingCount) % SBX_CAPTURE_BUFFER_COUNT;
+    gl->BindFramebuffer(GL_READ_FRAMEBUFFER, capture->framebuffer);
+    gl->BindBuffer(GL_PIXEL_PACK_BUFFER, capture->pixelBuffers[index]);
+    gl->ReadPixels(0, 0, (GLsizei)capture->width, (GLsizei)capture->height, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+    gl->BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    gl->BindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+
+    capture->fences[index] = gl->FenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    if(!capture->fences[index]) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_CAPTURE_ERROR_READBACK_FAILED,
+            .reportMessage = SBX_REPORT_STRING_CAPTURE_READBACK_FAILED
+        };
+    }
+    capture->tags[index] = tag;
+    capture->pendingCount++;
+
+    // Start the copy now instead of whenever the driver flushes next
+    gl->Flush();
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_CAPTURE_READ_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXCaptureCollect(SBX_capture_t* capture, SBX_bool_t wait) {
+    // Check if required arguments are provided
+    if(capture == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for window initialized
+    if(!capture->window->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_WINDOW_ERROR_NOT_INIT,
+            .reportMessage = SBX_REPORT_STRING_WINDOW_NOT_INIT
+        };
+    }
+
+    // Readbacks finish in the order they were started, so the first one not done ends the collection
+    SBX_bool_t finished = true;
+    while(capture->pendingCount && finished) {
+        SBX_report_t report = SBXCaptureFinishOldest(capture, wait, &finished);
+        if(report.errorFlags) {
+            return report;
+        }
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_CAPTURE_COLLECT_SUCCESSFUL
+    };
+}
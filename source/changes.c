@@ -0,0 +1,372 @@
+// Project headers
+#include <SBX/changes.h>
+#include <SBX/strings.h>
+#include <SBX/box.h>
+
+// LibC headers
+#include <stdlib.h>
+#include <string.h>
+
+// Chunk bounds with no changed positions
+#define SBX_CHUNK_BOUNDS_EMPTY ((SBX_chunk_bounds_t){.minimumX = UINT8_MAX, .minimumY = UINT8_MAX, .maximumX = 0, .maximumY = 0})
+
+// Forgets the recorded chunk changes, leaves the buffers for the next tick
+static void SBXBoxChangesClearChunks(SBX_box_change_tracker_t* tracker) {
+    for(SBX_chunk_index_t i = 0; i < tracker->dirtyChunkCount; i++) {
+        tracker->chunkBounds[tracker->dirtyChunks[i]] = SBX_CHUNK_BOUNDS_EMPTY;
+    }
+    tracker->dirtyChunkCount = 0;
+}
+
+// Forgets every recorded change, leaves the buffers for the next tick
+static void SBXBoxChangesClear(SBX_box_change_tracker_t* tracker) {
+    SBXBoxChangesClearChunks(tracker);
+    for(uint32_t i = 0; i < tracker->transitionKeyCount; i++) {
+        tracker->transitionCounts[tracker->transitionKeys[i]] = 0;
+    }
+    tracker->transitionKeyCount = 0;
+    tracker->resized            = false;
+}
+
+// Frees the per chunk buffers
+static void SBXBoxChangesFreeChunks(SBX_box_change_tracker_t* tracker) {
+    SBXAllocatorFree(tracker->allocator, SBX_MEMORY_SUBSYSTEM_CHANGES, tracker->chunkBounds, sizeof(SBX_chunk_bounds_t) * tracker->chunkCapacity);
+    SBXAllocatorFree(tracker->allocator, SBX_MEMORY_SUBSYSTEM_CHANGES, tracker->dirtyChunks, sizeof(SBX_chunk_index_t) * tracker->chunkCapacity);
+    SBXAllocatorFree(tracker->allocator, SBX_MEMORY_SUBSYSTEM_CHANGES, tracker->rects, sizeof(SBX_box_dirty_rect_t) * tracker->chunkCapacity);
+    tracker->chunkBounds = SBX_POINTER_UNSET;
+    tracker->dirtyChunks = SBX_POINTER_UNSET;
+    tracker->rects       = SBX_POINTER_UNSET;
+}
+
+// Frees the transition buffers
+static void SBXBoxChangesFreeTransitions(SBX_box_change_tracker_t* tracker) {
+    SBXAllocatorFree(tracker->allocator, SBX_MEMORY_SUBSYSTEM_CHANGES, tracker->transitionCounts, SBX_BOX_TRANSITION_COUNT * sizeof(SBX_plock_count_t));
+    SBXAllocatorFree(tracker->allocator, SBX_MEMORY_SUBSYSTEM_CHANGES, tracker->transitionKeys, SBX_BOX_TRANSITION_COUNT * sizeof(uint16_t));
+    SBXAllocatorFree(tracker->allocator, SBX_MEMORY_SUBSYSTEM_CHANGES, tracker->transitions, SBX_BOX_TRANSITION_COUNT * sizeof(SBX_box_transition_t));
+    tracker->transitionCounts = SBX_POINTER_UNSET;
+    tracker->transitionKeys   = SBX_POINTER_UNSET;
+    tracker->transitions      = SBX_POINTER_UNSET;
+}
+
+// Makes sure the per chunk buffers cover the chunk table and the transition buffers exist
+static SBX_bool_t SBXBoxChangesReserve(SBX_box_t* box) {
+    SBX_box_change_tracker_t* tracker = &box->changes;
+
+    if(tracker->transitionCounts == SBX_POINTER_UNSET) {
+        tracker->transitionCounts = SBXAllocatorAllocate(tracker->allocator, SBX_MEMORY_SUBSYSTEM_CHANGES, SBX_BOX_TRANSITION_COUNT * sizeof(SBX_plock_count_t));
+        tracker->transitionKeys   = SBXAllocatorAllocate(tracker->allocator, SBX_MEMORY_SUBSYSTEM_CHANGES, SBX_BOX_TRANSITION_COUNT * sizeof(uint16_t));
+        tracker->transitions      = SBXAllocatorAllocate(tracker->allocator, SBX_MEMORY_SUBSYSTEM_CHANGES, SBX_BOX_TRANSITION_COUNT * sizeof(SBX_box_transition_t));
+        if(!tracker->transitionCounts || !tracker->transitionKeys || !tracker->transitions) {
+            SBXBoxChangesFreeTransitions(tracker);
+            return false;
+        }
+        memset(tracker->transitionCounts, 0, SBX_BOX_TRANSITION_COUNT * sizeof(SBX_plock_count_t));
+    }
+
+    SBX_chunk_index_t chunkCount = (SBX_chunk_index_t)box->chunkColumns * box->chunkRows;
+    if(tracker->chunkCapacity >= chunkCount) {
+        return true;
+    }
+
+    // Allocate all three buffers before replacing any so they always share one capacity
+    SBX_chunk_bounds_t*   chunkBounds = SBXAllocatorAllocate(tracker->allocator, SBX_MEMORY_SUBSYSTEM_CHANGES, sizeof(SBX_chunk_bounds_t) * chunkCount);
+    SBX_chunk_index_t*    dirtyChunks = SBXAllocatorAllocate(tracker->allocator, SBX_MEMORY_SUBSYSTEM_CHANGES, sizeof(SBX_chunk_index_t) * chunkCount);
+    SBX_box_dirty_rect_t* rects       = SBXAllocatorAllocate(tracker->allocator, SBX_MEMORY_SUBSYSTEM_CHANGES, sizeof(SBX_box_dirty_rect_t) * chunkCount);
+    if(!chunkBounds || !dirtyChunks || !rects) {
+        SBXAllocatorFree(tracker->allocator, SBX_MEMORY_SUBSYSTEM_CHANGES, chunkBounds, sizeof(SBX_chunk_bounds_t) * chunkCount);
+        SBXAllocatorFree(tracker->allocator, SBX_MEMORY_SUBSYSTEM_CHANGES, dirtyChunks, sizeof(SBX_chunk_index_t) * chunkCount);
+        SBXAllocatorFree(tracker->allocator, SBX_MEMORY_SUBSYSTEM_CHANGES, rects, sizeof(SBX_box_dirty_rect_t) * chunkCount);
+        return false;
+    }
+
+    // Carry the recorded changes over, rects are only scratch space
+    if(tracker->chunkCapacity) {
+        memcpy(chunkBounds, tracker->chunkBounds, sizeof(SBX_chunk_bounds_t) * tracker->chunkCapacity);
+        memcpy(dirtyChunks, tracker->dirtyChunks, sizeof(SBX_chunk_index_t) * tracker->dirtyChunkCount);
+    }
+    SBXBoxChangesFreeChunks(tracker);
+    tracker->chunkBounds = chunkBounds;
+    tracker->dirtyChunks = dirtyChunks;
+    tracker->rects       = rects;
+
+    for(SBX_chunk_index_t i = tracker->chunkCapacity; i < chunkCount; i++) {
+        tracker->chunkBounds[i] = SBX_CHUNK_BOUNDS_EMPTY;
+    }
+    tracker->chunkCapacity = chunkCount;
+
+    return true;
+}
+
+SBX_report_t SBXBoxChangeTrackerInit(SBX_box_change_tracker_t* tracker, SBX_allocator_t* allocator) {
+    // Check if required arguments are provided
+    if(tracker == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    *tracker = (SBX_box_change_tracker_t){
+        .allocator            = allocator,
+        .subscriptions        = SBX_POINTER_UNSET,
+        .subscriptionCount    = 0,
+        .subscriptionCapacity = 0,
+        .nextSubscriptionID   = 1,
+        .chunkBounds          = SBX_POINTER_UNSET,
+        .dirtyChunks          = SBX_POINTER_UNSET,
+        .rects                = SBX_POINTER_UNSET,
+        .dirtyChunkCount      = 0,
+        .chunkCapacity        = 0,
+        .transitionCounts     = SBX_POINTER_UNSET,
+        .transitionKeys       = SBX_POINTER_UNSET,
+        .transitions          = SBX_POINTER_UNSET,
+        .transitionKeyCount   = 0,
+        .resized              = false
+    };
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_CHANGE_TRACKER_INIT_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxChangeTrackerDeinit(SBX_box_change_tracker_t* tracker) {
+    // Check if required arguments are provided
+    if(tracker == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    SBXAllocatorFree(tracker->allocator, SBX_MEMORY_SUBSYSTEM_CHANGES, tracker->subscriptions, sizeof(SBX_box_subscription_t) * tracker->subscriptionCapacity);
+    SBXBoxChangesFreeChunks(tracker);
+    SBXBoxChangesFreeTransitions(tracker);
+
+    return SBXBoxChangeTrackerInit(tracker, tracker->allocator);
+}
+
+SBX_report_t SBXBoxSubscribe(SBX_box_t* box, SBX_box_change_callback_t callback, void* userData, SBX_box_subscription_id_t* id) {
+    // Check if required arguments are provided
+    if((box == SBX_POINTER_UNSET) || (callback == SBX_POINTER_UNSET) || (id == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    SBX_box_change_tracker_t* tracker = &box->changes;
+
+    // Grow the subscriber array if it is full
+    if(tracker->subscriptionCount == tracker->subscriptionCapacity) {
+        uint32_t capacity = tracker->subscriptionCapacity ? tracker->subscriptionCapacity * 2 : 4;
+        SBX_box_subscription_t* subscriptions = SBXAllocatorReallocate(tracker->allocator, SBX_MEMORY_SUBSYSTEM_CHANGES, tracker->subscriptions,
+                                                                       sizeof(SBX_box_subscription_t) * tracker->subscriptionCapacity,
+                                                                       sizeof(SBX_box_subscription_t) * capacity);
+
+        // Check for a memory allocation error
+        if(subscriptions == SBX_POINTER_UNSET) {
+            // Return error
+            return (SBX_report_t){
+                .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+                .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+            };
+        }
+
+        tracker->subscriptions        = subscriptions;
+        tracker->subscriptionCapacity = capacity;
+    }
+
+    // Changes made before the first subscriber were never recorded, so it starts from a full refresh
+    if(!tracker->subscriptionCount) {
+        SBXBoxChangesClear(tracker);
+        tracker->resized = true;
+    }
+
+    *id = tracker->nextSubscriptionID++;
+    tracker->subscriptions[tracker->subscriptionCount++] = (SBX_box_subscription_t){
+        .id       = *id,
+        .callback = callback,
+        .userData = userData
+    };
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_SUBSCRIBE_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxUnsubscribe(SBX_box_t* box, SBX_box_subscription_id_t id) {
+    // Check if required arguments are provided
+    if(box == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Remove the subscriber keeping the order of the rest
+    SBX_box_change_tracker_t* tracker = &box->changes;
+    for(uint32_t i = 0; i < tracker->subscriptionCount; i++) {
+        if(tracker->subscriptions[i].id == id) {
+            memmove(&tracker->subscriptions[i], &tracker->subscriptions[i + 1], sizeof(SBX_box_subscription_t) * (tracker->subscriptionCount - i - 1));
+            tracker->subscriptionCount--;
+
+            return (SBX_report_t){
+                .errorFlags    = 0,
+                .reportMessage = SBX_REPORT_STRING_BOX_UNSUBSCRIBE_SUCCESSFUL
+            };
+        }
+    }
+
+    // Return error
+    return (SBX_report_t){
+        .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+        .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+    };
+}
+
+SBX_report_t SBXBoxTrackChange(SBX_box_t* box, SBX_chunk_index_t chunkIndex, SBX_box_position_t localX, SBX_box_position_t localY,
+                               SBX_plock_type_id_t from, SBX_plock_type_id_t to) {
+    // Check if required arguments are provided
+    if(box == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Nobody is listening
+    SBX_box_change_tracker_t* tracker = &box->changes;
+    if(!tracker->subscriptionCount) {
+        return (SBX_report_t){
+            .errorFlags    = 0,
+            .reportMessage = SBX_REPORT_STRING_BOX_TRACK_CHANGE_SUCCESSFUL
+        };
+    }
+
+    // Fall back to a full refresh if the buffers can't cover the change
+    if(!SBXBoxChangesReserve(box)) {
+        SBXBoxChangesClear(tracker);
+        tracker->resized = true;
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    // Grow the bounds of the chunk, adding it to the dirty list on its first change, not needed when a full refresh is pending
+    if(!tracker->resized) {
+        SBX_chunk_bounds_t* bounds = &tracker->chunkBounds[chunkIndex];
+        if(bounds->minimumX > bounds->maximumX) {
+            tracker->dirtyChunks[tracker->dirtyChunkCount++] = chunkIndex;
+            *bounds = (SBX_chunk_bounds_t){.minimumX = localX, .minimumY = localY, .maximumX = localX, .maximumY = localY};
+        } else {
+            bounds->minimumX = localX < bounds->minimumX ? localX : bounds->minimumX;
+            bounds->minimumY = localY < bounds->minimumY ? localY : bounds->minimumY;
+            bounds->maximumX = localX > bounds->maximumX ? localX : bounds->maximumX;
+            bounds->maximumY = localY > bounds->maximumY ? localY : bounds->maximumY;
+        }
+        bounds->typesChanged |= from != to;
+    }
+
+    // Count plock type changes, temperature only writes just dirty the chunk
+    if(from != to) {
+        uint16_t key = (uint16_t)(from * SBX_PLOCK_TYPE_COUNT + to);
+        if(!tracker->transitionCounts[key]++) {
+            tracker->transitionKeys[tracker->transitionKeyCount++] = key;
+        }
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_TRACK_CHANGE_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxTrackResize(SBX_box_t* box) {
+    // Check if required arguments are provided
+    if(box == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Per chunk changes are indexed by the old chunk table, drop them and have subscribers refresh everything instead
+    SBXBoxChangesClearChunks(&box->changes);
+    box->changes.resized = box->changes.subscriptionCount != 0;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_TRACK_CHANGE_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxNotifyChanges(SBX_box_t* box) {
+    // Check if required arguments are provided
+    if(box == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    SBX_box_change_tracker_t* tracker = &box->changes;
+    if(!tracker->subscriptionCount || (!tracker->resized && !tracker->dirtyChunkCount)) {
+        return (SBX_report_t){
+            .errorFlags    = 0,
+            .reportMessage = SBX_REPORT_STRING_BOX_NOTIFY_CHANGES_SUCCESSFUL
+        };
+    }
+
+    // Turn the chunk bounds into box rectangles, clipped to the box in edge chunks
+    for(SBX_chunk_index_t i = 0; i < tracker->dirtyChunkCount; i++) {
+        SBX_chunk_index_t   chunkIndex = tracker->dirtyChunks[i];
+        SBX_chunk_bounds_t* bounds     = &tracker->chunkBounds[chunkIndex];
+        tracker->rects[i] = (SBX_box_dirty_rect_t){
+            .x            = (SBX_box_position_t)((chunkIndex % box->chunkColumns) * SBX_CHUNK_SIZE + bounds->minimumX),
+            .y            = (SBX_box_position_t)((chunkIndex / box->chunkColumns) * SBX_CHUNK_SIZE + bounds->minimumY),
+            .width        = (SBX_box_dimensions_t)(bounds->maximumX - bounds->minimumX + 1),
+            .height       = (SBX_box_dimensions_t)(bounds->maximumY - bounds->minimumY + 1),
+            .typesChanged = bounds->typesChanged
+        };
+    }
+
+    for(uint32_t i = 0; i < tracker->transitionKeyCount; i++) {
+        uint16_t key = tracker->transitionKeys[i];
+        tracker->transitions[i] = (SBX_box_transition_t){
+            .from  = (SBX_plock_type_id_t)(key / SBX_PLOCK_TYPE_COUNT),
+            .to    = (SBX_plock_type_id_t)(key % SBX_PLOCK_TYPE_COUNT),
+            .count = tracker->transitionCounts[key]
+        };
+    }
+
+    SBX_box_changes_t changes = {
+        .tick            = box->tick,
+        .resized         = tracker->resized,
+        .rects           = tracker->rects,
+        .rectCount       = tracker->dirtyChunkCount,
+        .transitions     = tracker->transitions,
+        .transitionCount = tracker->transitionKeyCount
+    };
+    for(uint32_t i = 0; i < tracker->subscriptionCount; i++) {
+        tracker->subscriptions[i].callback(box, &changes, tracker->subscriptions[i].userData);
+    }
+
+    SBXBoxChangesClear(tracker);
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_NOTIFY_CHANGES_SUCCESSFUL
+    };
+}
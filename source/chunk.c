@@ -0,0 +1,384 @@
+// Project headers
+#include <SBX/chunk.h>
+#include <SBX/strings.h>
+
+// LibC headers
+#include <stdlib.h>
+#include <string.h>
+
+// Index a tournament tree node stands for, children past the last node are the plocks themselves and stand for their own index while set
+static inline uint16_t SBXChunkDataExtremesChild(const SBX_chunk_data_t* data, const uint16_t* tree, uint32_t node) {
+    if(node < SBX_CHUNK_PLOCK_COUNT) {
+        return tree[node];
+    }
+    uint32_t index = node - SBX_CHUNK_PLOCK_COUNT;
+    return data->plockArray.plocks[index].type != SBX_PLOCK_TYPE_ID_UNSET ? (uint16_t)index : SBX_CHUNK_PLOCK_COUNT;
+}
+
+// Picks the lowest or highest plock of the two children of a tournament tree node
+static inline uint16_t SBXChunkDataExtremesPick(const SBX_chunk_data_t* data, const uint16_t* tree, uint32_t node, SBX_bool_t highest) {
+    uint16_t left = SBXChunkDataExtremesChild(data, tree, 2 * node), right = SBXChunkDataExtremesChild(data, tree, 2 * node + 1);
+    if((left == SBX_CHUNK_PLOCK_COUNT) || (right == SBX_CHUNK_PLOCK_COUNT)) {
+        return left == SBX_CHUNK_PLOCK_COUNT ? right : left;
+    }
+
+    SBX_plock_temperature_t leftTemperature = data->plockArray.plocks[left].temperature, rightTemperature = data->plockArray.plocks[right].temperature;
+    return (highest ? rightTemperature > leftTemperature : rightTemperature < leftTemperature) ? right : left;
+}
+
+// Updates the nodes of a tournament tree above a plock, a node keeping a winner other than the plock leaves every node above it as it was
+static inline void SBXChunkDataUpdateExtremesTree(SBX_chunk_data_t* data, uint16_t* tree, SBX_plock_count_t plockIndex, SBX_bool_t highest) {
+    for(uint32_t node = (SBX_CHUNK_PLOCK_COUNT + plockIndex) >> 1; node; node >>= 1) {
+        uint16_t winner = SBXChunkDataExtremesPick(data, tree, node, highest);
+        if((winner == tree[node]) && (winner != plockIndex)) {
+            break;
+        }
+        tree[node] = winner;
+    }
+}
+
+// Builds both tournament trees of a chunk from its plocks, bottom up
+static void SBXChunkDataBuildExtremes(SBX_chunk_data_t* data) {
+    for(uint32_t node = SBX_CHUNK_PLOCK_COUNT - 1; node; node--) {
+        data->minimumTree[node] = SBXChunkDataExtremesPick(data, data->minimumTree, node, false);
+        data->maximumTree[node] = SBXChunkDataExtremesPick(data, data->maximumTree, node, true);
+    }
+}
+
+SBX_report_t SBXChunkDataCreate(SBX_chunk_data_t** data, SBX_allocator_t* allocator) {
+    // Check if required arguments are provided
+    if(data == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Allocate memory for the SBXChunkData struture
+    *data = SBXAllocatorAllocate(allocator, SBX_MEMORY_SUBSYSTEM_CHUNK, sizeof(SBX_chunk_data_t));
+
+    // Check for a memory allocation error
+    if(!*data) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    // Set SBXChunkData members to an empty state
+    atomic_init(&(*data)->referenceCount, 1);
+    (*data)->allocator     = allocator;
+    (*data)->plockArray    = (SBX_plock_array_t){.allocator = allocator, .plocks = NULL, .count = 0, .freeIDs = NULL, .freeCount = 0};
+    (*data)->plockIDMatrix = (SBX_plock_id_matrix_t){.allocator = allocator, .plockIDs = NULL, .width = SBX_DIMENSION_UNSET, .height = SBX_DIMENSION_UNSET};
+    (*data)->spatiallyOrdered   = true;
+    (*data)->plockCount         = 0;
+    (*data)->thermalEnergy      = 0.0L;
+    (*data)->contentHash        = 0;
+    (*data)->typeHash           = 0;
+
+    // Create plock array and plock ID matrix, one plock per cell so the array can never run out of IDs
+    SBX_report_t report = SBXPlockArraySetSize(&(*data)->plockArray, SBX_CHUNK_PLOCK_COUNT);
+    if(!report.errorFlags) {
+        report = SBXPlockIDMatrixSetSize(&(*data)->plockIDMatrix, SBX_CHUNK_SIZE, SBX_CHUNK_SIZE);
+    }
+    if(!report.errorFlags) {
+        SBXChunkDataBuildExtremes(*data);
+    }
+
+    // Check if plock array or plock ID matrix creation failed
+    if(report.errorFlags) {
+        // Free anything that was created before exiting
+        SBXPlockArraySetSize(&(*data)->plockArray, 0);
+        SBXAllocatorFree(allocator, SBX_MEMORY_SUBSYSTEM_CHUNK, *data, sizeof(SBX_chunk_data_t));
+        *data = SBX_POINTER_UNSET;
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMMON_CREATION_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXChunkDataRetain(SBX_chunk_data_t* data) {
+    // Check if required arguments are provided
+    if(data == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // New references are only ever taken by the owning thread, so no ordering is needed
+    atomic_fetch_add_explicit(&data->referenceCount, 1, memory_order_relaxed);
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_CHUNK_RETAIN_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXChunkDataRelease(SBX_chunk_data_t* data) {
+    // Check if required arguments are provided
+    if(data == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Drop the reference, the release ordering publishes our reads before another thread can start writing in place
+    if(atomic_fetch_sub_explicit(&data->referenceCount, 1, memory_order_release) == 1) {
+        atomic_thread_fence(memory_order_acquire);
+
+        // Last reference, destroy the plock array, plock ID matrix, and the structure itself
+        SBXPlockArraySetSize(&data->plockArray, 0);
+        SBXPlockIDMatrixSetSize(&data->plockIDMatrix, 0, 0);
+        SBXAllocatorFree(data->allocator, SBX_MEMORY_SUBSYSTEM_CHUNK, data, sizeof(SBX_chunk_data_t));
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_CHUNK_RELEASE_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXChunkDataDuplicate(SBX_chunk_data_t* data, SBX_chunk_data_t** copy) {
+    // Check if required arguments are provided
+    if((data == SBX_POINTER_UNSET) || (copy == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Create the new storage from the same allocator
+    SBX_report_t report = SBXChunkDataCreate(copy, data->allocator);
+    if(report.errorFlags) {
+        return report;
+    }
+
+    // Copy plocks, the free ID stack, and plock IDs so plock IDs stay valid in the copy
+    memcpy((*copy)->plockArray.plocks, data->plockArray.plocks, sizeof(SBX_plock_t) * SBX_CHUNK_PLOCK_COUNT);
+    memcpy((*copy)->plockArray.freeIDs, data->plockArray.freeIDs, sizeof(SBX_plock_id_t) * data->plockArray.freeCount);
+    (*copy)->plockArray.freeCount = data->plockArray.freeCount;
+    memcpy((*copy)->plockIDMatrix.plockIDs, data->plockIDMatrix.plockIDs, sizeof(SBX_plock_id_t) * SBX_CHUNK_PLOCK_COUNT);
+    (*copy)->spatiallyOrdered   = data->spatiallyOrdered;
+    (*copy)->plockCount         = data->plockCount;
+    (*copy)->thermalEnergy      = data->thermalEnergy;
+    memcpy((*copy)->minimumTree, data->minimumTree, sizeof(data->minimumTree));
+    memcpy((*copy)->maximumTree, data->maximumTree, sizeof(data->maximumTree));
+    (*copy)->contentHash        = data->contentHash;
+    (*copy)->typeHash           = data->typeHash;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_CHUNK_DUPLICATE_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXChunkMakeWritable(SBX_chunk_t* chunk, SBX_allocator_t* allocator) {
+    // Check if required arguments are provided
+    if(chunk == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Empty chunks get their storage on first write
+    if(chunk->data == SBX_POINTER_UNSET) {
+        SBX_report_t report = SBXChunkDataCreate(&chunk->data, allocator);
+        if(report.errorFlags) {
+            return report;
+        }
+    }
+    // Shared chunks get copied on first write, the acquire pairs with the release in SBXChunkDataRelease
+    else if(atomic_load_explicit(&chunk->data->referenceCount, memory_order_acquire) > 1) {
+        SBX_chunk_data_t* copy = SBX_POINTER_UNSET;
+        SBX_report_t report = SBXChunkDataDuplicate(chunk->data, &copy);
+        if(report.errorFlags) {
+            return report;
+        }
+
+        // Swap our reference over to the private copy
+        SBXChunkDataRelease(chunk->data);
+        chunk->data = copy;
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_CHUNK_MAKE_WRITABLE_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXChunkDataDefragment(SBX_chunk_data_t* data) {
+    // Check if required arguments are provided
+    if(data == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Nothing to do if no plock ID was acquired or released since the last renumbering
+    if(data->spatiallyOrdered) {
+        return (SBX_report_t){
+            .errorFlags    = 0,
+            .reportMessage = SBX_REPORT_STRING_CHUNK_DEFRAGMENT_SUCCESSFUL
+        };
+    }
+
+    // Allocate the renumbered plock array
+    SBX_plock_t* newPlocks = SBXAllocatorAllocate(data->allocator, SBX_MEMORY_SUBSYSTEM_PLOCK_ARRAY, sizeof(SBX_plock_t) * SBX_CHUNK_PLOCK_COUNT);
+
+    // Check for a memory allocation error
+    if(newPlocks == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    // Walk positions in Z-order handing out plock IDs in sequence
+    SBX_plock_count_t plockCount = 0;
+    for(uint32_t code = 0; code < SBX_CHUNK_PLOCK_COUNT; code++) {
+        // Deinterleave the Z-order code, even bits are x and odd bits are y
+        SBX_box_position_t x = 0, y = 0;
+        for(uint32_t bit = 0; bit < SBX_CHUNK_SHIFT; bit++) {
+            x |= ((code >> (2 * bit))     & 1) << bit;
+            y |= ((code >> (2 * bit + 1)) & 1) << bit;
+        }
+
+        SBX_plock_id_t* plockID = SBXPlockIDMatrixAt(&data->plockIDMatrix, x, y);
+        if(*plockID == SBX_PLOCK_ID_UNSET) {
+            continue;
+        }
+
+        newPlocks[plockCount] = data->plockArray.plocks[SBX_PLOCK_ID_TO_INDEX(*plockID)];
+        *plockID = SBX_PLOCK_INDEX_TO_ID(plockCount);
+        plockCount++;
+    }
+
+    // Unset the remaining plocks and rebuild the free ID stack so the lowest free plock ID gets handed out first
+    data->plockArray.freeCount = 0;
+    for(SBX_plock_count_t i = SBX_CHUNK_PLOCK_COUNT; i > plockCount; i--) {
+        newPlocks[i - 1] = (SBX_plock_t){.type = SBX_PLOCK_TYPE_ID_UNSET, .temperature = SBX_TEMPERATURE_UNSET};
+        data->plockArray.freeIDs[data->plockArray.freeCount++] = SBX_PLOCK_INDEX_TO_ID(i - 1);
+    }
+
+    // Swap in the renumbered plock array, the tournament trees hold plock indices so they are built again
+    SBXAllocatorFree(data->allocator, SBX_MEMORY_SUBSYSTEM_PLOCK_ARRAY, data->plockArray.plocks, sizeof(SBX_plock_t) * SBX_CHUNK_PLOCK_COUNT);
+    data->plockArray.plocks = newPlocks;
+    data->spatiallyOrdered  = true;
+    SBXChunkDataBuildExtremes(data);
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_CHUNK_DEFRAGMENT_SUCCESSFUL
+    };
+}
+
+// Splitmix64 finalizer
+static inline uint64_t SBXChunkHashMix(uint64_t hash) {
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+    return hash ^ (hash >> 31);
+}
+
+uint64_t SBXChunkHashPlock(SBX_plock_count_t position, const SBX_plock_t* plock) {
+    // Mixed once over the position and type and once more with the temperature bits
+    double temperature = (double)plock->temperature;
+    uint64_t temperatureBits;
+    memcpy(&temperatureBits, &temperature, sizeof(temperatureBits));
+
+    return SBXChunkHashMix(SBXChunkHashPlockType(position, plock->type) ^ temperatureBits);
+}
+
+uint64_t SBXChunkHashPlockType(SBX_plock_count_t position, SBX_plock_type_id_t type) {
+    return SBXChunkHashMix(((uint64_t)position << 8) | type);
+}
+
+void SBXChunkDataUpdateExtremes(SBX_chunk_data_t* data, SBX_plock_count_t plockIndex) {
+    SBXChunkDataUpdateExtremesTree(data, data->minimumTree, plockIndex, false);
+    SBXChunkDataUpdateExtremesTree(data, data->maximumTree, plockIndex, true);
+}
+
+void SBXChunkDataGetExtremes(const SBX_chunk_data_t* data, SBX_plock_temperature_t* minimum, SBX_plock_temperature_t* maximum) {
+    // The root holds an unset index only when no plock is set
+    uint16_t lowest = data->minimumTree[1], highest = data->maximumTree[1];
+    *minimum = lowest  == SBX_CHUNK_PLOCK_COUNT ? SBX_TEMPERATURE_UNSET : data->plockArray.plocks[lowest].temperature;
+    *maximum = highest == SBX_CHUNK_PLOCK_COUNT ? SBX_TEMPERATURE_UNSET : data->plockArray.plocks[highest].temperature;
+}
+
+SBX_report_t SBXChunkDataRecountStats(SBX_chunk_data_t* data) {
+    // Check if required arguments are provided
+    if(data == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    data->plockCount    = 0;
+    data->thermalEnergy = 0.0L;
+
+    // Plocks with an unset type are free plock IDs
+    for(SBX_plock_count_t i = 0; i < data->plockArray.count; i++) {
+        SBX_plock_t* plock = &data->plockArray.plocks[i];
+        if(plock->type == SBX_PLOCK_TYPE_ID_UNSET) {
+            continue;
+        }
+
+        data->thermalEnergy += plock->temperature;
+        data->plockCount++;
+    }
+    SBXChunkDataBuildExtremes(data);
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_CHUNK_RECOUNT_STATS_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXChunkDataRecountHash(SBX_chunk_data_t* data) {
+    // Check if required arguments are provided
+    if(data == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // The hashes depend on positions, so they are summed over the plock ID matrix
+    data->contentHash = 0;
+    data->typeHash    = 0;
+    for(SBX_plock_count_t i = 0; i < SBX_CHUNK_PLOCK_COUNT; i++) {
+        SBX_plock_id_t plockID = *SBXPlockIDMatrixAt(&data->plockIDMatrix, i & SBX_CHUNK_MASK, i >> SBX_CHUNK_SHIFT);
+        if(plockID != SBX_PLOCK_ID_UNSET) {
+            SBX_plock_t* plock = &data->plockArray.plocks[SBX_PLOCK_ID_TO_INDEX(plockID)];
+            data->contentHash += SBXChunkHashPlock(i, plock);
+            data->typeHash    += SBXChunkHashPlockType(i, plock->type);
+        }
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_CHUNK_RECOUNT_HASH_SUCCESSFUL
+    };
+}
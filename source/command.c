@@ -0,0 +1,428 @@
+// Project headers
+#include <SBX/command.h>
+#include <SBX/strings.h>
+#include <SBX/box.h>
+
+// LibC headers
+#include <stdlib.h>
+#include <string.h>
+
+// Links a node into the queue, safe to call from any number of threads at once
+static void SBXBoxCommandQueuePush(SBX_box_command_queue_t* queue, SBX_box_command_t* command) {
+    atomic_store_explicit(&command->next, SBX_POINTER_UNSET, memory_order_relaxed);
+
+    // Claim the head first, then link the previous head to us, the consumer waits for the link if it catches up in between
+    SBX_box_command_t* previous = atomic_exchange_explicit(&queue->head, command, memory_order_acq_rel);
+    atomic_store_explicit(&previous->next, command, memory_order_release);
+}
+
+// Unlinks the oldest command, returns SBX_POINTER_UNSET when the queue is empty or the next command is still being linked
+static SBX_box_command_t* SBXBoxCommandQueuePop(SBX_box_command_queue_t* queue) {
+    SBX_box_command_t* tail = queue->tail;
+    SBX_box_command_t* next = atomic_load_explicit(&tail->next, memory_order_acquire);
+
+    // Step over the stub
+    if(tail == &queue->stub) {
+        if(next == SBX_POINTER_UNSET) {
+            return SBX_POINTER_UNSET;
+        }
+        queue->tail = next;
+        tail        = next;
+        next        = atomic_load_explicit(&tail->next, memory_order_acquire);
+    }
+
+    if(next != SBX_POINTER_UNSET) {
+        queue->tail = next;
+        return tail;
+    }
+
+    // The tail is the last linked command, leave it for the next drain if a producer is halfway through pushing after it
+    if(tail != atomic_load_explicit(&queue->head, memory_order_acquire)) {
+        return SBX_POINTER_UNSET;
+    }
+
+    // Put the stub back behind the tail so it can be unlinked
+    SBXBoxCommandQueuePush(queue, &queue->stub);
+    next = atomic_load_explicit(&tail->next, memory_order_acquire);
+    if(next != SBX_POINTER_UNSET) {
+        queue->tail = next;
+        return tail;
+    }
+
+    return SBX_POINTER_UNSET;
+}
+
+// Takes a spare node from the free list, SBX_POINTER_UNSET when it is empty, safe to call from any number of threads at once
+static SBX_box_command_t* SBXBoxCommandQueueTake(SBX_box_command_queue_t* queue) {
+    // Announce the take first, the consumer holds nodes back from the free list while any taker is between reading and swapping the head
+    atomic_fetch_add(&queue->freeTakers, 1);
+    SBX_box_command_t* node = atomic_load_explicit(&queue->freeHead, memory_order_acquire);
+    while((node != SBX_POINTER_UNSET) &&
+          !atomic_compare_exchange_weak_explicit(&queue->freeHead, &node, atomic_load_explicit(&node->next, memory_order_relaxed),
+                                                 memory_order_acquire, memory_order_acquire)) {
+    }
+    atomic_fetch_sub(&queue->freeTakers, 1);
+
+    if(node != SBX_POINTER_UNSET) {
+        atomic_fetch_sub_explicit(&queue->freeCount, 1, memory_order_relaxed);
+    }
+    return node;
+}
+
+// Links the nodes the consumer is done with into the free list, held back until no producer is taking a node
+static void SBXBoxCommandQueuePublish(SBX_box_command_queue_t* queue) {
+    if((queue->pendingHead == SBX_POINTER_UNSET) || atomic_load(&queue->freeTakers)) {
+        return;
+    }
+
+    atomic_fetch_add_explicit(&queue->freeCount, queue->pendingCount, memory_order_relaxed);
+    SBX_box_command_t* head = atomic_load_explicit(&queue->freeHead, memory_order_relaxed);
+    do {
+        atomic_store_explicit(&queue->pendingTail->next, head, memory_order_relaxed);
+    } while(!atomic_compare_exchange_weak_explicit(&queue->freeHead, &head, queue->pendingHead, memory_order_release, memory_order_relaxed));
+
+    queue->pendingHead  = SBX_POINTER_UNSET;
+    queue->pendingTail  = SBX_POINTER_UNSET;
+    queue->pendingCount = 0;
+}
+
+// Gives a node the consumer is done with back to the free list, or to its allocator when the free list has enough spare nodes
+static void SBXBoxCommandQueueRelease(SBX_box_command_queue_t* queue, SBX_box_command_t* node) {
+    if(atomic_load_explicit(&queue->freeCount, memory_order_relaxed) + queue->pendingCount >= queue->spareTarget) {
+        SBXAllocatorFree(node->allocator, SBX_MEMORY_SUBSYSTEM_COMMAND, node, sizeof(SBX_box_command_t));
+        return;
+    }
+
+    atomic_store_explicit(&node->next, queue->pendingHead, memory_order_relaxed);
+    queue->pendingTail = queue->pendingHead == SBX_POINTER_UNSET ? node : queue->pendingTail;
+    queue->pendingHead = node;
+    queue->pendingCount++;
+}
+
+// Tops the free list up to the spare target from the queue allocator, only called by the consumer
+static void SBXBoxCommandQueueRefill(SBX_box_command_queue_t* queue) {
+    while(atomic_load_explicit(&queue->freeCount, memory_order_relaxed) + queue->pendingCount < queue->spareTarget) {
+        SBX_box_command_t* node = SBXAllocatorAllocate(queue->allocator, SBX_MEMORY_SUBSYSTEM_COMMAND, sizeof(SBX_box_command_t));
+        if(node == SBX_POINTER_UNSET) {
+            break;
+        }
+        node->allocator = queue->allocator;
+        SBXBoxCommandQueueRelease(queue, node);
+    }
+    SBXBoxCommandQueuePublish(queue);
+}
+
+// Finds the cell of a position for the current coalescing pass, claiming an empty one if the position has none yet
+static SBX_box_command_cell_t* SBXBoxCommandCellFind(SBX_box_t* box, uint32_t key) {
+    uint32_t mask = box->commandCellCapacity - 1;
+    for(uint32_t i = (key * 2654435761u) & mask;; i = (i + 1) & mask) {
+        SBX_box_command_cell_t* cell = &box->commandCells[i];
+        if(cell->generation != box->commandGeneration) {
+            *cell = (SBX_box_command_cell_t){.key = key, .generation = box->commandGeneration, .painted = false, .heated = false};
+            return cell;
+        }
+        if(cell->key == key) {
+            return cell;
+        }
+    }
+}
+
+// Starts a new coalescing pass, cells of earlier passes become empty without touching them
+static void SBXBoxCommandNextGeneration(SBX_box_t* box) {
+    if(!++box->commandGeneration) {
+        memset(box->commandCells, 0, sizeof(SBX_box_command_cell_t) * box->commandCellCapacity);
+        box->commandGeneration = 1;
+    }
+}
+
+// Applies one command to the box
+static SBX_report_t SBXBoxCommandApply(SBX_box_t* box, SBX_box_command_t* command) {
+    switch(command->type) {
+        case SBX_BOX_COMMAND_PAINT:
+            // Command positions are never checked before this, so this always takes the validated call, even with SBX_UNCHECKED_API
+            return (SBXBoxSetPlock)(box, command->x, command->y, command->plock);
+
+        case SBX_BOX_COMMAND_FILL: {
+            // Clip the rectangle to the box
+            uint32_t right  = (uint32_t)command->x + command->width;
+            uint32_t bottom = (uint32_t)command->y + command->height;
+            right  = right  < box->width  ? right  : box->width;
+            bottom = bottom < box->height ? bottom : box->height;
+
+            for(uint32_t y = command->y; y < bottom; y++) {
+                for(uint32_t x = command->x; x < right; x++) {
+                    SBX_report_t report = SBXBoxSetPlock(box, (SBX_box_position_t)x, (SBX_box_position_t)y, command->plock);
+                    if(report.errorFlags) {
+                        return report;
+                    }
+                }
+            }
+            return (SBX_report_t){
+                .errorFlags    = 0,
+                .reportMessage = SBX_REPORT_STRING_BOX_APPLY_COMMANDS_SUCCESSFUL
+            };
+        }
+
+        case SBX_BOX_COMMAND_SET_TEMPERATURE: {
+            SBX_plock_t plock;
+            SBX_report_t report = (SBXBoxGetPlock)(box, command->x, command->y, &plock);
+            if(report.errorFlags || (plock.type == SBX_PLOCK_TYPE_ID_UNSET)) {
+                return report;
+            }
+            plock.temperature = command->plock.temperature;
+            return SBXBoxSetPlock(box, command->x, command->y, plock);
+        }
+
+        case SBX_BOX_COMMAND_RESIZE:
+            return SBXBoxSetSize(box, command->width, command->height);
+
+        default:
+            return (SBX_report_t){
+                .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+                .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+            };
+    }
+}
+
+SBX_report_t SBXBoxCommandQueueInit(SBX_box_command_queue_t* queue, SBX_allocator_t* allocator) {
+    // Check if required arguments are provided
+    if(queue == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // The queue starts out holding only the stub
+    atomic_init(&queue->stub.next, SBX_POINTER_UNSET);
+    atomic_init(&queue->head, &queue->stub);
+    queue->tail           = &queue->stub;
+    queue->stub.allocator = SBX_POINTER_UNSET;
+
+    // Fill the free list, producers fall back to the allocator itself if a burst empties it
+    queue->allocator    = allocator;
+    atomic_init(&queue->freeHead, SBX_POINTER_UNSET);
+    atomic_init(&queue->freeTakers, 0);
+    atomic_init(&queue->freeCount, 0);
+    queue->pendingHead  = SBX_POINTER_UNSET;
+    queue->pendingTail  = SBX_POINTER_UNSET;
+    queue->pendingCount = 0;
+    queue->spareTarget  = SBX_BOX_COMMAND_SPARE_NODES;
+    SBXBoxCommandQueueRefill(queue);
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_COMMAND_QUEUE_INIT_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxCommandQueueDeinit(SBX_box_command_queue_t* queue) {
+    // Check if required arguments are provided
+    if(queue == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // No producer is left, so the free list and the nodes held back from it are freed alike
+    SBX_box_command_t* lists[2] = {atomic_exchange(&queue->freeHead, SBX_POINTER_UNSET), queue->pendingHead};
+    for(uint32_t i = 0; i < 2; i++) {
+        while(lists[i] != SBX_POINTER_UNSET) {
+            SBX_box_command_t* node = lists[i];
+            lists[i] = atomic_load_explicit(&node->next, memory_order_relaxed);
+            SBXAllocatorFree(node->allocator, SBX_MEMORY_SUBSYSTEM_COMMAND, node, sizeof(SBX_box_command_t));
+        }
+    }
+    atomic_store(&queue->freeCount, 0);
+    queue->pendingHead  = SBX_POINTER_UNSET;
+    queue->pendingTail  = SBX_POINTER_UNSET;
+    queue->pendingCount = 0;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_COMMAND_QUEUE_DEINIT_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxPushCommand(SBX_box_t* box, SBX_box_command_t command) {
+    // Check if required arguments are provided
+    if(box == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Take a spare queue node, a burst that emptied the free list within a tick takes one from the queue allocator,
+    // so it still counts against the budget and the command subsystem of the box
+    SBX_box_command_t* node = SBXBoxCommandQueueTake(&box->commandQueue);
+    if(node == SBX_POINTER_UNSET) {
+        node = SBXAllocatorAllocate(box->commandQueue.allocator, SBX_MEMORY_SUBSYSTEM_COMMAND, sizeof(SBX_box_command_t));
+
+        // Check for a memory allocation error
+        if(node == SBX_POINTER_UNSET) {
+            // Return error
+            return (SBX_report_t){
+                .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+                .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+            };
+        }
+        node->allocator = box->commandQueue.allocator;
+    }
+
+    // Copy the command, the next and allocator members belong to the queue
+    node->type   = command.type;
+    node->x      = command.x;
+    node->y      = command.y;
+    node->width  = command.width;
+    node->height = command.height;
+    node->plock  = command.plock;
+    SBXBoxCommandQueuePush(&box->commandQueue, node);
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_PUSH_COMMAND_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxApplyCommands(SBX_box_t* box) {
+    // Check if required arguments are provided
+    if(box == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for box initialized
+    if(!box->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_NOT_INIT,
+            .reportMessage = SBX_REPORT_STRING_BOX_NOT_INIT
+        };
+    }
+
+    SBX_report_t report = {
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_APPLY_COMMANDS_SUCCESSFUL
+    };
+
+    // Drain the queue into the batch up to the command that was pushed last when the drain started, so producers that keep pushing
+    // can't hold the tick up, later commands and commands that can't fit stay queued for the next tick. When that was the stub,
+    // the drain ends once the consumer reaches it
+    SBX_box_command_queue_t* queue = &box->commandQueue;
+    SBX_box_command_t* last = atomic_load_explicit(&queue->head, memory_order_acquire);
+    uint32_t count = 0;
+    for(SBX_box_command_t* command = SBX_POINTER_UNSET; (command != last) && ((last != &queue->stub) || (queue->tail != last));) {
+        if(count == box->commandBatchCapacity) {
+            uint32_t capacity = box->commandBatchCapacity ? box->commandBatchCapacity * 2 : 64;
+            SBX_box_command_t** batch = SBXAllocatorReallocate(box->allocator, SBX_MEMORY_SUBSYSTEM_COMMAND, box->commandBatch,
+                                                               sizeof(SBX_box_command_t*) * box->commandBatchCapacity, sizeof(SBX_box_command_t*) * capacity);
+            if(batch == SBX_POINTER_UNSET) {
+                report = (SBX_report_t){
+                    .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+                    .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+                };
+                break;
+            }
+            box->commandBatch         = batch;
+            box->commandBatchCapacity = capacity;
+        }
+
+        command = SBXBoxCommandQueuePop(queue);
+        if(command == SBX_POINTER_UNSET) {
+            break;
+        }
+        box->commandBatch[count++] = command;
+    }
+
+    // Keep as many spare nodes as this tick used, so a tick like it pushes without ever running the free list dry
+    box->commandQueue.spareTarget = count > SBX_BOX_COMMAND_SPARE_NODES ? count : SBX_BOX_COMMAND_SPARE_NODES;
+    if(!count) {
+        SBXBoxCommandQueueRefill(&box->commandQueue);
+        return report;
+    }
+
+    // Make sure the cell table is at most half full, coalescing is skipped if it can't grow
+    SBX_bool_t coalesce = box->commandCellCapacity >= count * 2;
+    if(!coalesce) {
+        uint32_t capacity = box->commandCellCapacity ? box->commandCellCapacity : 256;
+        while(capacity < count * 2) {
+            capacity *= 2;
+        }
+        SBX_box_command_cell_t* cells = SBXAllocatorAllocate(box->allocator, SBX_MEMORY_SUBSYSTEM_COMMAND, sizeof(SBX_box_command_cell_t) * capacity);
+        if(cells != SBX_POINTER_UNSET) {
+            memset(cells, 0, sizeof(SBX_box_command_cell_t) * capacity);
+            SBXAllocatorFree(box->allocator, SBX_MEMORY_SUBSYSTEM_COMMAND, box->commandCells, sizeof(SBX_box_command_cell_t) * box->commandCellCapacity);
+            box->commandCells        = cells;
+            box->commandCellCapacity = capacity;
+            box->commandGeneration   = 0;
+            coalesce                 = true;
+        }
+    }
+
+    // Walk the batch backwards dropping paints and temperatures a later command on the same position overwrites,
+    // fills and resizes end a coalescing pass since they can change any position
+    if(coalesce) {
+        SBXBoxCommandNextGeneration(box);
+        for(uint32_t i = count; i-- > 0;) {
+            SBX_box_command_t* command = box->commandBatch[i];
+            if((command->type != SBX_BOX_COMMAND_PAINT) && (command->type != SBX_BOX_COMMAND_SET_TEMPERATURE)) {
+                SBXBoxCommandNextGeneration(box);
+                continue;
+            }
+
+            SBX_box_command_cell_t* cell = SBXBoxCommandCellFind(box, ((uint32_t)command->y << 16) | command->x);
+            SBX_bool_t shadowed = cell->painted || ((command->type == SBX_BOX_COMMAND_SET_TEMPERATURE) && cell->heated);
+            cell->painted |= command->type == SBX_BOX_COMMAND_PAINT;
+            cell->heated  |= command->type == SBX_BOX_COMMAND_SET_TEMPERATURE;
+            if(shadowed) {
+                SBXBoxCommandQueueRelease(&box->commandQueue, command);
+                box->commandBatch[i] = SBX_POINTER_UNSET;
+            }
+        }
+    }
+
+    // Apply what is left in push order
+    for(uint32_t i = 0; i < count; i++) {
+        SBX_box_command_t* command = box->commandBatch[i];
+        if(command == SBX_POINTER_UNSET) {
+            continue;
+        }
+
+        SBX_report_t commandReport = SBXBoxCommandApply(box, command);
+        if(commandReport.errorFlags && !report.errorFlags) {
+            report = commandReport;
+        }
+        SBXBoxCommandQueueRelease(&box->commandQueue, command);
+    }
+    SBXBoxCommandQueueRefill(&box->commandQueue);
+
+    return report;
+}
+
+SBX_report_t SBXBoxDiscardCommands(SBX_box_t* box) {
+    // Check if required arguments are provided
+    if(box == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    for(SBX_box_command_t* command = SBXBoxCommandQueuePop(&box->commandQueue); command != SBX_POINTER_UNSET;
+        command = SBXBoxCommandQueuePop(&box->commandQueue)) {
+        SBXBoxCommandQueueRelease(&box->commandQueue, command);
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_DISCARD_COMMANDS_SUCCESSFUL
+    };
+}
@@ -0,0 +1,563 @@
+// Project headers
+#include <SBX/components.h>
+#include <SBX/strings.h>
+#include <SBX/chunk.h>
+#include <SBX/plock.h>
+#include <SBX/workers.h>
+
+// LibC headers
+#include <stdatomic.h>
+#include <string.h>
+
+// Work shared by the workers labeling the changed chunk list
+typedef struct SBXComponentLabelsJob {
+    SBX_component_labels_t* labels;
+    SBX_box_t*              box;
+    atomic_bool             failed;
+} SBX_component_labels_job_t;
+
+// Finds the root of a label, halving the path on the way up
+static inline uint32_t SBXComponentLabelsFind16(uint16_t* parents, uint32_t label) {
+    while(parents[label] != label) {
+        parents[label] = parents[parents[label]];
+        label          = parents[label];
+    }
+    return label;
+}
+
+static inline uint32_t SBXComponentLabelsFind(uint32_t* parents, uint32_t label) {
+    while(parents[label] != label) {
+        parents[label] = parents[parents[label]];
+        label          = parents[label];
+    }
+    return label;
+}
+
+// Joins the trees of two labels, the smaller root wins so roots always come before the labels below them
+static inline uint32_t SBXComponentLabelsUnion16(uint16_t* parents, uint32_t a, uint32_t b) {
+    a = SBXComponentLabelsFind16(parents, a);
+    b = SBXComponentLabelsFind16(parents, b);
+    if(a < b) {
+        parents[b] = (uint16_t)a;
+        return a;
+    }
+    parents[a] = (uint16_t)b;
+    return b;
+}
+
+static inline void SBXComponentLabelsUnion(uint32_t* parents, uint32_t a, uint32_t b) {
+    a = SBXComponentLabelsFind(parents, a);
+    b = SBXComponentLabelsFind(parents, b);
+    if(a < b) {
+        parents[b] = a;
+    } else {
+        parents[a] = b;
+    }
+}
+
+// Widens a component to cover another one of the same class
+static void SBXComponentLabelsMerge(SBX_component_t* component, const SBX_component_t* piece) {
+    if(!component->plockCount) {
+        *component = *piece;
+        return;
+    }
+    component->plockCount += piece->plockCount;
+    component->minimumX    = piece->minimumX < component->minimumX ? piece->minimumX : component->minimumX;
+    component->minimumY    = piece->minimumY < component->minimumY ? piece->minimumY : component->minimumY;
+    component->maximumX    = piece->maximumX > component->maximumX ? piece->maximumX : component->maximumX;
+    component->maximumY    = piece->maximumY > component->maximumY ? piece->maximumY : component->maximumY;
+}
+
+// Frees the labels and pieces of one chunk
+static void SBXComponentLabelsClearChunk(SBX_component_chunk_t* chunk) {
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_COMPONENTS, chunk->pieceLabels, SBX_CHUNK_PLOCK_COUNT * sizeof(uint16_t));
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_COMPONENTS, chunk->pieces, chunk->pieceCount * sizeof(SBX_component_t));
+    chunk->pieceLabels = SBX_POINTER_UNSET;
+    chunk->pieces      = SBX_POINTER_UNSET;
+    chunk->pieceCount  = 0;
+}
+
+// Frees the labels of every chunk and the chunk list
+static void SBXComponentLabelsFreeChunks(SBX_component_labels_t* labels) {
+    SBX_chunk_index_t chunkCount = (SBX_chunk_index_t)labels->chunkColumns * labels->chunkRows;
+    if(labels->chunks != SBX_POINTER_UNSET) {
+        for(SBX_chunk_index_t i = 0; i < chunkCount; i++) {
+            SBXComponentLabelsClearChunk(&labels->chunks[i]);
+        }
+    }
+
+    // Layouts without chunks still hold one entry
+    size_t entries = chunkCount ? chunkCount : 1;
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_COMPONENTS, labels->chunks, entries * sizeof(SBX_component_chunk_t));
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_COMPONENTS, labels->changedChunks, entries * sizeof(SBX_chunk_index_t));
+    labels->chunks        = SBX_POINTER_UNSET;
+    labels->changedChunks = SBX_POINTER_UNSET;
+}
+
+// Labels the plocks of one chunk with two raster passes over its plock ID matrix, only the chunk's own labels are written so chunks can be labeled in parallel
+static SBX_bool_t SBXComponentLabelsLabelChunk(SBX_component_labels_t* labels, SBX_box_t* box, SBX_chunk_index_t chunkIndex) {
+    SBX_component_chunk_t* chunk = &labels->chunks[chunkIndex];
+    SBX_chunk_data_t*      data  = box->chunks[chunkIndex].data;
+
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_COMPONENTS, chunk->pieces, chunk->pieceCount * sizeof(SBX_component_t));
+    chunk->pieces     = SBX_POINTER_UNSET;
+    chunk->pieceCount = 0;
+    chunk->hash       = data == SBX_POINTER_UNSET ? 0 : data->typeHash;
+    if((data == SBX_POINTER_UNSET) || !data->plockCount) {
+        SBXComponentLabelsClearChunk(chunk);
+        return true;
+    }
+    if(chunk->pieceLabels == SBX_POINTER_UNSET) {
+        chunk->pieceLabels = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_COMPONENTS, SBX_CHUNK_PLOCK_COUNT * sizeof(uint16_t));
+        if(chunk->pieceLabels == SBX_POINTER_UNSET) {
+            return false;
+        }
+    }
+
+    // Every position can start its own label when neighbors alternate classes
+    uint16_t              parents[SBX_CHUNK_PLOCK_COUNT + 1];
+    SBX_component_class_t cellClasses[SBX_CHUNK_PLOCK_COUNT];
+    uint16_t*             pieceLabels = chunk->pieceLabels;
+    uint32_t              labelCount  = 0;
+
+    // First pass, give every plock the label of a matching left or up neighbor and record which labels meet
+    for(uint32_t y = 0; y < SBX_CHUNK_SIZE; y++) {
+        for(uint32_t x = 0; x < SBX_CHUNK_SIZE; x++) {
+            uint32_t       i  = y * SBX_CHUNK_SIZE + x;
+            SBX_plock_id_t id = *SBXPlockIDMatrixAt(&data->plockIDMatrix, x, y);
+            SBX_component_class_t class = id == SBX_PLOCK_ID_UNSET ? SBX_COMPONENT_CLASS_NONE
+                                                                   : labels->classes[data->plockArray.plocks[SBX_PLOCK_ID_TO_INDEX(id)].type];
+            cellClasses[i] = class;
+            if(class == SBX_COMPONENT_CLASS_NONE) {
+                pieceLabels[i] = 0;
+                continue;
+            }
+
+            uint32_t left = (x > 0) && (cellClasses[i - 1] == class) ? pieceLabels[i - 1] : 0;
+            uint32_t up   = (y > 0) && (cellClasses[i - SBX_CHUNK_SIZE] == class) ? pieceLabels[i - SBX_CHUNK_SIZE] : 0;
+            if(left && up) {
+                pieceLabels[i] = (uint16_t)SBXComponentLabelsUnion16(parents, left, up);
+            } else if(left || up) {
+                pieceLabels[i] = (uint16_t)(left | up);
+            } else {
+                labelCount++;
+                parents[labelCount] = (uint16_t)labelCount;
+                pieceLabels[i]      = (uint16_t)labelCount;
+            }
+        }
+    }
+
+    // Every root becomes one piece
+    for(uint32_t label = 1; label <= labelCount; label++) {
+        if(parents[label] == label) {
+            chunk->pieceCount++;
+        }
+    }
+    if(!chunk->pieceCount) {
+        return true;
+    }
+    chunk->pieces = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_COMPONENTS, chunk->pieceCount * sizeof(SBX_component_t));
+    if(chunk->pieces == SBX_POINTER_UNSET) {
+        chunk->pieceCount = 0;
+        return false;
+    }
+    memset(chunk->pieces, 0, chunk->pieceCount * sizeof(SBX_component_t));
+
+    // Number the pieces in order of their roots, a root always comes before the labels below it
+    uint16_t pieceOf[SBX_CHUNK_PLOCK_COUNT + 1];
+    uint32_t pieceCount = 0;
+    for(uint32_t label = 1; label <= labelCount; label++) {
+        uint32_t root  = SBXComponentLabelsFind16(parents, label);
+        pieceOf[label] = root == label ? (uint16_t)++pieceCount : pieceOf[root];
+    }
+
+    // Second pass, replace labels with pieces and measure the pieces
+    SBX_box_position_t chunkX = (chunkIndex % box->chunkColumns) << SBX_CHUNK_SHIFT;
+    SBX_box_position_t chunkY = (chunkIndex / box->chunkColumns) << SBX_CHUNK_SHIFT;
+    for(uint32_t y = 0; y < SBX_CHUNK_SIZE; y++) {
+        for(uint32_t x = 0; x < SBX_CHUNK_SIZE; x++) {
+            uint32_t i = y * SBX_CHUNK_SIZE + x;
+            if(!pieceLabels[i]) {
+                continue;
+            }
+
+            uint16_t piece = pieceOf[pieceLabels[i]];
+            pieceLabels[i] = piece;
+            SBXComponentLabelsMerge(&chunk->pieces[piece - 1], &(SBX_component_t){
+                .class      = cellClasses[i],
+                .plockCount = 1,
+                .minimumX   = chunkX + x,
+                .minimumY   = chunkY + y,
+                .maximumX   = chunkX + x,
+                .maximumY   = chunkY + y
+            });
+        }
+    }
+
+    return true;
+}
+
+// Worker pool job, labels one chunk of the changed chunk list
+static void SBXComponentLabelsJob(void* userData, uint32_t item, uint32_t worker) {
+    (void)worker;
+    SBX_component_labels_job_t* job = userData;
+    if(!SBXComponentLabelsLabelChunk(job->labels, job->box, job->labels->changedChunks[item])) {
+        atomic_store_explicit(&job->failed, true, memory_order_relaxed);
+    }
+}
+
+// Lays the chunk labels out again when the chunk table changed size, every chunk is labeled again
+static SBX_report_t SBXComponentLabelsFit(SBX_component_labels_t* labels, SBX_box_t* box) {
+    if((labels->chunks != SBX_POINTER_UNSET) && (labels->boxWidth == box->width) && (labels->boxHeight == box->height) &&
+       (labels->chunkColumns == box->chunkColumns) && (labels->chunkRows == box->chunkRows)) {
+        return (SBX_report_t){
+            .errorFlags    = 0,
+            .reportMessage = SBX_REPORT_STRING_COMPONENT_LABELS_UPDATE_SUCCESSFUL
+        };
+    }
+
+    SBXComponentLabelsFreeChunks(labels);
+    labels->boxWidth     = box->width;
+    labels->boxHeight    = box->height;
+    labels->chunkColumns = box->chunkColumns;
+    labels->chunkRows    = box->chunkRows;
+    labels->stale        = true;
+
+    // Keep one entry even for boxes without chunks so a fitted layout always has a chunk list
+    SBX_chunk_index_t chunkCount = (SBX_chunk_index_t)box->chunkColumns * box->chunkRows;
+    size_t            entries    = chunkCount ? chunkCount : 1;
+    labels->chunks        = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_COMPONENTS, entries * sizeof(SBX_component_chunk_t));
+    labels->changedChunks = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_COMPONENTS, entries * sizeof(SBX_chunk_index_t));
+
+    // Check for a memory allocation error
+    if(!labels->chunks || !labels->changedChunks) {
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_COMPONENTS, labels->chunks, entries * sizeof(SBX_component_chunk_t));
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_COMPONENTS, labels->changedChunks, entries * sizeof(SBX_chunk_index_t));
+        labels->chunks        = SBX_POINTER_UNSET;
+        labels->changedChunks = SBX_POINTER_UNSET;
+        labels->chunkColumns  = 0;
+        labels->chunkRows     = 0;
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+    memset(labels->chunks, 0, entries * sizeof(SBX_component_chunk_t));
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMPONENT_LABELS_UPDATE_SUCCESSFUL
+    };
+}
+
+// Joins the pieces of every chunk across chunk edges and numbers the resulting components
+static SBX_report_t SBXComponentLabelsJoin(SBX_component_labels_t* labels) {
+    SBX_chunk_index_t chunkCount = (SBX_chunk_index_t)labels->chunkColumns * labels->chunkRows;
+    SBX_component_chunk_t* chunks = labels->chunks;
+
+    // Lay every piece out in one table
+    uint32_t pieceCount = 0;
+    for(SBX_chunk_index_t i = 0; i < chunkCount; i++) {
+        chunks[i].firstPiece = pieceCount;
+        pieceCount          += chunks[i].pieceCount;
+    }
+    if(pieceCount > labels->pieceCapacity) {
+        uint32_t capacity = labels->pieceCapacity ? labels->pieceCapacity : 64;
+        while(capacity < pieceCount) {
+            capacity *= 2;
+        }
+
+        uint32_t*           parents         = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_COMPONENTS, capacity * sizeof(uint32_t));
+        SBX_component_id_t* pieceComponents = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_COMPONENTS, capacity * sizeof(SBX_component_id_t));
+        if(!parents || !pieceComponents) {
+            SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_COMPONENTS, parents, capacity * sizeof(uint32_t));
+            SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_COMPONENTS, pieceComponents, capacity * sizeof(SBX_component_id_t));
+
+            // Return error
+            return (SBX_report_t){
+                .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+                .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+            };
+        }
+
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_COMPONENTS, labels->parents, labels->pieceCapacity * sizeof(uint32_t));
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_COMPONENTS, labels->pieceComponents, labels->pieceCapacity * sizeof(SBX_component_id_t));
+        labels->parents         = parents;
+        labels->pieceComponents = pieceComponents;
+        labels->pieceCapacity   = capacity;
+    }
+
+    uint32_t* parents = labels->parents;
+    for(uint32_t i = 0; i < pieceCount; i++) {
+        parents[i] = i;
+    }
+
+    // Join pieces of the same class that touch across the right and bottom edge of every chunk
+    for(SBX_chunk_index_t i = 0; i < chunkCount; i++) {
+        SBX_component_chunk_t* chunk = &chunks[i];
+        if(!chunk->pieceCount) {
+            continue;
+        }
+
+        SBX_component_chunk_t* right  = (i % labels->chunkColumns) + 1 < labels->chunkColumns ? &chunks[i + 1] : SBX_POINTER_UNSET;
+        SBX_component_chunk_t* bottom = (i / labels->chunkColumns) + 1 < labels->chunkRows ? &chunks[i + labels->chunkColumns] : SBX_POINTER_UNSET;
+        for(uint32_t j = 0; j < SBX_CHUNK_SIZE; j++) {
+            if((right != SBX_POINTER_UNSET) && right->pieceCount) {
+                uint16_t a = chunk->pieceLabels[j * SBX_CHUNK_SIZE + SBX_CHUNK_MASK];
+                uint16_t b = right->pieceLabels[j * SBX_CHUNK_SIZE];
+                if(a && b && (chunk->pieces[a - 1].class == right->pieces[b - 1].class)) {
+                    SBXComponentLabelsUnion(parents, chunk->firstPiece + a - 1, right->firstPiece + b - 1);
+                }
+            }
+            if((bottom != SBX_POINTER_UNSET) && bottom->pieceCount) {
+                uint16_t a = chunk->pieceLabels[SBX_CHUNK_MASK * SBX_CHUNK_SIZE + j];
+                uint16_t b = bottom->pieceLabels[j];
+                if(a && b && (chunk->pieces[a - 1].class == bottom->pieces[b - 1].class)) {
+                    SBXComponentLabelsUnion(parents, chunk->firstPiece + a - 1, bottom->firstPiece + b - 1);
+                }
+            }
+        }
+    }
+
+    // Number the roots, a root always comes before the pieces below it
+    SBX_component_id_t componentCount = 0;
+    for(uint32_t i = 0; i < pieceCount; i++) {
+        uint32_t root = SBXComponentLabelsFind(parents, i);
+        labels->pieceComponents[i] = root == i ? ++componentCount : labels->pieceComponents[root];
+    }
+
+    if(componentCount > labels->componentCapacity) {
+        SBX_component_id_t capacity = labels->componentCapacity ? labels->componentCapacity : 64;
+        while(capacity < componentCount) {
+            capacity *= 2;
+        }
+
+        SBX_component_t* components = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_COMPONENTS, capacity * sizeof(SBX_component_t));
+        if(components == SBX_POINTER_UNSET) {
+            // Return error
+            return (SBX_report_t){
+                .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+                .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+            };
+        }
+
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_COMPONENTS, labels->components, labels->componentCapacity * sizeof(SBX_component_t));
+        labels->components        = components;
+        labels->componentCapacity = capacity;
+    }
+
+    // Sum the pieces into their components
+    if(componentCount) {
+        memset(labels->components, 0, componentCount * sizeof(SBX_component_t));
+    }
+    for(SBX_chunk_index_t i = 0; i < chunkCount; i++) {
+        for(uint32_t j = 0; j < chunks[i].pieceCount; j++) {
+            SBX_component_id_t componentID = labels->pieceComponents[chunks[i].firstPiece + j];
+            SBXComponentLabelsMerge(&labels->components[componentID - 1], &chunks[i].pieces[j]);
+        }
+    }
+    labels->componentCount = componentCount;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMPONENT_LABELS_UPDATE_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXComponentLabelsCreate(SBX_component_labels_t** labels, const SBX_component_class_t* classes) {
+    // Check if required arguments are provided
+    if((labels == SBX_POINTER_UNSET) || (classes == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Allocate memory for the SBXComponentLabels struture, the chunk labels are allocated once a box is known
+    *labels = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_COMPONENTS, sizeof(SBX_component_labels_t));
+
+    // Check for a memory allocation error
+    if(!*labels) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    memset(*labels, 0, sizeof(SBX_component_labels_t));
+    memcpy((*labels)->classes, classes, sizeof((*labels)->classes));
+    (*labels)->stale = true;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMMON_CREATION_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXComponentLabelsDestroy(SBX_component_labels_t* labels) {
+    // Check if required arguments are provided
+    if(labels == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    SBXComponentLabelsFreeChunks(labels);
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_COMPONENTS, labels->parents, labels->pieceCapacity * sizeof(uint32_t));
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_COMPONENTS, labels->pieceComponents, labels->pieceCapacity * sizeof(SBX_component_id_t));
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_COMPONENTS, labels->components, labels->componentCapacity * sizeof(SBX_component_t));
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_COMPONENTS, labels, sizeof(SBX_component_labels_t));
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMMON_DESTRUCTION_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXComponentLabelsSetClasses(SBX_component_labels_t* labels, const SBX_component_class_t* classes) {
+    // Check if required arguments are provided
+    if((labels == SBX_POINTER_UNSET) || (classes == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    memcpy(labels->classes, classes, sizeof(labels->classes));
+    labels->stale = true;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMPONENT_LABELS_SET_CLASSES_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXComponentLabelsUpdate(SBX_component_labels_t* labels, SBX_box_t* box) {
+    // Check if required arguments are provided
+    if((labels == SBX_POINTER_UNSET) || (box == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for box initialized
+    if(!box->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_NOT_INIT,
+            .reportMessage = SBX_REPORT_STRING_BOX_NOT_INIT
+        };
+    }
+
+    SBX_report_t report = SBXComponentLabelsFit(labels, box);
+    if(report.errorFlags) {
+        return report;
+    }
+
+    // Find the chunks whose plock types changed since they were labeled, classes only depend on types so temperature changes are skipped
+    SBX_chunk_index_t chunkCount  = (SBX_chunk_index_t)box->chunkColumns * box->chunkRows;
+    SBX_chunk_index_t changeCount = 0;
+    for(SBX_chunk_index_t i = 0; i < chunkCount; i++) {
+        SBX_chunk_data_t* data = box->chunks[i].data;
+        uint64_t          hash = data == SBX_POINTER_UNSET ? 0 : data->typeHash;
+        if(labels->stale || (labels->chunks[i].hash != hash)) {
+            labels->changedChunks[changeCount++] = i;
+        }
+    }
+
+    // Label the changed chunks on the worker pool of the box when there are enough of them, each chunk on its home worker
+    SBX_component_labels_job_t job = {.labels = labels, .box = box};
+    atomic_init(&job.failed, false);
+    SBX_bool_t labeled = false;
+    if((box->workers != SBX_POINTER_UNSET) && (changeCount >= SBX_COMPONENT_LABELS_PARALLEL_MINIMUM)) {
+        labeled = !SBXWorkersRun(box->workers, box, labels->changedChunks, changeCount, SBXComponentLabelsJob, &job).errorFlags;
+    }
+    // Fall back to this thread without a pool or if the pool can't take the chunks
+    if(!labeled) {
+        for(SBX_chunk_index_t i = 0; i < changeCount; i++) {
+            SBXComponentLabelsJob(&job, i, 0);
+        }
+    }
+    SBX_bool_t failed = atomic_load(&job.failed);
+    labels->relabeledChunkCount = changeCount;
+
+    // Chunks that failed to label have no pieces, label everything again next time
+    labels->stale = failed;
+    report = SBXComponentLabelsJoin(labels);
+    if(failed && !report.errorFlags) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+    if(report.errorFlags) {
+        labels->stale          = true;
+        labels->componentCount = 0;
+    }
+
+    return report;
+}
+
+SBX_report_t SBXComponentLabelsGetID(SBX_component_labels_t* labels, SBX_box_position_t x, SBX_box_position_t y, SBX_component_id_t* componentID) {
+    // Check if required arguments are provided
+    if((labels == SBX_POINTER_UNSET) || (componentID == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for position inside the labeled box
+    if((labels->chunks == SBX_POINTER_UNSET) || (x >= labels->boxWidth) || (y >= labels->boxHeight)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_OUT_OF_BOUNDS,
+            .reportMessage = SBX_REPORT_STRING_BOX_OUT_OF_BOUNDS
+        };
+    }
+
+    SBX_component_chunk_t* chunk = &labels->chunks[(y >> SBX_CHUNK_SHIFT) * labels->chunkColumns + (x >> SBX_CHUNK_SHIFT)];
+    // A failed update leaves no components to look pieces up in
+    uint16_t piece = chunk->pieceCount && labels->componentCount ? chunk->pieceLabels[(y & SBX_CHUNK_MASK) * SBX_CHUNK_SIZE + (x & SBX_CHUNK_MASK)] : 0;
+    *componentID = piece ? labels->pieceComponents[chunk->firstPiece + piece - 1] : SBX_COMPONENT_ID_UNSET;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMPONENT_LABELS_GET_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXComponentLabelsGetComponent(SBX_component_labels_t* labels, SBX_component_id_t componentID, SBX_component_t* component) {
+    // Check if required arguments are provided
+    if((labels == SBX_POINTER_UNSET) || (component == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for a component found by the last update
+    if((componentID == SBX_COMPONENT_ID_UNSET) || (componentID > labels->componentCount)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_OUT_OF_BOUNDS,
+            .reportMessage = SBX_REPORT_STRING_BOX_OUT_OF_BOUNDS
+        };
+    }
+
+    *component = labels->components[componentID - 1];
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMPONENT_LABELS_GET_SUCCESSFUL
+    };
+}
@@ -0,0 +1,368 @@
+// Project headers
+#include <SBX/frame.h>
+#include <SBX/strings.h>
+#include <SBX/allocator.h>
+#include <SBX/command.h>
+#include <SBX/changes.h>
+#include <SBX/thermal.h>
+#include <SBX/pyramid.h>
+#include <SBX/workers.h>
+
+// LibC headers
+#include <string.h>
+#include <time.h>
+
+// Reads the current time in nanoseconds
+static uint64_t SBXFrameNow(void) {
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+// Keeps the first error of a stage
+static void SBXFrameReport(SBX_frame_t* frame, uint32_t stage, SBX_report_t report) {
+    if(report.errorFlags && !frame->reports[stage].errorFlags) {
+        frame->reports[stage] = report;
+    }
+}
+
+// Task working out the temperature changes of one working chunk
+static void SBXFrameThermalComputeTask(void* userData, uint32_t argument) {
+    SBX_frame_t* frame = userData;
+    SBXBoxThermalComputeChunk(frame->box, argument);
+}
+
+// Task writing the temperature changes of one working chunk, these run one after the other
+static void SBXFrameThermalApplyTask(void* userData, uint32_t argument) {
+    SBX_frame_t* frame = userData;
+    SBXFrameReport(frame, SBX_FRAME_STAGE_THERMAL, SBXBoxThermalApplyChunk(frame->box, argument));
+}
+
+// Task ending the tick once every write is done
+static void SBXFrameEndTask(void* userData, uint32_t argument) {
+    (void)argument;
+    SBX_frame_t* frame = userData;
+    SBXBoxThermalEnd(frame->box);
+    frame->box->tick++;
+
+    // Deliver everything that changed this tick
+    SBXBoxNotifyChanges(frame->box);
+}
+
+// Task getting the stats of the new tick
+static void SBXFrameStatsTask(void* userData, uint32_t argument) {
+    (void)argument;
+    SBX_frame_t* frame = userData;
+    SBXFrameReport(frame, SBX_FRAME_STAGE_STATS, SBXBoxGetStats(frame->box, &frame->stats));
+}
+
+// Task converting one chunk into the pyramid
+static void SBXFrameConvertTask(void* userData, uint32_t argument) {
+    SBX_frame_t* frame = userData;
+    if(SBXColorPyramidUpdateChunk(frame->pyramid, frame->box, argument).errorFlags) {
+        atomic_store_explicit(&frame->conversionFailed, true, memory_order_relaxed);
+    }
+}
+
+// Task uploading the converted chunks, on the thread running the frame
+static void SBXFrameUploadTask(void* userData, uint32_t argument) {
+    (void)argument;
+    SBX_frame_t* frame = userData;
+
+    // Chunks that failed to convert keep the pyramid stale, so the next update converts them again
+    if(frame->pyramid != SBX_POINTER_UNSET) {
+        if(atomic_load_explicit(&frame->conversionFailed, memory_order_relaxed)) {
+            SBXFrameReport(frame, SBX_FRAME_STAGE_CONVERSION, (SBX_report_t){
+                .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+                .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+            });
+        } else if(!frame->reports[SBX_FRAME_STAGE_CONVERSION].errorFlags) {
+            SBXColorPyramidEndUpdate(frame->pyramid);
+        }
+    }
+    if(frame->upload != SBX_POINTER_UNSET) {
+        SBXFrameReport(frame, SBX_FRAME_STAGE_UPLOAD, frame->upload(frame->userData, frame->box));
+    }
+}
+
+// Makes sure the working position array covers the chunk table
+static SBX_bool_t SBXFrameReserve(SBX_frame_t* frame, SBX_chunk_index_t chunkCount) {
+    if(frame->chunkCapacity >= chunkCount) {
+        return true;
+    }
+
+    SBX_task_id_t* workingPositions = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_TASKS, sizeof(SBX_task_id_t) * chunkCount);
+    if(workingPositions == SBX_POINTER_UNSET) {
+        return false;
+    }
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_TASKS, frame->workingPositions, sizeof(SBX_task_id_t) * frame->chunkCapacity);
+    frame->workingPositions = workingPositions;
+    frame->chunkCapacity    = chunkCount;
+
+    return true;
+}
+
+// Builds the tasks of a frame. Compute tasks get the IDs from 0 and apply tasks the IDs from workingCount, in working set order, so their IDs follow from it
+static SBX_report_t SBXFrameBuild(SBX_frame_t* frame, SBX_bool_t convert) {
+    SBX_box_t*         box        = frame->box;
+    SBX_task_graph_t*  graph      = frame->graph;
+    SBX_chunk_index_t  chunkCount = (SBX_chunk_index_t)box->chunkColumns * box->chunkRows;
+    SBX_chunk_index_t  working    = frame->workingCount;
+    SBX_report_t       report     = SBXTaskGraphClear(graph);
+
+    for(SBX_chunk_index_t i = 0; !report.errorFlags && i < working; i++) {
+        report = SBXTaskGraphAdd(graph, SBXFrameThermalComputeTask, frame, i, SBX_FRAME_STAGE_THERMAL, 0, SBX_POINTER_UNSET);
+    }
+
+    // Writes change box wide state, so they are chained, and a chunk is only written once no computation reads it anymore
+    for(SBX_chunk_index_t i = 0; !report.errorFlags && i < working; i++) {
+        SBX_task_id_t apply = working + i;
+        report = SBXTaskGraphAdd(graph, SBXFrameThermalApplyTask, frame, i, SBX_FRAME_STAGE_THERMAL, 0, SBX_POINTER_UNSET);
+        if(!report.errorFlags && i) {
+            report = SBXTaskGraphDepend(graph, apply, apply - 1);
+        }
+
+        SBX_chunk_index_t chunkIndex = box->thermal.workingChunks[i];
+        SBX_chunk_dimensions_t chunkX = chunkIndex % box->chunkColumns, chunkY = chunkIndex / box->chunkColumns;
+        SBX_chunk_index_t readers[5] = {
+            chunkIndex,
+            chunkX > 0 ? chunkIndex - 1 : chunkIndex,
+            chunkX + 1 < box->chunkColumns ? chunkIndex + 1 : chunkIndex,
+            chunkY > 0 ? chunkIndex - box->chunkColumns : chunkIndex,
+            chunkY + 1 < box->chunkRows ? chunkIndex + box->chunkColumns : chunkIndex
+        };
+        for(uint32_t k = 0; !report.errorFlags && k < 5; k++) {
+            SBX_task_id_t position = frame->workingPositions[readers[k]];
+            if((position != SBX_TASK_ID_UNSET) && (!k || (readers[k] != chunkIndex))) {
+                report = SBXTaskGraphDepend(graph, apply, position);
+            }
+        }
+    }
+    SBX_task_id_t lastApply = working ? 2 * working - 1 : SBX_TASK_ID_UNSET;
+
+    // Ending the tick notifies subscribers, which expect the thread stepping the box
+    SBX_task_id_t end = SBX_TASK_ID_UNSET, stats = SBX_TASK_ID_UNSET, upload = SBX_TASK_ID_UNSET;
+    if(!report.errorFlags) {
+        report = SBXTaskGraphAdd(graph, SBXFrameEndTask, frame, 0, SBX_FRAME_STAGE_STEP, SBX_TASK_FLAG_MAIN_THREAD, &end);
+    }
+    if(!report.errorFlags) {
+        report = SBXTaskGraphAdd(graph, SBXFrameStatsTask, frame, 0, SBX_FRAME_STAGE_STATS, 0, &stats);
+    }
+    if(!report.errorFlags) {
+        report = SBXTaskGraphAdd(graph, SBXFrameUploadTask, frame, 0, SBX_FRAME_STAGE_UPLOAD, SBX_TASK_FLAG_MAIN_THREAD, &upload);
+    }
+    if(!report.errorFlags && working) {
+        report = SBXTaskGraphDepend(graph, end, lastApply);
+    }
+    if(!report.errorFlags && working) {
+        report = SBXTaskGraphDepend(graph, stats, lastApply);
+    }
+    if(!report.errorFlags) {
+        report = SBXTaskGraphDepend(graph, upload, end);
+    }
+
+    // A chunk is converted as soon as its own writes are done, while the writes of the chunks after it go on.
+    // Stats only read the chunk counters, so they run alongside the conversions
+    for(SBX_chunk_index_t c = 0; convert && !report.errorFlags && c < chunkCount; c++) {
+        SBX_task_id_t conversion;
+        report = SBXTaskGraphAdd(graph, SBXFrameConvertTask, frame, c, SBX_FRAME_STAGE_CONVERSION, 0, &conversion);
+        if(!report.errorFlags && (frame->workingPositions[c] != SBX_TASK_ID_UNSET)) {
+            report = SBXTaskGraphDepend(graph, conversion, working + frame->workingPositions[c]);
+        }
+        if(!report.errorFlags) {
+            report = SBXTaskGraphDepend(graph, upload, conversion);
+        }
+    }
+
+    return report;
+}
+
+SBX_report_t SBXFrameCreate(SBX_frame_t** frame) {
+    // Check if required arguments are provided
+    if(frame == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Allocate memory for the SBXFrame struture, the working positions are allocated by the first frame
+    *frame = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_TASKS, sizeof(SBX_frame_t));
+
+    // Check for a memory allocation error
+    if(!*frame) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+    memset(*frame, 0, sizeof(SBX_frame_t));
+
+    SBX_report_t report = SBXTaskGraphCreate(&(*frame)->graph);
+    if(report.errorFlags) {
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_TASKS, *frame, sizeof(SBX_frame_t));
+        *frame = SBX_POINTER_UNSET;
+        return report;
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMMON_CREATION_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXFrameDestroy(SBX_frame_t* frame) {
+    // Check if required arguments are provided
+    if(frame == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    SBXTaskGraphDestroy(frame->graph);
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_TASKS, frame->workingPositions, sizeof(SBX_task_id_t) * frame->chunkCapacity);
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_TASKS, frame, sizeof(SBX_frame_t));
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMMON_DESTRUCTION_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXFrameRun(SBX_frame_t* frame, SBX_box_t* box, SBX_color_pyramid_t* pyramid, SBX_frame_upload_t upload, void* userData) {
+    // Check if required arguments are provided
+    if((frame == SBX_POINTER_UNSET) || (box == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for box initialized
+    if(!box->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_NOT_INIT,
+            .reportMessage = SBX_REPORT_STRING_BOX_NOT_INIT
+        };
+    }
+
+    frame->box          = box;
+    frame->pyramid      = pyramid;
+    frame->upload       = upload;
+    frame->userData     = userData;
+    frame->workingCount = 0;
+    frame->timing       = (SBX_frame_timing_t){0};
+    atomic_store_explicit(&frame->conversionFailed, false, memory_order_relaxed);
+    for(uint32_t s = 0; s < SBX_FRAME_STAGE_COUNT; s++) {
+        frame->reports[s] = (SBX_report_t){.errorFlags = 0, .reportMessage = SBX_REPORT_STRING_FRAME_RUN_SUCCESSFUL};
+    }
+
+    // Every task depends on the edits and on the working set, and on the chunk table they may resize, so they run before the graph is built.
+    // Their time is on the critical path whatever the graph does
+    uint64_t start = SBXFrameNow(), now = start, previous;
+    SBXFrameReport(frame, SBX_FRAME_STAGE_EDITS, SBXBoxApplyCommands(box));
+    previous = now, now = SBXFrameNow();
+    frame->timing.stageNanoseconds[SBX_FRAME_STAGE_EDITS] += now - previous;
+
+    // Storage the edits created was first touched on this thread, move it to the node of its home worker
+    if(box->workers != SBX_POINTER_UNSET) {
+        SBXFrameReport(frame, SBX_FRAME_STAGE_STEP, SBXWorkersPlace(box->workers, box));
+    }
+    SBXFrameReport(frame, SBX_FRAME_STAGE_THERMAL, SBXBoxThermalBegin(box, &frame->workingCount));
+    previous = now, now = SBXFrameNow();
+    frame->timing.stageNanoseconds[SBX_FRAME_STAGE_STEP] += now - previous;
+
+    SBX_bool_t convert = false;
+    if(pyramid != SBX_POINTER_UNSET) {
+        SBX_report_t beginReport = SBXColorPyramidBeginUpdate(pyramid, box);
+        SBXFrameReport(frame, SBX_FRAME_STAGE_CONVERSION, beginReport);
+        convert = !beginReport.errorFlags;
+        previous = now, now = SBXFrameNow();
+        frame->timing.stageNanoseconds[SBX_FRAME_STAGE_CONVERSION] += now - previous;
+    }
+    uint64_t prefixNanoseconds = now - start;
+
+    // Map every chunk to its position in the working set, the tasks of a chunk are found through it
+    SBX_chunk_index_t chunkCount = (SBX_chunk_index_t)box->chunkColumns * box->chunkRows;
+    SBX_report_t report = {.errorFlags = 0, .reportMessage = SBX_REPORT_STRING_FRAME_RUN_SUCCESSFUL};
+    if(!SBXFrameReserve(frame, chunkCount)) {
+        report = (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    } else {
+        for(SBX_chunk_index_t c = 0; c < chunkCount; c++) {
+            frame->workingPositions[c] = SBX_TASK_ID_UNSET;
+        }
+        for(SBX_chunk_index_t i = 0; i < frame->workingCount; i++) {
+            frame->workingPositions[box->thermal.workingChunks[i]] = i;
+        }
+        report = SBXFrameBuild(frame, convert);
+    }
+    if(!report.errorFlags) {
+        report = SBXTaskGraphExecute(frame->graph);
+    }
+
+    // Without a graph the frame still has to end its tick, so run the same work one piece after the other
+    if(report.errorFlags) {
+        SBXFrameReport(frame, SBX_FRAME_STAGE_STEP, report);
+        for(SBX_chunk_index_t i = 0; i < frame->workingCount; i++) {
+            SBXFrameThermalComputeTask(frame, i);
+        }
+        for(SBX_chunk_index_t i = 0; i < frame->workingCount; i++) {
+            SBXFrameThermalApplyTask(frame, i);
+        }
+        SBXFrameEndTask(frame, 0);
+        SBXFrameStatsTask(frame, 0);
+        for(SBX_chunk_index_t c = 0; convert && c < chunkCount; c++) {
+            SBXFrameConvertTask(frame, c);
+        }
+        SBXFrameUploadTask(frame, 0);
+        frame->timing.wallNanoseconds = frame->timing.criticalNanoseconds = frame->timing.busyNanoseconds = SBXFrameNow() - start;
+    } else {
+        SBX_task_graph_path_t path;
+        SBXTaskGraphGetCriticalPath(frame->graph, &path);
+        for(uint32_t s = 0; s < SBX_FRAME_STAGE_COUNT; s++) {
+            frame->timing.stageNanoseconds[s] += path.stageNanoseconds[s];
+        }
+        frame->timing.wallNanoseconds     = SBXFrameNow() - start;
+        frame->timing.busyNanoseconds     = prefixNanoseconds + path.busyNanoseconds;
+        frame->timing.criticalNanoseconds = prefixNanoseconds + path.criticalNanoseconds;
+        frame->timing.taskCount           = frame->graph->taskCount;
+        frame->timing.criticalTaskCount   = path.taskCount;
+    }
+
+    // Report the first error in stage order
+    for(uint32_t s = 0; s < SBX_FRAME_STAGE_COUNT; s++) {
+        if(frame->reports[s].errorFlags) {
+            return frame->reports[s];
+        }
+    }
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_FRAME_RUN_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXFrameGetTiming(SBX_frame_t* frame, SBX_frame_timing_t* timing) {
+    // Check if required arguments are provided
+    if((frame == SBX_POINTER_UNSET) || (timing == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    *timing = frame->timing;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_FRAME_GET_TIMING_SUCCESSFUL
+    };
+}
@@ -0,0 +1,533 @@
+// Project headers
+#include <SBX/gas.h>
+#include <SBX/strings.h>
+#include <SBX/chunk.h>
+#include <SBX/plock.h>
+
+// LibC headers
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Clamp and minimum written as compares rather than fminf and fmaxf, whose NaN rules keep compilers from vectorizing them
+#define SBX_GAS_FIELD_CLAMP(v, low, high) ((v) < (low) ? (low) : (v) > (high) ? (high) : (v))
+#define SBX_GAS_FIELD_MIN(a, b)           ((a) < (b) ? (a) : (b))
+
+// Largest diffusion coefficient per step that keeps the explicit 4 neighbor update stable
+#define SBX_GAS_FIELD_MAX_DIFFUSION_STEP 0.25f
+
+// Frees the cell arrays of a field, sized for its current columns and rows
+static void SBXGasFieldFreeCells(SBX_gas_field_t* field) {
+    size_t cellCount = (size_t)field->columns * field->rows;
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_GAS, field->densities, cellCount * sizeof(SBX_gas_scalar_t));
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_GAS, field->velocitiesX, cellCount * sizeof(SBX_gas_scalar_t));
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_GAS, field->velocitiesY, cellCount * sizeof(SBX_gas_scalar_t));
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_GAS, field->openFractions, cellCount * sizeof(SBX_gas_scalar_t));
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_GAS, field->nextDensities, cellCount * sizeof(SBX_gas_scalar_t));
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_GAS, field->nextVelocitiesX, cellCount * sizeof(SBX_gas_scalar_t));
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_GAS, field->nextVelocitiesY, cellCount * sizeof(SBX_gas_scalar_t));
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_GAS, field->occupancies, cellCount * sizeof(uint16_t));
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_GAS, field->chunkHashes, field->chunkCount * sizeof(uint64_t));
+}
+
+// Lays the cells out again when the box changed size, the gas of cells both layouts share is kept and every cell is counted again
+static SBX_report_t SBXGasFieldFit(SBX_gas_field_t* field, SBX_box_t* box) {
+    SBX_chunk_index_t chunkCount = (SBX_chunk_index_t)box->chunkColumns * box->chunkRows;
+    if((field->boxWidth == box->width) && (field->boxHeight == box->height) && (field->chunkCount == chunkCount) &&
+       (field->densities != SBX_POINTER_UNSET)) {
+        return (SBX_report_t){
+            .errorFlags    = 0,
+            .reportMessage = SBX_REPORT_STRING_GAS_FIELD_STEP_SUCCESSFUL
+        };
+    }
+
+    uint32_t cellSize = 1u << field->cellShift;
+    SBX_gas_field_t fitted = *field;
+    fitted.columns    = (box->width + cellSize - 1) >> field->cellShift;
+    fitted.rows       = (box->height + cellSize - 1) >> field->cellShift;
+    fitted.boxWidth   = box->width;
+    fitted.boxHeight  = box->height;
+    fitted.chunkCount = chunkCount;
+
+    // Empty boxes still get one cell so the arrays are never empty
+    fitted.columns = fitted.columns ? fitted.columns : 1;
+    fitted.rows    = fitted.rows ? fitted.rows : 1;
+
+    size_t cellCount = (size_t)fitted.columns * fitted.rows;
+    fitted.densities       = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_GAS, cellCount * sizeof(SBX_gas_scalar_t));
+    fitted.velocitiesX     = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_GAS, cellCount * sizeof(SBX_gas_scalar_t));
+    fitted.velocitiesY     = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_GAS, cellCount * sizeof(SBX_gas_scalar_t));
+    fitted.openFractions   = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_GAS, cellCount * sizeof(SBX_gas_scalar_t));
+    fitted.nextDensities   = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_GAS, cellCount * sizeof(SBX_gas_scalar_t));
+    fitted.nextVelocitiesX = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_GAS, cellCount * sizeof(SBX_gas_scalar_t));
+    fitted.nextVelocitiesY = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_GAS, cellCount * sizeof(SBX_gas_scalar_t));
+    fitted.occupancies     = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_GAS, cellCount * sizeof(uint16_t));
+    fitted.chunkHashes     = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_GAS, chunkCount * sizeof(uint64_t));
+
+    // Check for a memory allocation error
+    if(!fitted.densities || !fitted.velocitiesX || !fitted.velocitiesY || !fitted.openFractions || !fitted.nextDensities ||
+       !fitted.nextVelocitiesX || !fitted.nextVelocitiesY || !fitted.occupancies || (chunkCount && !fitted.chunkHashes)) {
+        // Free anything that was allocated before exiting, the field keeps its old layout
+        SBXGasFieldFreeCells(&fitted);
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    memset(fitted.densities, 0, cellCount * sizeof(SBX_gas_scalar_t));
+    memset(fitted.velocitiesX, 0, cellCount * sizeof(SBX_gas_scalar_t));
+    memset(fitted.velocitiesY, 0, cellCount * sizeof(SBX_gas_scalar_t));
+    memset(fitted.occupancies, 0, cellCount * sizeof(uint16_t));
+    for(size_t i = 0; i < cellCount; i++) {
+        fitted.openFractions[i] = 1.0f;
+    }
+
+    // Copy the gas of the cells both layouts share
+    if(field->densities != SBX_POINTER_UNSET) {
+        uint32_t columns = SBX_GAS_FIELD_MIN(field->columns, fitted.columns);
+        uint32_t rows    = SBX_GAS_FIELD_MIN(field->rows, fitted.rows);
+        for(uint32_t y = 0; y < rows; y++) {
+            memcpy(&fitted.densities[(size_t)y * fitted.columns], &field->densities[(size_t)y * field->columns], columns * sizeof(SBX_gas_scalar_t));
+            memcpy(&fitted.velocitiesX[(size_t)y * fitted.columns], &field->velocitiesX[(size_t)y * field->columns], columns * sizeof(SBX_gas_scalar_t));
+            memcpy(&fitted.velocitiesY[(size_t)y * fitted.columns], &field->velocitiesY[(size_t)y * field->columns], columns * sizeof(SBX_gas_scalar_t));
+        }
+    }
+
+    SBXGasFieldFreeCells(field);
+    *field = fitted;
+    field->occupanciesStale = true;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_GAS_FIELD_STEP_SUCCESSFUL
+    };
+}
+
+// Counts the set plocks of every cell again in the chunks whose type hash changed since they were last counted, temperatures never change which cells are set
+static void SBXGasFieldRefreshOccupancies(SBX_gas_field_t* field, SBX_box_t* box) {
+    uint8_t  shift         = field->cellShift;
+    uint32_t cellSize      = 1u << shift;
+    uint32_t cellsPerChunk = SBX_CHUNK_SIZE >> shift;
+
+    for(SBX_chunk_index_t c = 0; c < field->chunkCount; c++) {
+        SBX_chunk_data_t* data = box->chunks[c].data;
+        uint64_t hash = data == SBX_POINTER_UNSET ? 0 : data->typeHash;
+        if(!field->occupanciesStale && (field->chunkHashes[c] == hash)) {
+            continue;
+        }
+        field->chunkHashes[c] = hash;
+
+        // Cells of the chunk that are part of the field
+        uint32_t chunkX      = (c % box->chunkColumns) << SBX_CHUNK_SHIFT;
+        uint32_t chunkY      = (c / box->chunkColumns) << SBX_CHUNK_SHIFT;
+        uint32_t firstColumn = chunkX >> shift, firstRow = chunkY >> shift;
+        if((firstColumn >= field->columns) || (firstRow >= field->rows)) {
+            continue;
+        }
+        uint32_t lastColumn = SBX_GAS_FIELD_MIN(firstColumn + cellsPerChunk, field->columns);
+        uint32_t lastRow     = SBX_GAS_FIELD_MIN(firstRow + cellsPerChunk, field->rows);
+        for(uint32_t row = firstRow; row < lastRow; row++) {
+            memset(&field->occupancies[(size_t)row * field->columns + firstColumn], 0, (lastColumn - firstColumn) * sizeof(uint16_t));
+        }
+
+        // Plocks only exist inside the box, so the whole chunk can be read
+        if((data != SBX_POINTER_UNSET) && data->plockCount) {
+            for(uint32_t y = 0; y < SBX_CHUNK_SIZE; y++) {
+                uint32_t row = (chunkY + y) >> shift;
+                if(row >= lastRow) {
+                    break;
+                }
+                for(uint32_t x = 0; x < SBX_CHUNK_SIZE; x++) {
+                    if(*SBXPlockIDMatrixAt(&data->plockIDMatrix, x, y) != SBX_PLOCK_ID_UNSET) {
+                        field->occupancies[(size_t)row * field->columns + ((chunkX + x) >> shift)]++;
+                    }
+                }
+            }
+        }
+
+        // Edge cells only count the part inside the box
+        for(uint32_t row = firstRow; row < lastRow; row++) {
+            uint32_t cellHeight = SBX_GAS_FIELD_MIN(cellSize, box->height - (row << shift));
+            for(uint32_t column = firstColumn; column < lastColumn; column++) {
+                uint32_t cellWidth = SBX_GAS_FIELD_MIN(cellSize, box->width - (column << shift));
+                size_t   i         = (size_t)row * field->columns + column;
+                field->openFractions[i] = 1.0f - (SBX_gas_scalar_t)field->occupancies[i] / (SBX_gas_scalar_t)(cellWidth * cellHeight);
+            }
+        }
+    }
+
+    field->occupanciesStale = false;
+}
+
+// Applies buoyancy to open cells and stops the gas in full cells
+static void SBXGasFieldAccelerate(SBX_gas_scalar_t* restrict velocitiesX, SBX_gas_scalar_t* restrict velocitiesY,
+                                  const SBX_gas_scalar_t* restrict densities, const SBX_gas_scalar_t* restrict openFractions,
+                                  size_t cellCount, SBX_gas_scalar_t lift) {
+    for(size_t i = 0; i < cellCount; i++) {
+        SBX_gas_scalar_t open = openFractions[i] > 0.0f ? 1.0f : 0.0f;
+        velocitiesX[i] = velocitiesX[i] * open;
+        velocitiesY[i] = (velocitiesY[i] - lift * densities[i]) * open;
+    }
+}
+
+// Spreads a quantity between open neighboring cells, every exchange is added to one cell and taken from the other so the total is kept
+static void SBXGasFieldDiffuse(SBX_gas_scalar_t* restrict next, const SBX_gas_scalar_t* restrict current,
+                               const SBX_gas_scalar_t* restrict openFractions, uint32_t columns, uint32_t rows, SBX_gas_scalar_t k) {
+    for(uint32_t y = 0; y < rows; y++) {
+        for(uint32_t x = 0; x < columns; x++) {
+            size_t           i     = (size_t)y * columns + x;
+            SBX_gas_scalar_t value = current[i];
+            if(!(openFractions[i] > 0.0f)) {
+                next[i] = value;
+                continue;
+            }
+
+            SBX_gas_scalar_t flow = 0.0f;
+            if((x > 0) && (openFractions[i - 1] > 0.0f)) {
+                flow += current[i - 1] - value;
+            }
+            if((x + 1 < columns) && (openFractions[i + 1] > 0.0f)) {
+                flow += current[i + 1] - value;
+            }
+            if((y > 0) && (openFractions[i - columns] > 0.0f)) {
+                flow += current[i - columns] - value;
+            }
+            if((y + 1 < rows) && (openFractions[i + columns] > 0.0f)) {
+                flow += current[i + columns] - value;
+            }
+            next[i] = value + k * flow;
+        }
+    }
+}
+
+SBX_report_t SBXGasFieldCreate(SBX_gas_field_t** field, uint8_t cellShift) {
+    // Check if required arguments are provided
+    if((field == SBX_POINTER_UNSET) || (cellShift < 1) || (cellShift > SBX_CHUNK_SHIFT)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Allocate memory for the SBXGasField struture, the cells are allocated once a box is known
+    *field = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_GAS, sizeof(SBX_gas_field_t));
+
+    // Check for a memory allocation error
+    if(!*field) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    memset(*field, 0, sizeof(SBX_gas_field_t));
+    (*field)->cellShift   = cellShift;
+    (*field)->idle        = true;
+    (*field)->diffusion   = SBX_GAS_FIELD_DEFAULT_DIFFUSION;
+    (*field)->dissipation = SBX_GAS_FIELD_DEFAULT_DISSIPATION;
+    (*field)->buoyancy    = SBX_GAS_FIELD_DEFAULT_BUOYANCY;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMMON_CREATION_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXGasFieldDestroy(SBX_gas_field_t* field) {
+    // Check if required arguments are provided
+    if(field == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    SBXGasFieldFreeCells(field);
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_GAS, field, sizeof(SBX_gas_field_t));
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMMON_DESTRUCTION_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXGasFieldSetParameters(SBX_gas_field_t* field, SBX_gas_scalar_t diffusion, SBX_gas_scalar_t dissipation, SBX_gas_scalar_t buoyancy) {
+    // Check if required arguments are provided
+    if((field == SBX_POINTER_UNSET) || !(diffusion >= 0.0f) || !(dissipation >= 0.0f) || !(dissipation <= 1.0f) || !isfinite(buoyancy)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    field->diffusion   = diffusion;
+    field->dissipation = dissipation;
+    field->buoyancy    = buoyancy;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_GAS_FIELD_SET_PARAMETERS_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXGasFieldAdd(SBX_gas_field_t* field, SBX_box_t* box, SBX_box_position_t x, SBX_box_position_t y,
+                            SBX_gas_scalar_t density, SBX_gas_scalar_t velocityX, SBX_gas_scalar_t velocityY) {
+    // Check if required arguments are provided
+    if((field == SBX_POINTER_UNSET) || (box == SBX_POINTER_UNSET) || !(density >= 0.0f)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for box initialized
+    if(!box->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_NOT_INIT,
+            .reportMessage = SBX_REPORT_STRING_BOX_NOT_INIT
+        };
+    }
+    // Check for position inside the box
+    if((x >= box->width) || (y >= box->height)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_OUT_OF_BOUNDS,
+            .reportMessage = SBX_REPORT_STRING_BOX_OUT_OF_BOUNDS
+        };
+    }
+
+    SBX_report_t report = SBXGasFieldFit(field, box);
+    if(report.errorFlags) {
+        return report;
+    }
+
+    // Mix the velocity of the new gas in by density
+    size_t           i     = (size_t)(y >> field->cellShift) * field->columns + (x >> field->cellShift);
+    SBX_gas_scalar_t total = field->densities[i] + density;
+    if(total > 0.0f) {
+        field->velocitiesX[i] = (field->velocitiesX[i] * field->densities[i] + velocityX * density) / total;
+        field->velocitiesY[i] = (field->velocitiesY[i] * field->densities[i] + velocityY * density) / total;
+    }
+    field->densities[i] = total;
+    field->idle         = false;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_GAS_FIELD_ADD_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXGasFieldAbsorbPlock(SBX_gas_field_t* field, SBX_box_t* box, SBX_box_position_t x, SBX_box_position_t y, SBX_gas_scalar_t density) {
+    // Check if required arguments are provided
+    if((field == SBX_POINTER_UNSET) || (box == SBX_POINTER_UNSET) || !(density >= 0.0f)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Get the plock, this checks the box state and position, so it always takes the validated call
+    SBX_plock_t plock;
+    SBX_report_t report = (SBXBoxGetPlock)(box, x, y, &plock);
+    if(report.errorFlags) {
+        return report;
+    }
+    if(plock.type == SBX_PLOCK_TYPE_ID_UNSET) {
+        return (SBX_report_t){
+            .errorFlags    = 0,
+            .reportMessage = SBX_REPORT_STRING_GAS_FIELD_ABSORB_SUCCESSFUL
+        };
+    }
+
+    // Add the gas first so a failed fit leaves the plock in place
+    report = SBXGasFieldAdd(field, box, x, y, density, 0.0f, 0.0f);
+    if(report.errorFlags) {
+        return report;
+    }
+
+    // Unsetting a plock never allocates, so this can't fail after the checks above
+    SBXBoxSetPlock(box, x, y, (SBX_plock_t){.type = SBX_PLOCK_TYPE_ID_UNSET, .temperature = SBX_TEMPERATURE_UNSET});
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_GAS_FIELD_ABSORB_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXGasFieldStep(SBX_gas_field_t* field, SBX_box_t* box, SBX_gas_scalar_t timeStep) {
+    // Check if required arguments are provided
+    if((field == SBX_POINTER_UNSET) || (box == SBX_POINTER_UNSET) || !(timeStep > 0.0f)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for box initialized
+    if(!box->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_NOT_INIT,
+            .reportMessage = SBX_REPORT_STRING_BOX_NOT_INIT
+        };
+    }
+
+    SBX_report_t report = SBXGasFieldFit(field, box);
+    if(report.errorFlags) {
+        return report;
+    }
+
+    // Keep the obstacles current even while idle, so waking up never has to count the whole box
+    SBXGasFieldRefreshOccupancies(field, box);
+    if(field->idle) {
+        return (SBX_report_t){
+            .errorFlags    = 0,
+            .reportMessage = SBX_REPORT_STRING_GAS_FIELD_STEP_SUCCESSFUL
+        };
+    }
+
+    uint32_t          columns       = field->columns;
+    uint32_t          rows          = field->rows;
+    size_t            cellCount     = (size_t)columns * rows;
+    SBX_gas_scalar_t* densities     = field->densities;
+    SBX_gas_scalar_t* velocitiesX   = field->velocitiesX;
+    SBX_gas_scalar_t* velocitiesY   = field->velocitiesY;
+    SBX_gas_scalar_t* openFractions = field->openFractions;
+    SBX_gas_scalar_t* nextDensities = field->nextDensities;
+    SBX_gas_scalar_t* nextX         = field->nextVelocitiesX;
+    SBX_gas_scalar_t* nextY         = field->nextVelocitiesY;
+
+    // Buoyancy pushes dense gas up, y grows in the direction of gravity
+    SBXGasFieldAccelerate(velocitiesX, velocitiesY, densities, openFractions, cellCount, field->buoyancy * timeStep);
+
+    // Diffuse into the scratch arrays
+    SBX_gas_scalar_t k = SBX_GAS_FIELD_MIN(field->diffusion * timeStep, SBX_GAS_FIELD_MAX_DIFFUSION_STEP);
+    SBXGasFieldDiffuse(nextDensities, densities, openFractions, columns, rows, k);
+    SBXGasFieldDiffuse(nextX, velocitiesX, openFractions, columns, rows, k);
+    SBXGasFieldDiffuse(nextY, velocitiesY, openFractions, columns, rows, k);
+
+    // Advect back into the field: trace every open cell center back along its velocity and sample the open cells around that point.
+    // Full cells keep their gas until they open again
+    SBX_gas_scalar_t cellsPerBoxCell = 1.0f / (SBX_gas_scalar_t)(1u << field->cellShift);
+    SBX_gas_scalar_t right           = (SBX_gas_scalar_t)columns - 0.5f;
+    SBX_gas_scalar_t bottom          = (SBX_gas_scalar_t)rows - 0.5f;
+    SBX_gas_scalar_t retain          = 1.0f - SBX_GAS_FIELD_CLAMP(field->dissipation * timeStep, 0.0f, 1.0f);
+    SBX_gas_scalar_t total           = 0.0f;
+    for(uint32_t y = 0; y < rows; y++) {
+        for(uint32_t x = 0; x < columns; x++) {
+            size_t i = (size_t)y * columns + x;
+            if(!(openFractions[i] > 0.0f)) {
+                densities[i]   = nextDensities[i] * retain;
+                velocitiesX[i] = 0.0f;
+                velocitiesY[i] = 0.0f;
+                total         += densities[i];
+                continue;
+            }
+
+            SBX_gas_scalar_t sourceX = (SBX_gas_scalar_t)x + 0.5f - nextX[i] * cellsPerBoxCell * timeStep;
+            SBX_gas_scalar_t sourceY = (SBX_gas_scalar_t)y + 0.5f - nextY[i] * cellsPerBoxCell * timeStep;
+            sourceX = SBX_GAS_FIELD_CLAMP(sourceX, 0.5f, right) - 0.5f;
+            sourceY = SBX_GAS_FIELD_CLAMP(sourceY, 0.5f, bottom) - 0.5f;
+
+            uint32_t         x0 = (uint32_t)sourceX, y0 = (uint32_t)sourceY;
+            uint32_t         x1 = SBX_GAS_FIELD_MIN(x0 + 1, columns - 1), y1 = SBX_GAS_FIELD_MIN(y0 + 1, rows - 1);
+            SBX_gas_scalar_t fx = sourceX - (SBX_gas_scalar_t)x0, fy = sourceY - (SBX_gas_scalar_t)y0;
+
+            size_t           corners[4] = {(size_t)y0 * columns + x0, (size_t)y0 * columns + x1, (size_t)y1 * columns + x0, (size_t)y1 * columns + x1};
+            SBX_gas_scalar_t weights[4] = {(1.0f - fx) * (1.0f - fy), fx * (1.0f - fy), (1.0f - fx) * fy, fx * fy};
+            SBX_gas_scalar_t weight = 0.0f, density = 0.0f, velocityX = 0.0f, velocityY = 0.0f;
+            for(uint32_t c = 0; c < 4; c++) {
+                SBX_gas_scalar_t w = openFractions[corners[c]] > 0.0f ? weights[c] : 0.0f;
+                weight    += w;
+                density   += w * nextDensities[corners[c]];
+                velocityX += w * nextX[corners[c]];
+                velocityY += w * nextY[corners[c]];
+            }
+
+            // Traces that end between full cells keep the gas where it is
+            if(weight > 0.0f) {
+                density   /= weight;
+                velocityX /= weight;
+                velocityY /= weight;
+            } else {
+                density   = nextDensities[i];
+                velocityX = 0.0f;
+                velocityY = 0.0f;
+            }
+
+            densities[i]   = density * retain;
+            velocitiesX[i] = velocityX * retain;
+            velocitiesY[i] = velocityY * retain;
+            total         += densities[i];
+        }
+    }
+
+    // Drop what is left of gas that has faded out so the solver can stop
+    if(total < SBX_GAS_FIELD_IDLE_DENSITY) {
+        memset(densities, 0, cellCount * sizeof(SBX_gas_scalar_t));
+        memset(velocitiesX, 0, cellCount * sizeof(SBX_gas_scalar_t));
+        memset(velocitiesY, 0, cellCount * sizeof(SBX_gas_scalar_t));
+        field->idle = true;
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_GAS_FIELD_STEP_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXGasFieldGetDensity(SBX_gas_field_t* field, SBX_box_position_t x, SBX_box_position_t y, SBX_gas_scalar_t* density) {
+    // Check if required arguments are provided
+    if((field == SBX_POINTER_UNSET) || (density == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    uint32_t column = x >> field->cellShift;
+    uint32_t row    = y >> field->cellShift;
+    if((field->densities == SBX_POINTER_UNSET) || (column >= field->columns) || (row >= field->rows)) {
+        *density = 0.0f;
+    } else {
+        *density = field->densities[(size_t)row * field->columns + column];
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_GAS_FIELD_GET_DENSITY_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXGasFieldGetOverlay(SBX_gas_field_t* field, uint8_t* coverages, SBX_gas_scalar_t fullDensity) {
+    // Check if required arguments are provided
+    if((field == SBX_POINTER_UNSET) || (coverages == SBX_POINTER_UNSET) || !(fullDensity > 0.0f)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    size_t           cellCount = (size_t)field->columns * field->rows;
+    SBX_gas_scalar_t scale     = 255.0f / fullDensity;
+    for(size_t i = 0; i < cellCount; i++) {
+        SBX_gas_scalar_t coverage = field->densities[i] * scale;
+        coverages[i] = (uint8_t)(SBX_GAS_FIELD_CLAMP(coverage, 0.0f, 255.0f) + 0.5f);
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_GAS_FIELD_GET_OVERLAY_SUCCESSFUL
+    };
+}
@@ -0,0 +1,110 @@
+// Project headers
+#include <SBX/ghost.h>
+#include <SBX/strings.h>
+#include <SBX/box.h>
+
+// LibC headers
+#include <string.h>
+
+// Copies the plock of a plock ID of a chunk into a ghost plane position
+static inline void SBXGhostPlaneCopyPlock(SBX_ghost_plane_t* plane, uint32_t index, SBX_chunk_data_t* data, SBX_plock_id_t plockID) {
+    if(plockID == SBX_PLOCK_ID_UNSET) {
+        plane->types[index] = SBX_PLOCK_TYPE_ID_UNSET;
+    } else {
+        SBX_plock_t* plock = &data->plockArray.plocks[SBX_PLOCK_ID_TO_INDEX(plockID)];
+        plane->types[index]        = plock->type;
+        plane->temperatures[index] = plock->temperature;
+    }
+}
+
+// Copies a run of positions of a box row into a ghost plane, positions outside the box get the boundary plock
+static void SBXGhostPlaneCopyRow(SBX_ghost_plane_t* plane, SBX_box_t* box, int32_t x, int32_t y, uint32_t index, uint32_t count) {
+    SBX_plock_type_id_t     boundaryType        = box->boundary.type;
+    SBX_plock_temperature_t boundaryTemperature = box->boundary.temperature;
+
+    while(count > 0) {
+        // Past the box, the run ends at the box when it starts before its left edge, and at the end of the row otherwise
+        if((y < 0) || (y >= box->height) || (x < 0) || (x >= box->width)) {
+            uint32_t run = ((y >= 0) && (y < box->height) && (x < 0)) ? 1 : count;
+            memset(&plane->types[index], boundaryType, run);
+            for(uint32_t i = 0; (boundaryType != SBX_PLOCK_TYPE_ID_UNSET) && (i < run); i++) {
+                plane->temperatures[index + i] = boundaryTemperature;
+            }
+            x     += (int32_t)run;
+            index += run;
+            count -= run;
+            continue;
+        }
+
+        // In the box, the run ends at the end of the chunk or of the box
+        uint32_t run = SBX_CHUNK_SIZE - (uint32_t)(x & SBX_CHUNK_MASK);
+        run = run < (uint32_t)(box->width - x) ? run : (uint32_t)(box->width - x);
+        run = run < count ? run : count;
+        SBX_chunk_data_t* data = box->chunks[(y >> SBX_CHUNK_SHIFT) * box->chunkColumns + (x >> SBX_CHUNK_SHIFT)].data;
+        if(data == SBX_POINTER_UNSET) {
+            memset(&plane->types[index], SBX_PLOCK_TYPE_ID_UNSET, run);
+        } else {
+            // Runs stay in one row of the chunk, which is contiguous in the plock ID matrix
+            const SBX_plock_id_t* plockIDs = SBXPlockIDMatrixAt(&data->plockIDMatrix, x & SBX_CHUNK_MASK, y & SBX_CHUNK_MASK);
+            for(uint32_t i = 0; i < run; i++) {
+                SBXGhostPlaneCopyPlock(plane, index + i, data, plockIDs[i]);
+            }
+        }
+        x     += (int32_t)run;
+        index += run;
+        count -= run;
+    }
+}
+
+SBX_report_t SBXBoxSetBoundary(SBX_box_t* box, SBX_plock_t boundary) {
+    // Check if required arguments are provided
+    if(box == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    if(boundary.type == SBX_PLOCK_TYPE_ID_UNSET) {
+        boundary.temperature = SBX_TEMPERATURE_UNSET;
+    }
+    box->boundary = boundary;
+
+    // Every chunk on the edge of the box may be out of equilibrium with the new boundary
+    SBXBoxThermalActivateAll(box);
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_SET_BOUNDARY_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXGhostPlaneRefresh(SBX_ghost_plane_t* plane, SBX_box_t* box, SBX_chunk_index_t chunkIndex) {
+    // Check if required arguments are provided
+    if((plane == SBX_POINTER_UNSET) || (box == SBX_POINTER_UNSET) || (chunkIndex >= (SBX_chunk_index_t)box->chunkColumns * box->chunkRows)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    SBX_chunk_index_t chunkX = chunkIndex % box->chunkColumns, chunkY = chunkIndex / box->chunkColumns;
+    int32_t originX = (int32_t)chunkX << SBX_CHUNK_SHIFT, originY = (int32_t)chunkY << SBX_CHUNK_SHIFT;
+
+    // Every row of the plane, the ring rows and columns included
+    for(int32_t y = -1; y <= SBX_CHUNK_SIZE; y++) {
+        SBXGhostPlaneCopyRow(plane, box, originX - 1, originY + y, SBX_GHOST_PLANE_INDEX(-1, y), SBX_GHOST_PLANE_SIZE);
+    }
+
+    plane->sideChunks[SBX_GHOST_SIDE_LEFT]   = chunkX > 0 ? chunkIndex - 1 : SBX_GHOST_CHUNK_BOUNDARY;
+    plane->sideChunks[SBX_GHOST_SIDE_RIGHT]  = chunkX + 1 < box->chunkColumns ? chunkIndex + 1 : SBX_GHOST_CHUNK_BOUNDARY;
+    plane->sideChunks[SBX_GHOST_SIDE_TOP]    = chunkY > 0 ? chunkIndex - box->chunkColumns : SBX_GHOST_CHUNK_BOUNDARY;
+    plane->sideChunks[SBX_GHOST_SIDE_BOTTOM] = chunkY + 1 < box->chunkRows ? chunkIndex + box->chunkColumns : SBX_GHOST_CHUNK_BOUNDARY;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_GHOST_PLANE_REFRESH_SUCCESSFUL
+    };
+}
@@ -0,0 +1,505 @@
+// Project headers
+#include <SBX/graph.h>
+#include <SBX/strings.h>
+#include <SBX/allocator.h>
+
+// LibC headers
+#include <string.h>
+#include <time.h>
+
+// Smallest number of tasks and edges the arrays grow to
+#define SBX_TASK_GRAPH_MINIMUM_CAPACITY 64
+
+// Reads the current time in nanoseconds
+static uint64_t SBXTaskGraphNow(void) {
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+// Frees the arrays used while executing
+static void SBXTaskGraphFreeScratch(SBX_task_graph_t* graph) {
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_TASKS, graph->ready, sizeof(SBX_task_id_t) * graph->scratchCapacity);
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_TASKS, graph->readyMain, sizeof(SBX_task_id_t) * graph->scratchCapacity);
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_TASKS, graph->finished, sizeof(SBX_task_id_t) * graph->scratchCapacity);
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_TASKS, graph->path, sizeof(SBX_task_id_t) * graph->scratchCapacity);
+    graph->ready           = SBX_POINTER_UNSET;
+    graph->readyMain       = SBX_POINTER_UNSET;
+    graph->finished        = SBX_POINTER_UNSET;
+    graph->path            = SBX_POINTER_UNSET;
+    graph->pathCount       = 0;
+    graph->scratchCapacity = 0;
+}
+
+// Makes sure the arrays used while executing have room for every task
+static SBX_bool_t SBXTaskGraphReserveScratch(SBX_task_graph_t* graph) {
+    if(graph->scratchCapacity >= graph->taskCount) {
+        return true;
+    }
+
+    // Allocate every array before replacing any so they always share one capacity
+    uint32_t capacity = graph->taskCapacity;
+    SBX_task_id_t* ready     = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_TASKS, sizeof(SBX_task_id_t) * capacity);
+    SBX_task_id_t* readyMain = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_TASKS, sizeof(SBX_task_id_t) * capacity);
+    SBX_task_id_t* finished  = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_TASKS, sizeof(SBX_task_id_t) * capacity);
+    SBX_task_id_t* path      = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_TASKS, sizeof(SBX_task_id_t) * capacity);
+    if(!ready || !readyMain || !finished || !path) {
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_TASKS, ready, sizeof(SBX_task_id_t) * capacity);
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_TASKS, readyMain, sizeof(SBX_task_id_t) * capacity);
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_TASKS, finished, sizeof(SBX_task_id_t) * capacity);
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_TASKS, path, sizeof(SBX_task_id_t) * capacity);
+        return false;
+    }
+
+    SBXTaskGraphFreeScratch(graph);
+    graph->ready           = ready;
+    graph->readyMain       = readyMain;
+    graph->finished        = finished;
+    graph->path            = path;
+    graph->scratchCapacity = capacity;
+
+    return true;
+}
+
+// Hands a task whose dependencies are done to the threads, called with the lock held
+static void SBXTaskGraphPush(SBX_task_graph_t* graph, SBX_task_id_t task) {
+    if(graph->tasks[task].flags & SBX_TASK_FLAG_MAIN_THREAD) {
+        graph->readyMain[graph->readyMainCount++] = task;
+    } else {
+        graph->ready[graph->readyCount++] = task;
+    }
+}
+
+// Runs ready tasks until every task of the execution ended. The executing thread takes the tasks only it may run first,
+// and takes any other task too, so the graph still ends when no other thread could be started
+static void SBXTaskGraphRun(SBX_task_graph_t* graph, SBX_bool_t main) {
+    mtx_lock(&graph->lock);
+    for(;;) {
+        SBX_task_id_t task;
+        if(main && graph->readyMainCount) {
+            task = graph->readyMain[--graph->readyMainCount];
+        } else if(graph->readyCount) {
+            task = graph->ready[--graph->readyCount];
+        } else if(graph->finishedCount == graph->taskCount) {
+            break;
+        } else {
+            cnd_wait(&graph->wake, &graph->lock);
+            continue;
+        }
+        mtx_unlock(&graph->lock);
+
+        SBX_task_t* entry = &graph->tasks[task];
+        entry->startNanoseconds = SBXTaskGraphNow() - graph->startNanoseconds;
+        entry->function(entry->userData, entry->argument);
+        entry->endNanoseconds = SBXTaskGraphNow() - graph->startNanoseconds;
+
+        // Release the dependents, the threads only need waking when there is something new to take or nothing left to wait for
+        mtx_lock(&graph->lock);
+        graph->finished[graph->finishedCount++] = task;
+        SBX_bool_t wake = graph->finishedCount == graph->taskCount;
+        for(uint32_t e = entry->firstEdge; e != SBX_TASK_ID_UNSET; e = graph->edges[e].next) {
+            SBX_task_id_t successor = graph->edges[e].successor;
+            if(!--graph->tasks[successor].remaining) {
+                SBXTaskGraphPush(graph, successor);
+                wake = true;
+            }
+        }
+        if(wake) {
+            cnd_broadcast(&graph->wake);
+        }
+    }
+    mtx_unlock(&graph->lock);
+}
+
+// Thread entry of the helper threads, sleeps until an execution starts, helps run it, and goes back to sleep until the graph is destroyed
+static int SBXTaskGraphThread(void* argument) {
+    SBX_task_graph_t* graph = argument;
+
+    // Executions count from 0 when the graph is created, a helper that starts late still joins the first one
+    uint32_t generation = 0;
+    mtx_lock(&graph->lock);
+    for(;;) {
+        while((graph->generation == generation) && !graph->stopping) {
+            cnd_wait(&graph->wake, &graph->lock);
+        }
+        if(graph->stopping) {
+            break;
+        }
+        generation = graph->generation;
+        mtx_unlock(&graph->lock);
+
+        SBXTaskGraphRun(graph, false);
+
+        // The executing thread waits for every helper to leave before the execution state is reset
+        mtx_lock(&graph->lock);
+        if(!--graph->helping) {
+            cnd_signal(&graph->done);
+        }
+    }
+    mtx_unlock(&graph->lock);
+
+    return 0;
+}
+
+// Checks that every task can run, a task on a cycle of dependencies would wait forever. Uses the finished array as the queue of a topological sort
+static SBX_bool_t SBXTaskGraphIsAcyclic(SBX_task_graph_t* graph) {
+    uint32_t queued = 0;
+    for(SBX_task_id_t t = 0; t < graph->taskCount; t++) {
+        graph->tasks[t].remaining = graph->tasks[t].dependencyCount;
+        if(!graph->tasks[t].remaining) {
+            graph->finished[queued++] = t;
+        }
+    }
+    for(uint32_t i = 0; i < queued; i++) {
+        for(uint32_t e = graph->tasks[graph->finished[i]].firstEdge; e != SBX_TASK_ID_UNSET; e = graph->edges[e].next) {
+            if(!--graph->tasks[graph->edges[e].successor].remaining) {
+                graph->finished[queued++] = graph->edges[e].successor;
+            }
+        }
+    }
+    return queued == graph->taskCount;
+}
+
+// Finds the longest chain of dependent tasks by run time. Tasks end after every task they depend on,
+// so the order they ended in visits every task after the tasks it depends on
+static void SBXTaskGraphFindCriticalPath(SBX_task_graph_t* graph) {
+    for(SBX_task_id_t t = 0; t < graph->taskCount; t++) {
+        graph->tasks[t].pathNanoseconds = 0;
+        graph->tasks[t].pathPrevious    = SBX_TASK_ID_UNSET;
+    }
+
+    SBX_task_id_t last = SBX_TASK_ID_UNSET;
+    for(uint32_t i = 0; i < graph->finishedCount; i++) {
+        SBX_task_id_t task  = graph->finished[i];
+        SBX_task_t*   entry = &graph->tasks[task];
+        entry->pathNanoseconds += entry->endNanoseconds - entry->startNanoseconds;
+        for(uint32_t e = entry->firstEdge; e != SBX_TASK_ID_UNSET; e = graph->edges[e].next) {
+            SBX_task_t* successor = &graph->tasks[graph->edges[e].successor];
+            if((successor->pathPrevious == SBX_TASK_ID_UNSET) || (entry->pathNanoseconds > successor->pathNanoseconds)) {
+                successor->pathNanoseconds = entry->pathNanoseconds;
+                successor->pathPrevious    = task;
+            }
+        }
+        if((last == SBX_TASK_ID_UNSET) || (entry->pathNanoseconds > graph->tasks[last].pathNanoseconds)) {
+            last = task;
+        }
+    }
+
+    // Walk the chain back from its last task, then put it in order
+    graph->pathCount = 0;
+    for(SBX_task_id_t task = last; task != SBX_TASK_ID_UNSET; task = graph->tasks[task].pathPrevious) {
+        graph->path[graph->pathCount++] = task;
+    }
+    for(uint32_t i = 0; i < graph->pathCount / 2; i++) {
+        SBX_task_id_t task = graph->path[i];
+        graph->path[i] = graph->path[graph->pathCount - 1 - i];
+        graph->path[graph->pathCount - 1 - i] = task;
+    }
+}
+
+SBX_report_t SBXTaskGraphCreate(SBX_task_graph_t** graph) {
+    // Check if required arguments are provided
+    if(graph == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Allocate memory for the SBXTaskGraph struture, the task arrays are allocated by the first task
+    *graph = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_TASKS, sizeof(SBX_task_graph_t));
+
+    // Check for a memory allocation error
+    if(!*graph) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+    memset(*graph, 0, sizeof(SBX_task_graph_t));
+
+    // Check for a synchronization creation error
+    if(mtx_init(&(*graph)->lock, mtx_plain) != thrd_success) {
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_TASKS, *graph, sizeof(SBX_task_graph_t));
+        *graph = SBX_POINTER_UNSET;
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_THREAD_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_THREAD_FAILURE
+        };
+    }
+    if((cnd_init(&(*graph)->wake) != thrd_success) || (cnd_init(&(*graph)->done) != thrd_success)) {
+        cnd_destroy(&(*graph)->wake);
+        mtx_destroy(&(*graph)->lock);
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_TASKS, *graph, sizeof(SBX_task_graph_t));
+        *graph = SBX_POINTER_UNSET;
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_THREAD_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_THREAD_FAILURE
+        };
+    }
+
+    // Start the helpers once, executions only wake them
+    for(uint32_t i = 0; i < SBX_TASK_GRAPH_THREAD_COUNT - 1; i++) {
+        if(thrd_create(&(*graph)->threads[(*graph)->threadCount], SBXTaskGraphThread, *graph) == thrd_success) {
+            (*graph)->threadCount++;
+        }
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMMON_CREATION_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXTaskGraphDestroy(SBX_task_graph_t* graph) {
+    // Check if required arguments are provided
+    if(graph == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Stop the helpers
+    mtx_lock(&graph->lock);
+    graph->stopping = true;
+    cnd_broadcast(&graph->wake);
+    mtx_unlock(&graph->lock);
+    for(uint32_t i = 0; i < graph->threadCount; i++) {
+        thrd_join(graph->threads[i], NULL);
+    }
+
+    SBXTaskGraphFreeScratch(graph);
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_TASKS, graph->tasks, sizeof(SBX_task_t) * graph->taskCapacity);
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_TASKS, graph->edges, sizeof(SBX_task_edge_t) * graph->edgeCapacity);
+    cnd_destroy(&graph->done);
+    cnd_destroy(&graph->wake);
+    mtx_destroy(&graph->lock);
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_TASKS, graph, sizeof(SBX_task_graph_t));
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMMON_DESTRUCTION_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXTaskGraphClear(SBX_task_graph_t* graph) {
+    // Check if required arguments are provided
+    if(graph == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    graph->taskCount     = 0;
+    graph->edgeCount     = 0;
+    graph->finishedCount = 0;
+    graph->pathCount     = 0;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_TASK_GRAPH_CLEAR_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXTaskGraphAdd(SBX_task_graph_t* graph, SBX_task_function_t function, void* userData, uint32_t argument,
+                             SBX_task_stage_t stage, uint8_t flags, SBX_task_id_t* task) {
+    // Check if required arguments are provided
+    if((graph == SBX_POINTER_UNSET) || (function == SBX_POINTER_UNSET) || (stage >= SBX_TASK_GRAPH_STAGE_COUNT) ||
+       (graph->taskCount == SBX_TASK_ID_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Grow the task array by doubling, frames add about the same tasks every time so it settles quickly
+    if(graph->taskCount == graph->taskCapacity) {
+        uint32_t capacity = graph->taskCapacity ? graph->taskCapacity * 2 : SBX_TASK_GRAPH_MINIMUM_CAPACITY;
+        SBX_task_t* tasks = SBXAllocatorReallocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_TASKS, graph->tasks,
+                                                   sizeof(SBX_task_t) * graph->taskCapacity, sizeof(SBX_task_t) * capacity);
+
+        // Check for a memory allocation error
+        if(tasks == SBX_POINTER_UNSET) {
+            // Return error
+            return (SBX_report_t){
+                .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+                .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+            };
+        }
+        graph->tasks        = tasks;
+        graph->taskCapacity = capacity;
+    }
+
+    graph->tasks[graph->taskCount] = (SBX_task_t){
+        .function        = function,
+        .userData        = userData,
+        .argument        = argument,
+        .stage           = stage,
+        .flags           = flags,
+        .firstEdge       = SBX_TASK_ID_UNSET,
+        .dependencyCount = 0,
+        .remaining       = 0,
+        .pathPrevious    = SBX_TASK_ID_UNSET
+    };
+    if(task != SBX_POINTER_UNSET) {
+        *task = graph->taskCount;
+    }
+    graph->taskCount++;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_TASK_GRAPH_ADD_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXTaskGraphDepend(SBX_task_graph_t* graph, SBX_task_id_t task, SBX_task_id_t dependency) {
+    // Check if required arguments are provided
+    if((graph == SBX_POINTER_UNSET) || (task >= graph->taskCount) || (dependency >= graph->taskCount) || (task == dependency) ||
+       (graph->edgeCount == SBX_TASK_ID_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    if(graph->edgeCount == graph->edgeCapacity) {
+        uint32_t capacity = graph->edgeCapacity ? graph->edgeCapacity * 2 : SBX_TASK_GRAPH_MINIMUM_CAPACITY;
+        SBX_task_edge_t* edges = SBXAllocatorReallocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_TASKS, graph->edges,
+                                                        sizeof(SBX_task_edge_t) * graph->edgeCapacity, sizeof(SBX_task_edge_t) * capacity);
+
+        // Check for a memory allocation error
+        if(edges == SBX_POINTER_UNSET) {
+            // Return error
+            return (SBX_report_t){
+                .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+                .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+            };
+        }
+        graph->edges        = edges;
+        graph->edgeCapacity = capacity;
+    }
+
+    graph->edges[graph->edgeCount] = (SBX_task_edge_t){
+        .successor = task,
+        .next      = graph->tasks[dependency].firstEdge
+    };
+    graph->tasks[dependency].firstEdge = graph->edgeCount++;
+    graph->tasks[task].dependencyCount++;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_TASK_GRAPH_DEPEND_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXTaskGraphExecute(SBX_task_graph_t* graph) {
+    // Check if required arguments are provided
+    if(graph == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Check for a memory allocation error
+    if(!SBXTaskGraphReserveScratch(graph)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+    // Check for tasks that could never start
+    if(!SBXTaskGraphIsAcyclic(graph)) {
+        graph->finishedCount = 0;
+        graph->pathCount     = 0;
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_TASK_GRAPH_ERROR_CYCLE,
+            .reportMessage = SBX_REPORT_STRING_TASK_GRAPH_CYCLE
+        };
+    }
+
+    // Start from the tasks depending on nothing, in the order they were added
+    graph->readyCount     = 0;
+    graph->readyMainCount = 0;
+    graph->finishedCount  = 0;
+    for(SBX_task_id_t t = graph->taskCount; t-- > 0;) {
+        graph->tasks[t].remaining = graph->tasks[t].dependencyCount;
+        if(!graph->tasks[t].remaining) {
+            SBXTaskGraphPush(graph, t);
+        }
+    }
+    graph->startNanoseconds = SBXTaskGraphNow();
+
+    // Wake the helpers unless a single task leaves them nothing to do, this thread takes part and keeps the tasks only it may run
+    SBX_bool_t helped = (graph->taskCount > 1) && graph->threadCount;
+    if(helped) {
+        mtx_lock(&graph->lock);
+        graph->helping = graph->threadCount;
+        graph->generation++;
+        cnd_broadcast(&graph->wake);
+        mtx_unlock(&graph->lock);
+    }
+    SBXTaskGraphRun(graph, true);
+    if(helped) {
+        mtx_lock(&graph->lock);
+        while(graph->helping) {
+            cnd_wait(&graph->done, &graph->lock);
+        }
+        mtx_unlock(&graph->lock);
+    }
+    graph->wallNanoseconds = SBXTaskGraphNow() - graph->startNanoseconds;
+
+    SBXTaskGraphFindCriticalPath(graph);
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_TASK_GRAPH_EXECUTE_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXTaskGraphGetCriticalPath(SBX_task_graph_t* graph, SBX_task_graph_path_t* path) {
+    // Check if required arguments are provided
+    if((graph == SBX_POINTER_UNSET) || (path == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    *path = (SBX_task_graph_path_t){
+        .wallNanoseconds = graph->finishedCount ? graph->wallNanoseconds : 0,
+        .tasks           = graph->path,
+        .taskCount       = graph->pathCount
+    };
+    for(uint32_t i = 0; i < graph->finishedCount; i++) {
+        SBX_task_t* task = &graph->tasks[graph->finished[i]];
+        path->busyNanoseconds += task->endNanoseconds - task->startNanoseconds;
+    }
+    for(uint32_t i = 0; i < graph->pathCount; i++) {
+        SBX_task_t* task = &graph->tasks[graph->path[i]];
+        path->stageNanoseconds[task->stage] += task->endNanoseconds - task->startNanoseconds;
+        path->criticalNanoseconds           += task->endNanoseconds - task->startNanoseconds;
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_TASK_GRAPH_GET_CRITICAL_PATH_SUCCESSFUL
+    };
+}
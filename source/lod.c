@@ -0,0 +1,110 @@
+// Project headers
+#include <SBX/lod.h>
+#include <SBX/strings.h>
+#include <SBX/box.h>
+
+// Distance in chunks from a chunk coordinate to the inclusive range of chunk coordinates the viewport overlaps
+static uint32_t SBXBoxLODDistance(uint32_t chunk, uint32_t first, uint32_t last) {
+    return chunk < first ? first - chunk : chunk > last ? chunk - last : 0;
+}
+
+SBX_report_t SBXBoxLODInit(SBX_box_lod_t* lod) {
+    // Check if required arguments are provided
+    if(lod == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    *lod = (SBX_box_lod_t){
+        .enabled        = false,
+        .viewportX      = 0,
+        .viewportY      = 0,
+        .viewportWidth  = 0,
+        .viewportHeight = 0,
+        .nearRadius     = SBX_BOX_LOD_DEFAULT_NEAR_RADIUS,
+        .farRadius      = SBX_BOX_LOD_DEFAULT_FAR_RADIUS,
+        .farInterval    = SBX_BOX_LOD_DEFAULT_FAR_INTERVAL
+    };
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_LOD_INIT_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxSetLOD(SBX_box_t* box, SBX_bool_t enabled, SBX_chunk_dimensions_t nearRadius, SBX_chunk_dimensions_t farRadius, uint32_t farInterval) {
+    // Check if required arguments are provided
+    if((box == SBX_POINTER_UNSET) || (farRadius < nearRadius) || (farInterval < 2)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Chunks skipped under the old policy stay in the thermal active set, so they catch up under the new one
+    box->lod.enabled     = enabled;
+    box->lod.nearRadius  = nearRadius;
+    box->lod.farRadius   = farRadius;
+    box->lod.farInterval = farInterval;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_SET_LOD_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxSetViewport(SBX_box_t* box, SBX_box_position_t x, SBX_box_position_t y, SBX_box_dimensions_t width, SBX_box_dimensions_t height) {
+    // Check if required arguments are provided
+    if(box == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    box->lod.viewportX      = x;
+    box->lod.viewportY      = y;
+    box->lod.viewportWidth  = width;
+    box->lod.viewportHeight = height;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_SET_VIEWPORT_SUCCESSFUL
+    };
+}
+
+uint32_t SBXBoxLODGetChunkInterval(const SBX_box_t* box, SBX_chunk_index_t chunkIndex) {
+    const SBX_box_lod_t* lod = &box->lod;
+    if(!lod->enabled) {
+        return 1;
+    }
+
+    // An empty viewport still covers the chunk holding its corner
+    uint64_t firstX = lod->viewportX >> SBX_CHUNK_SHIFT, firstY = lod->viewportY >> SBX_CHUNK_SHIFT;
+    uint64_t lastX  = ((uint64_t)lod->viewportX + (lod->viewportWidth ? lod->viewportWidth - 1 : 0)) >> SBX_CHUNK_SHIFT;
+    uint64_t lastY  = ((uint64_t)lod->viewportY + (lod->viewportHeight ? lod->viewportHeight - 1 : 0)) >> SBX_CHUNK_SHIFT;
+
+    uint32_t distanceX = SBXBoxLODDistance(chunkIndex % box->chunkColumns, (uint32_t)firstX, (uint32_t)lastX);
+    uint32_t distanceY = SBXBoxLODDistance(chunkIndex / box->chunkColumns, (uint32_t)firstY, (uint32_t)lastY);
+    uint32_t distance  = distanceX > distanceY ? distanceX : distanceY;
+    if(distance <= lod->nearRadius) {
+        return 1;
+    }
+    if(distance <= lod->farRadius) {
+        return lod->farInterval;
+    }
+    return SBX_BOX_LOD_INTERVAL_FROZEN;
+}
+
+SBX_bool_t SBXBoxLODIsChunkDue(const SBX_box_t* box, SBX_chunk_index_t chunkIndex) {
+    uint32_t interval = SBXBoxLODGetChunkInterval(box, chunkIndex);
+    if(interval == SBX_BOX_LOD_INTERVAL_FROZEN) {
+        return false;
+    }
+    return (box->tick + chunkIndex) % interval == 0;
+}
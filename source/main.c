@@ -1,7 +1,15 @@
 // Project headers
 #include <SBX/window.h>
+#include <SBX/renderer.h>
+#include <SBX/frame.h>
 #include <SBX/box.h>
 #include <SBX/plock.h>
+#include <SBX/material.h>
+#include <SBX/record.h>
+#include <SBX/save.h>
+#include <SBX/pyramid.h>
+#include <SBX/capture.h>
+#include <SBX/strings.h>
 #include <SBX/types.h>
 
 // Dependency headers
@@ -10,13 +18,242 @@
 
 // LibC headers
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 // Basic GLFW error callback
 void errorCallback(int errorCode, const char* description) {
     fprintf(stderr, "GLFW Error %d: %s\n", errorCode, description);
 }
 
+// Fraction of the camera size the camera pans and zooms by every frame a key is held
+#define CAMERA_SPEED 0.02f
+// Frames between two frame timing reports when they are turned on
+#define FRAME_TIMING_INTERVAL 120
+
+// Size of thumbnails when no size is given
+#define THUMBNAIL_SIZE 256
+
+// Where captured images are written, thumbnails are named after their box files and timelapse frames after their frame numbers
+typedef struct ImageWriter {
+    SBX_string_t directory;
+    // Box file paths indexed by capture tag, NULL for timelapse frames
+    char**       names;
+} ImageWriter;
+
+// Capture callback, writes the pixels as a binary PPM image
+SBX_report_t writeImage(void* userData, uint64_t tag, const uint8_t* pixels, uint32_t width, uint32_t height) {
+    ImageWriter* writer = userData;
+    char path[1024];
+    int length;
+    if(writer->names != NULL) {
+        const char* name = strrchr(writer->names[tag], '/');
+        length = snprintf(path, sizeof(path), "%s/%s.ppm", writer->directory, name != NULL ? name + 1 : writer->names[tag]);
+    } else {
+        length = snprintf(path, sizeof(path), "%s/frame_%08llu.ppm", writer->directory, (unsigned long long)tag);
+    }
+    FILE* file = length < (int)sizeof(path) ? fopen(path, "wb") : NULL;
+    uint8_t* row = malloc((size_t)width * 3);
+    SBX_bool_t written = (file != NULL) && (row != NULL) && (fprintf(file, "P6\n%u %u\n255\n", width, height) > 0);
+
+    // Rows come bottom to top and PPM wants them top to bottom without alpha
+    for(uint32_t y = height; written && y-- > 0;) {
+        const uint8_t* source = &pixels[(size_t)y * width * SBX_CAPTURE_PIXEL_SIZE];
+        for(uint32_t x = 0; x < width; x++) {
+            memcpy(&row[x * 3], &source[x * SBX_CAPTURE_PIXEL_SIZE], 3);
+        }
+        written = fwrite(row, 3, width, file) == width;
+    }
+    free(row);
+    if(file != NULL) {
+        written = !fclose(file) && written;
+    }
+    return (SBX_report_t){
+        .errorFlags    = written ? 0 : SBX_COMMON_ERROR_IO_FAILURE,
+        .reportMessage = written ? SBX_REPORT_STRING_CAPTURE_COLLECT_SUCCESSFUL : SBX_REPORT_STRING_COMMON_IO_FAILURE
+    };
+}
+
+// Camera the upload stage of a frame draws with
+typedef struct Camera {
+    SBX_renderer_t* renderer;
+    float           x, y, width, height;
+} Camera;
+
+// Upload stage of a frame, draws the chunks under the camera
+SBX_report_t drawFrame(void* userData, SBX_box_t* box) {
+    Camera* camera = userData;
+    return SBXRendererDraw(camera->renderer, box, camera->x, camera->y, camera->width, camera->height);
+}
+
+// Prints where the time of the last frame went, the critical path is the part more threads can't shorten
+void printFrameTiming(SBX_frame_t* frame) {
+    static const char* stageNames[SBX_FRAME_STAGE_COUNT] = {"edits", "step", "thermal", "stats", "conversion", "upload"};
+    SBX_frame_timing_t timing;
+    SBXFrameGetTiming(frame, &timing);
+    printf("Frame: %u tasks, wall %llu us, busy %llu us, critical path %llu us over %u tasks (", timing.taskCount,
+           (unsigned long long)(timing.wallNanoseconds / 1000), (unsigned long long)(timing.busyNanoseconds / 1000),
+           (unsigned long long)(timing.criticalNanoseconds / 1000), timing.criticalTaskCount);
+    for(uint32_t s = 0; s < SBX_FRAME_STAGE_COUNT; s++) {
+        printf("%s%s %llu us", s ? ", " : "", stageNames[s], (unsigned long long)(timing.stageNanoseconds[s] / 1000));
+    }
+    printf(")\n");
+}
+
+// Fits the camera to a whole box, centered, keeping its positions square in a width by height framebuffer
+void fitCamera(Camera* camera, SBX_box_t* box, uint32_t width, uint32_t height) {
+    camera->width  = (float)box->width;
+    camera->height = (float)box->width * (float)height / (float)width;
+    if(camera->height < (float)box->height) {
+        camera->height = (float)box->height;
+        camera->width  = (float)box->height * (float)width / (float)height;
+    }
+    camera->x = ((float)box->width - camera->width) * 0.5f;
+    camera->y = ((float)box->height - camera->height) * 0.5f;
+}
+
+// Clears a capture framebuffer to opaque black, offscreen windows have no default framebuffer to clear
+void clearCapture(SBX_capture_t* capture) {
+    static const GLfloat black[4] = {0.0f, 0.0f, 0.0f, 1.0f};
+    capture->window->openglContext->ClearNamedFramebufferfv(capture->framebuffer, GL_COLOR, 0, black);
+}
+
+// Renders every box file into a thumbnail without a display, reading each one back while the next one renders,
+// usage: SBX --thumbnails directory [--size WIDTHxHEIGHT] file...
+int runThumbnails(int argc, char* argv[]) {
+    unsigned width = THUMBNAIL_SIZE, height = THUMBNAIL_SIZE;
+    int first = 3;
+    if((argc > first + 1) && !strcmp(argv[first], "--size")) {
+        if((sscanf(argv[first + 1], "%ux%u", &width, &height) != 2) || !width || !height) {
+            fprintf(stderr, "Invalid thumbnail size: %s\n", argv[first + 1]);
+            return 1;
+        }
+        first += 2;
+    }
+    if((argc < 3) || (first >= argc)) {
+        fprintf(stderr, "Usage: %s --thumbnails directory [--size WIDTHxHEIGHT] file...\n", argv[0]);
+        return 1;
+    }
+    ImageWriter writer = {.directory = argv[2], .names = &argv[first]};
+
+    // Set up the offscreen window, the renderer, and the capture it draws to, no error check on the way out as we are already exiting
+    SBX_window_t* window = NULL;
+    SBX_renderer_t* renderer = NULL;
+    SBX_capture_t* capture = NULL;
+    SBX_box_t* box = NULL;
+    SBX_report_t report = SBXWindowCreate(&window);
+    if(!report.errorFlags) {
+        report = SBXWindowInitOffscreen(window, (SBX_window_dimensions_t)width, (SBX_window_dimensions_t)height);
+    }
+    if(!report.errorFlags) {
+        report = SBXRendererCreate(&renderer, window, SBXMaterialTableEmbedded.types);
+    }
+    if(!report.errorFlags) {
+        report = SBXCaptureCreate(&capture, window, width, height, writeImage, &writer);
+    }
+    if(!report.errorFlags) {
+        report = SBXRendererSetTarget(renderer, capture->framebuffer, width, height);
+    }
+    if(!report.errorFlags) {
+        report = SBXBoxCreate(&box);
+    }
+
+    // Boxes that fail to load or draw are reported and skipped
+    int failures = report.errorFlags ? 1 : 0;
+    if(report.errorFlags) {
+        printf("Failed to set up thumbnails: %s\n", report.reportMessage);
+    }
+    for(int i = first; !report.errorFlags && (i < argc); i++) {
+        SBX_report_t boxReport = SBXBoxLoad(box, argv[i]);
+        if(!boxReport.errorFlags) {
+            Camera camera = {.renderer = renderer};
+            fitCamera(&camera, box, width, height);
+            clearCapture(capture);
+            boxReport = drawFrame(&camera, box);
+            SBXBoxDeinit(box);
+        }
+        if(!boxReport.errorFlags) {
+            boxReport = SBXCaptureRead(capture, (uint64_t)(i - first));
+        }
+        if(boxReport.errorFlags) {
+            printf("%s: %s\n", argv[i], boxReport.reportMessage);
+            failures++;
+        }
+    }
+    if(capture != NULL) {
+        report = SBXCaptureDestroy(capture);
+        if(report.errorFlags) {
+            printf("Failed to finish thumbnails: %s\n", report.reportMessage);
+            failures++;
+        }
+    }
+
+    if(box != NULL) {
+        SBXBoxDestroy(box);
+    }
+    if(renderer != NULL) {
+        SBXRendererDestroy(renderer);
+    }
+    if(window != NULL) {
+        SBXWindowDeinit(window);
+        SBXWindowDestroy(window);
+    }
+    glfwTerminate();
+
+    return failures ? 1 : 0;
+}
+
 int main(int argc, char* argv[]) {
+    // Headless thumbnail mode, renders offscreen so it works without a display too
+    if((argc > 1) && !strcmp(argv[1], "--thumbnails")) {
+        return runThumbnails(argc, argv);
+    }
+    // Frame timing reports, recording the box to a file or to spectators, playing a recording or a live box instead of stepping one,
+    // material files overriding the embedded ones, and rendering without a display into timelapse frames, usage: SBX [--frame-timing] [--record file]
+    // [--stream socket] [--play file | --spectate socket] [--materials directory] [--offscreen WIDTHxHEIGHT [--frames directory] [--frame-count count]]
+    SBX_bool_t frameTiming = false;
+    SBX_string_t recordPath = NULL, streamPath = NULL, playPath = NULL, spectatePath = NULL, materialsPath = NULL, framesPath = NULL;
+    unsigned offscreenWidth = 0, offscreenHeight = 0;
+    unsigned long long frameCount = 0;
+    for(int i = 1; i < argc; i++) {
+        if(!strcmp(argv[i], "--frame-timing")) {
+            frameTiming = true;
+        }
+        else if(!strcmp(argv[i], "--record") && (i + 1 < argc)) {
+            recordPath = argv[++i];
+        }
+        else if(!strcmp(argv[i], "--stream") && (i + 1 < argc)) {
+            streamPath = argv[++i];
+        }
+        else if(!strcmp(argv[i], "--play") && (i + 1 < argc)) {
+            playPath = argv[++i];
+        }
+        else if(!strcmp(argv[i], "--spectate") && (i + 1 < argc)) {
+            spectatePath = argv[++i];
+        }
+        else if(!strcmp(argv[i], "--materials") && (i + 1 < argc)) {
+            materialsPath = argv[++i];
+        }
+        else if(!strcmp(argv[i], "--offscreen") && (i + 1 < argc) &&
+                (sscanf(argv[i + 1], "%ux%u", &offscreenWidth, &offscreenHeight) == 2) && offscreenWidth && offscreenHeight) {
+            i++;
+        }
+        else if(!strcmp(argv[i], "--frames") && (i + 1 < argc)) {
+            framesPath = argv[++i];
+        }
+        else if(!strcmp(argv[i], "--frame-count") && (i + 1 < argc)) {
+            frameCount = strtoull(argv[++i], NULL, 10);
+        }
+        else {
+            fprintf(stderr, "Unknown argument: %s\n", argv[i]);
+            return 1;
+        }
+    }
+    if(((framesPath != NULL) || frameCount) && !offscreenWidth) {
+        fprintf(stderr, "--frames and --frame-count need --offscreen\n");
+        return 1;
+    }
+
     // Create the report struct we will use for error checking
     SBX_report_t report = {
         .errorFlags    = 0,
@@ -26,8 +263,11 @@ int main(int argc, char* argv[]) {
     // Set error callback for GLFW
     glfwSetErrorCallback(errorCallback);
 
-    // Not needed becuase this is done by SBXWindowDeinit, but still good practice if we need to do GLFW stuff before creating the window
-    glfwInit();
+    // Not needed becuase this is done by SBXWindowDeinit, but still good practice if we need to do GLFW stuff before creating the window.
+    // Offscreen windows leave it to SBXWindowInitOffscreen, which picks the platform GLFW initializes on
+    if(!offscreenWidth) {
+        glfwInit();
+    }
 
     // Create the window
     SBX_window_t* window = NULL;
@@ -40,7 +280,8 @@ int main(int argc, char* argv[]) {
     }
 
     // Initialize window
-    report = SBXWindowInit(window, "SBX", 1200, 675);
+    report = offscreenWidth ? SBXWindowInitOffscreen(window, (SBX_window_dimensions_t)offscreenWidth, (SBX_window_dimensions_t)offscreenHeight)
+                            : SBXWindowInit(window, "SBX", 1200, 675);
     // Check if window was initialized properly
     if(report.errorFlags) {
         printf("Failed to initialize window: %s", report.reportMessage);
@@ -81,20 +322,213 @@ int main(int argc, char* argv[]) {
         return 1;
     }
 
-    // Create texture to represent the box data
+    // Plock types come from the material table compiled into the binary, a development directory of material files can override it without a rebuild,
+    // the embedded table is kept if the directory doesn't load
+    const SBX_material_table_t* materials = &SBXMaterialTableEmbedded;
+    static SBX_material_table_t overrideMaterials;
+    if(materialsPath != NULL) {
+        overrideMaterials = *materials;
+        uint32_t materialCount = 0;
+        report = SBXMaterialTableLoadDirectory(&overrideMaterials, materialsPath, &materialCount);
+        if(report.errorFlags) {
+            printf("Failed to load materials, keeping the embedded ones: %s\n", report.reportMessage);
+        }
+        else {
+            printf("Loaded %u material files from %s\n", materialCount, materialsPath);
+            materials = &overrideMaterials;
+        }
+    }
+
+    // Create the renderer that draws the box data
+    SBX_renderer_t* renderer = NULL;
+    report = SBXRendererCreate(&renderer, window, materials->types);
+    // Check if renderer was created properly
+    if(report.errorFlags) {
+        printf("Failed to create renderer: %s", report.reportMessage);
+
+        // Deinit and destroy box, window, and glfw first, and don't worry about errors as we are already exiting
+        SBXBoxDeinit(box);
+        SBXBoxDestroy(box);
+        SBXWindowDeinit(window);
+        SBXWindowDestroy(window);
+        glfwTerminate();
+
+        return 1;
+    }
+
+    // Offscreen windows draw into a capture, which reads the timelapse frames back
+    SBX_capture_t* capture = NULL;
+    ImageWriter frameWriter = {.directory = framesPath, .names = NULL};
+    if(offscreenWidth) {
+        report = SBXCaptureCreate(&capture, window, offscreenWidth, offscreenHeight, writeImage, &frameWriter);
+        if(!report.errorFlags) {
+            report = SBXRendererSetTarget(renderer, capture->framebuffer, offscreenWidth, offscreenHeight);
+        }
+        // Check if capture was created properly
+        if(report.errorFlags) {
+            printf("Failed to create capture: %s", report.reportMessage);
+
+            // Destroy capture, renderer, box, window, and glfw first, and don't worry about errors as we are already exiting
+            if(capture != NULL) {
+                SBXCaptureDestroy(capture);
+            }
+            SBXRendererDestroy(renderer);
+            SBXBoxDeinit(box);
+            SBXBoxDestroy(box);
+            SBXWindowDeinit(window);
+            SBXWindowDestroy(window);
+            glfwTerminate();
+
+            return 1;
+        }
+    }
+
+    // Create the frame that steps, converts, and draws the box as one task graph
+    SBX_frame_t* frame = NULL;
+    report = SBXFrameCreate(&frame);
+    // Check if frame was created properly
+    if(report.errorFlags) {
+        printf("Failed to create frame: %s", report.reportMessage);
+
+        // Destroy capture, renderer, box, window, and glfw first, and don't worry about errors as we are already exiting
+        if(capture != NULL) {
+            SBXCaptureDestroy(capture);
+        }
+        SBXRendererDestroy(renderer);
+        SBXBoxDeinit(box);
+        SBXBoxDestroy(box);
+        SBXWindowDeinit(window);
+        SBXWindowDestroy(window);
+        glfwTerminate();
+
+        return 1;
+    }
+
+    // Record the box, or play a recording into it, no error check on the way out as the box runs either way
+    SBX_box_recorder_t* recorder = NULL;
+    if((recordPath != NULL) || (streamPath != NULL)) {
+        report = SBXBoxRecordBegin(box, recordPath, streamPath, 0, &recorder);
+        if(report.errorFlags) {
+            printf("Failed to start recording: %s\n", report.reportMessage);
+        }
+    }
+    SBX_recording_player_t* player = NULL;
+    if((playPath != NULL) || (spectatePath != NULL)) {
+        report = playPath != NULL ? SBXRecordingPlayerOpen(&player, playPath) : SBXRecordingPlayerConnect(&player, spectatePath);
+        if(report.errorFlags) {
+            printf("Failed to open recording: %s\n", report.reportMessage);
+        }
+    }
+
+    // Camera in box positions, starts on the whole box, arrow keys pan and page up and down zoom
+    Camera camera = {.renderer = renderer, .x = 0.0f, .y = 0.0f, .width = (float)box->width};
+    float cameraX = 0.0f, cameraY = 0.0f, cameraWidth = (float)box->width;
+    uint64_t frameIndex = 0;
+    SBX_bool_t playbackEnded = false;
+
+    // Main application loop, offscreen runs stop after their frame count or at the end of the recording they play
+    while(!glfwWindowShouldClose(window->windowHandle) && !playbackEnded && !(frameCount && (frameIndex >= frameCount))) {
+        // Keep the camera at the aspect ratio of the window
+        int framebufferWidth = 0, framebufferHeight = 0;
+        glfwGetFramebufferSize(window->windowHandle, &framebufferWidth, &framebufferHeight);
+        float cameraHeight = framebufferWidth > 0 ? cameraWidth * (float)framebufferHeight / (float)framebufferWidth : cameraWidth;
+
+        float pan = cameraWidth * CAMERA_SPEED;
+        cameraX  -= glfwGetKey(window->windowHandle, GLFW_KEY_LEFT) == GLFW_PRESS ? pan : 0.0f;
+        cameraX  += glfwGetKey(window->windowHandle, GLFW_KEY_RIGHT) == GLFW_PRESS ? pan : 0.0f;
+        cameraY  -= glfwGetKey(window->windowHandle, GLFW_KEY_UP) == GLFW_PRESS ? pan : 0.0f;
+        cameraY  += glfwGetKey(window->windowHandle, GLFW_KEY_DOWN) == GLFW_PRESS ? pan : 0.0f;
+        if(glfwGetKey(window->windowHandle, GLFW_KEY_PAGE_UP) == GLFW_PRESS) {
+            cameraX += cameraWidth * CAMERA_SPEED * 0.5f;
+            cameraY += cameraHeight * CAMERA_SPEED * 0.5f;
+            cameraWidth *= 1.0f - CAMERA_SPEED;
+            cameraWidth  = cameraWidth < 1.0f ? 1.0f : cameraWidth;
+        }
+        if(glfwGetKey(window->windowHandle, GLFW_KEY_PAGE_DOWN) == GLFW_PRESS) {
+            cameraX -= cameraWidth * CAMERA_SPEED * 0.5f;
+            cameraY -= cameraHeight * CAMERA_SPEED * 0.5f;
+            cameraWidth *= 1.0f + CAMERA_SPEED;
+        }
 
-    // Main application loop
-    while(!glfwWindowShouldClose(window->windowHandle)) {
         // Clear the framebuffer
-        prFramebufferClearColor(window->openglContext, NULL, 0, (vec4s){1.0f, 0.0f, 0.0f, 1.0f});
+        if(capture != NULL) {
+            clearCapture(capture);
+        }
+        else {
+            prFramebufferClearColor(window->openglContext, NULL, 0, (vec4s){1.0f, 0.0f, 0.0f, 1.0f});
+        }
+
+        // Step the box, convert the chunks it changed, and draw the chunks under the camera, offscreen frames show the whole box
+        camera.x      = cameraX;
+        camera.y      = cameraY;
+        camera.width  = cameraWidth;
+        camera.height = cameraHeight;
+        if(capture != NULL) {
+            fitCamera(&camera, box, offscreenWidth, offscreenHeight);
+        }
+        if(player != NULL) {
+            // Files play a frame per frame, live boxes play everything the recorder sent so far
+            SBX_bool_t decoded = false;
+            do {
+                report = SBXRecordingPlayerNext(player, &decoded);
+            } while(decoded && !report.errorFlags && (player->socket >= 0));
+            playbackEnded = (capture != NULL) && !decoded && !report.errorFlags && (player->socket < 0);
+            if(!report.errorFlags) {
+                report = SBXRecordingPlayerApply(player, box, 20.0L);
+            }
+            if(!report.errorFlags) {
+                report = SBXColorPyramidUpdate(renderer->pyramid, box);
+            }
+            if(!report.errorFlags) {
+                report = drawFrame(&camera, box);
+            }
+            if(report.errorFlags) {
+                printf("Failed to play frame: %s\n", report.reportMessage);
+            }
+        }
+        else {
+            report = SBXFrameRun(frame, box, renderer->pyramid, drawFrame, &camera);
+            if(report.errorFlags) {
+                printf("Failed to run frame: %s\n", report.reportMessage);
+            }
+        }
+        // Read the frame back while the next one runs
+        if((framesPath != NULL) && !playbackEnded) {
+            report = SBXCaptureRead(capture, frameIndex);
+            if(report.errorFlags) {
+                printf("Failed to capture frame: %s\n", report.reportMessage);
+            }
+        }
+        if(!(++frameIndex % FRAME_TIMING_INTERVAL) && frameTiming) {
+            printFrameTiming(frame);
+        }
 
-        // Swap buffers and check for inputs
-        glfwSwapBuffers(window->windowHandle);
+        // Swap buffers and check for inputs, offscreen windows have nothing to show
+        if(capture == NULL) {
+            glfwSwapBuffers(window->windowHandle);
+        }
         glfwPollEvents();
     }
 
     // No error check as we are already exiting
 
+    if(recorder != NULL) {
+        SBXBoxRecordEnd(recorder);
+    }
+    if(player != NULL) {
+        SBXRecordingPlayerClose(player);
+    }
+    SBXFrameDestroy(frame);
+
+    // Destroy the capture, which writes the frames still being read back, and the renderer while the OpenGL context still exists
+    if(capture != NULL) {
+        report = SBXCaptureDestroy(capture);
+        if(report.errorFlags) {
+            printf("Failed to capture frame: %s\n", report.reportMessage);
+        }
+    }
+    SBXRendererDestroy(renderer);
+
     // Deinit and destroy box
     SBXBoxDeinit(box);
     SBXBoxDestroy(box);
@@ -0,0 +1,293 @@
+// Directory listing is a POSIX extension on top of C17
+#if defined(__linux__)
+    #define _GNU_SOURCE
+#endif
+
+// Project headers
+#include <SBX/material.h>
+#include <SBX/strings.h>
+
+// LibC headers
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Platform headers
+#if defined(__unix__) || defined(__APPLE__)
+    #define SBX_MATERIAL_DIRECTORIES
+    #include <dirent.h>
+#endif
+
+// Material file keys, every one of them has to be set once
+enum SBXMaterialKeys {
+    SBX_MATERIAL_KEY_ID    = 1 << 0,
+    SBX_MATERIAL_KEY_NAME  = 1 << 1,
+    SBX_MATERIAL_KEY_COLOR = 1 << 2,
+
+    SBX_MATERIAL_KEY_ALL   = SBX_MATERIAL_KEY_ID | SBX_MATERIAL_KEY_NAME | SBX_MATERIAL_KEY_COLOR
+};
+
+// Trims spaces and tabs off both ends of a string in place
+static char* SBXMaterialTrim(char* text) {
+    while((*text == ' ') || (*text == '\t')) {
+        text++;
+    }
+    size_t length = strlen(text);
+    while(length && ((text[length - 1] == ' ') || (text[length - 1] == '\t') || (text[length - 1] == '\r'))) {
+        text[--length] = '\0';
+    }
+    return text;
+}
+
+// Parses a float from 0 to 1, advancing past it
+static SBX_bool_t SBXMaterialParseChannel(char** text, float* channel) {
+    char* end = *text;
+    *channel = strtof(*text, &end);
+    if((end == *text) || !(*channel >= 0.0f) || (*channel > 1.0f)) {
+        return false;
+    }
+    *text = end;
+    return true;
+}
+
+// Parses the text of a material file, text is modified and has to be terminated
+static SBX_bool_t SBXMaterialParse(char* text, SBX_plock_type_id_t* id, char* name, SBX_plock_type_t* type) {
+    uint32_t keys = 0;
+    for(char* line = text; line != SBX_POINTER_UNSET;) {
+        char* next = strchr(line, '\n');
+        if(next != SBX_POINTER_UNSET) {
+            *next++ = '\0';
+        }
+        line = SBXMaterialTrim(line);
+
+        // Skip blank and comment lines
+        if(!*line || (*line == '#')) {
+            line = next;
+            continue;
+        }
+
+        char* separator = strchr(line, '=');
+        if(separator == SBX_POINTER_UNSET) {
+            return false;
+        }
+        *separator = '\0';
+        char* key = SBXMaterialTrim(line);
+        char* value = SBXMaterialTrim(separator + 1);
+
+        if(!strcmp(key, "id") && !(keys & SBX_MATERIAL_KEY_ID)) {
+            char* end = value;
+            unsigned long parsed = isdigit((unsigned char)*value) ? strtoul(value, &end, 10) : 0;
+            if(*end || (parsed == SBX_PLOCK_TYPE_ID_UNSET) || (parsed >= SBX_PLOCK_TYPE_COUNT)) {
+                return false;
+            }
+            *id = (SBX_plock_type_id_t)parsed;
+            keys |= SBX_MATERIAL_KEY_ID;
+        }
+        else if(!strcmp(key, "name") && !(keys & SBX_MATERIAL_KEY_NAME)) {
+            size_t length = strlen(value);
+            if(!length || (length >= SBX_MATERIAL_NAME_SIZE)) {
+                return false;
+            }
+            for(size_t i = 0; i < length; i++) {
+                if(!isalnum((unsigned char)value[i]) && (value[i] != '_') && (value[i] != '-')) {
+                    return false;
+                }
+            }
+            memcpy(name, value, length + 1);
+            keys |= SBX_MATERIAL_KEY_NAME;
+        }
+        else if(!strcmp(key, "color") && !(keys & SBX_MATERIAL_KEY_COLOR)) {
+            float red, green, blue;
+            if(!SBXMaterialParseChannel(&value, &red) || !SBXMaterialParseChannel(&value, &green) || !SBXMaterialParseChannel(&value, &blue) ||
+               *SBXMaterialTrim(value)) {
+                return false;
+            }
+            type->color = (SBX_color_t){red, green, blue};
+            keys |= SBX_MATERIAL_KEY_COLOR;
+        }
+        else {
+            // Unknown or repeated key
+            return false;
+        }
+
+        line = next;
+    }
+    return keys == SBX_MATERIAL_KEY_ALL;
+}
+
+SBX_report_t SBXMaterialTableReset(SBX_material_table_t* table) {
+    // Check if required arguments are provided
+    if(table == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    for(uint32_t i = 0; i < SBX_PLOCK_TYPE_COUNT; i++) {
+        float shade = 0.25f + 0.75f * (float)i / (float)(SBX_PLOCK_TYPE_COUNT - 1);
+        table->types[i].color = (SBX_color_t){shade, shade, shade};
+        table->names[i][0] = '\0';
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_MATERIAL_TABLE_RESET_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXMaterialTableLoadFile(SBX_material_table_t* table, SBX_string_t path, SBX_plock_type_id_t* id) {
+    // Check if required arguments are provided
+    if((table == SBX_POINTER_UNSET) || (path == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    FILE* file = fopen(path, "rb");
+    if(file == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_IO_FAILURE
+        };
+    }
+
+    // Read one byte past the limit to tell a file that fits from one that doesn't
+    char text[SBX_MATERIAL_FILE_MAXIMUM + 1];
+    size_t size = fread(text, 1, sizeof(text), file);
+    SBX_bool_t readFailed = ferror(file);
+    fclose(file);
+    if(readFailed) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_IO_FAILURE
+        };
+    }
+
+    // Parse into locals so an invalid file leaves the table alone, a zero byte would cut the text short so it makes the file invalid too
+    SBX_plock_type_id_t parsedID = SBX_PLOCK_TYPE_ID_UNSET;
+    char name[SBX_MATERIAL_NAME_SIZE];
+    SBX_plock_type_t type;
+    SBX_bool_t valid = (size <= SBX_MATERIAL_FILE_MAXIMUM) && (memchr(text, '\0', size) == SBX_POINTER_UNSET);
+    if(valid) {
+        text[size] = '\0';
+        valid = SBXMaterialParse(text, &parsedID, name, &type);
+    }
+    if(!valid) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_MATERIAL_INVALID
+        };
+    }
+
+    table->types[parsedID] = type;
+    memcpy(table->names[parsedID], name, sizeof(name));
+    if(id != SBX_POINTER_UNSET) {
+        *id = parsedID;
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_MATERIAL_TABLE_LOAD_FILE_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXMaterialTableLoadDirectory(SBX_material_table_t* table, SBX_string_t directory, uint32_t* count) {
+    // Check if required arguments are provided
+    if((table == SBX_POINTER_UNSET) || (directory == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    SBX_report_t report = {
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_MATERIAL_TABLE_LOAD_DIRECTORY_SUCCESSFUL
+    };
+    uint32_t loaded = 0;
+    // IDs loaded so far, two files defining the same one would override each other in listing order so that makes the second one invalid
+    SBX_bool_t seen[SBX_PLOCK_TYPE_COUNT] = {false};
+    char path[1024];
+
+#if defined(SBX_MATERIAL_DIRECTORIES)
+    DIR* listing = opendir(directory);
+    if(listing == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_IO_FAILURE
+        };
+    }
+    for(struct dirent* entry = readdir(listing); (entry != SBX_POINTER_UNSET) && !report.errorFlags; entry = readdir(listing)) {
+        size_t length = strlen(entry->d_name), extensionLength = strlen(SBX_MATERIAL_EXTENSION);
+        if((length <= extensionLength) || strcmp(entry->d_name + length - extensionLength, SBX_MATERIAL_EXTENSION)) {
+            continue;
+        }
+        if(snprintf(path, sizeof(path), "%s/%s", directory, entry->d_name) >= (int)sizeof(path)) {
+            report = (SBX_report_t){
+                .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+                .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+            };
+            break;
+        }
+#else
+    // Without directory listing, look for the files of the materials the table already has
+    SBX_material_table_t named = *table;
+    for(uint32_t i = 0; (i < SBX_PLOCK_TYPE_COUNT) && !report.errorFlags; i++) {
+        if(!named.names[i][0]) {
+            continue;
+        }
+        if(snprintf(path, sizeof(path), "%s/%s%s", directory, named.names[i], SBX_MATERIAL_EXTENSION) >= (int)sizeof(path)) {
+            report = (SBX_report_t){
+                .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+                .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+            };
+            break;
+        }
+        FILE* probe = fopen(path, "rb");
+        if(probe == SBX_POINTER_UNSET) {
+            continue;
+        }
+        fclose(probe);
+#endif
+        // Load into a copy first so a duplicate ID doesn't replace the material loaded before it
+        SBX_material_table_t candidate = *table;
+        SBX_plock_type_id_t id = SBX_PLOCK_TYPE_ID_UNSET;
+        report = SBXMaterialTableLoadFile(&candidate, path, &id);
+        if(!report.errorFlags && seen[id]) {
+            report = (SBX_report_t){
+                .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+                .reportMessage = SBX_REPORT_STRING_MATERIAL_INVALID
+            };
+        }
+        if(!report.errorFlags) {
+            table->types[id] = candidate.types[id];
+            memcpy(table->names[id], candidate.names[id], SBX_MATERIAL_NAME_SIZE);
+            seen[id] = true;
+            loaded++;
+        }
+    }
+#if defined(SBX_MATERIAL_DIRECTORIES)
+    closedir(listing);
+#endif
+
+    if(count != SBX_POINTER_UNSET) {
+        *count = loaded;
+    }
+    if(!report.errorFlags) {
+        report = (SBX_report_t){
+            .errorFlags    = 0,
+            .reportMessage = SBX_REPORT_STRING_MATERIAL_TABLE_LOAD_DIRECTORY_SUCCESSFUL
+        };
+    }
+    return report;
+}
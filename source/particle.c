@@ -0,0 +1,333 @@
+// Project headers
+#include <SBX/particle.h>
+#include <SBX/strings.h>
+#include <SBX/chunk.h>
+#include <SBX/plock.h>
+
+// LibC headers
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Clamp and maximum written as compares rather than fminf and fmaxf, whose NaN rules keep compilers from vectorizing them
+#define SBX_PARTICLE_CLAMP(v, low, high) ((v) < (low) ? (low) : (v) > (high) ? (high) : (v))
+#define SBX_PARTICLE_MAX(a, b)           ((a) > (b) ? (a) : (b))
+
+// Checks if a position inside the box holds a set plock, reads the plock ID matrix of its chunk directly
+static inline SBX_bool_t SBXParticlePoolOccupied(SBX_box_t* box, uint32_t x, uint32_t y) {
+    SBX_chunk_data_t* data = box->chunks[(y >> SBX_CHUNK_SHIFT) * box->chunkColumns + (x >> SBX_CHUNK_SHIFT)].data;
+    return (data != SBX_POINTER_UNSET) && (*SBXPlockIDMatrixAt(&data->plockIDMatrix, x & SBX_CHUNK_MASK, y & SBX_CHUNK_MASK) != SBX_PLOCK_ID_UNSET);
+}
+
+// Cell column of an x position, positions are clamped inside the box by the integration pass
+static inline uint32_t SBXParticlePoolColumn(SBX_box_t* box, SBX_particle_scalar_t x) {
+    uint32_t column = (uint32_t)x;
+    return column < box->width ? column : box->width - 1u;
+}
+
+// Checks if a particle moving from one position to another within a substep hits a set plock or the bottom of the box.
+// Moves change a cell coordinate by at most one, a diagonal move also passes the side cell whose edge the path crosses first
+static inline SBX_bool_t SBXParticlePoolBlocked(SBX_box_t* box, SBX_particle_scalar_t fromX, SBX_particle_scalar_t fromY,
+                                                SBX_particle_scalar_t toX, SBX_particle_scalar_t toY) {
+    uint32_t fromColumn = SBXParticlePoolColumn(box, fromX), toColumn = SBXParticlePoolColumn(box, toX);
+    SBX_particle_scalar_t fromRow = floorf(fromY), toRow = floorf(toY);
+
+    // The bottom of the box counts as set and everything above the top as unset
+    if(toRow >= (SBX_particle_scalar_t)box->height) {
+        return true;
+    }
+    if((toRow >= 0.0f) && SBXParticlePoolOccupied(box, toColumn, (uint32_t)toRow)) {
+        return true;
+    }
+    if((fromColumn == toColumn) || (fromRow == toRow)) {
+        return false;
+    }
+
+    // Compare the fractions of the move at which the path crosses the column and row edges, cross multiplied to keep the signs
+    SBX_particle_scalar_t edgeX = (SBX_particle_scalar_t)(toColumn > fromColumn ? toColumn : fromColumn);
+    SBX_particle_scalar_t edgeY = toRow > fromRow ? toRow : fromRow;
+    SBX_particle_scalar_t crossX = fabsf((edgeX - fromX) * (toY - fromY)), crossY = fabsf((edgeY - fromY) * (toX - fromX));
+    uint32_t sideColumn = crossX < crossY ? toColumn : fromColumn;
+    SBX_particle_scalar_t sideRow = crossX < crossY ? fromRow : toRow;
+
+    return (sideRow >= 0.0f) && SBXParticlePoolOccupied(box, sideColumn, (uint32_t)sideRow);
+}
+
+// Applies an acceleration along y, clamps both velocity components, and returns the largest component left.
+// The maximum is taken over the bits of the absolute values, which order like the values and reduce as integers without NaN rules getting in the way
+static SBX_particle_scalar_t SBXParticlePoolAccelerate(SBX_particle_scalar_t* restrict velocitiesX, SBX_particle_scalar_t* restrict velocitiesY,
+                                                       SBX_particle_count_t count, SBX_particle_scalar_t acceleration, SBX_particle_scalar_t maximumSpeed) {
+    uint32_t fastest = 0;
+    for(SBX_particle_count_t i = 0; i < count; i++) {
+        SBX_particle_scalar_t velocityX = SBX_PARTICLE_CLAMP(velocitiesX[i], -maximumSpeed, maximumSpeed);
+        SBX_particle_scalar_t velocityY = SBX_PARTICLE_CLAMP(velocitiesY[i] + acceleration, -maximumSpeed, maximumSpeed);
+        velocitiesX[i] = velocityX;
+        velocitiesY[i] = velocityY;
+
+        uint32_t bitsX, bitsY;
+        memcpy(&bitsX, &velocityX, sizeof(bitsX));
+        memcpy(&bitsY, &velocityY, sizeof(bitsY));
+        bitsX  &= 0x7FFFFFFFu;
+        bitsY  &= 0x7FFFFFFFu;
+        fastest = SBX_PARTICLE_MAX(fastest, SBX_PARTICLE_MAX(bitsX, bitsY));
+    }
+
+    SBX_particle_scalar_t speed;
+    memcpy(&speed, &fastest, sizeof(speed));
+    return speed;
+}
+
+// Moves every particle by one substep, keeping the start positions, the sides of the box stop horizontal motion
+static void SBXParticlePoolIntegrate(SBX_particle_scalar_t* restrict positionsX, SBX_particle_scalar_t* restrict positionsY,
+                                     SBX_particle_scalar_t* restrict velocitiesX, const SBX_particle_scalar_t* restrict velocitiesY,
+                                     SBX_particle_scalar_t* restrict previousX, SBX_particle_scalar_t* restrict previousY,
+                                     SBX_particle_count_t count, SBX_particle_scalar_t substep, SBX_particle_scalar_t right) {
+    for(SBX_particle_count_t i = 0; i < count; i++) {
+        SBX_particle_scalar_t x = positionsX[i];
+        SBX_particle_scalar_t y = positionsY[i];
+        previousX[i] = x;
+        previousY[i] = y;
+
+        SBX_particle_scalar_t movedX   = x + velocitiesX[i] * substep;
+        SBX_particle_scalar_t clampedX = SBX_PARTICLE_CLAMP(movedX, 0.0f, right);
+        positionsX[i]  = clampedX;
+        velocitiesX[i] = clampedX == movedX ? velocitiesX[i] : 0.0f;
+        positionsY[i]  = y + velocitiesY[i] * substep;
+    }
+}
+
+SBX_report_t SBXParticlePoolCreate(SBX_particle_pool_t** pool, SBX_particle_count_t capacity, SBX_allocator_t* allocator) {
+    // Check if required arguments are provided
+    if((pool == SBX_POINTER_UNSET) || !capacity) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Allocate memory for the SBXParticlePool struture and its arrays
+    *pool = SBXAllocatorAllocate(allocator, SBX_MEMORY_SUBSYSTEM_PARTICLE, sizeof(SBX_particle_pool_t));
+    if(*pool) {
+        memset(*pool, 0, sizeof(SBX_particle_pool_t));
+        (*pool)->allocator    = allocator;
+        (*pool)->capacity     = capacity;
+        (*pool)->positionsX   = SBXAllocatorAllocate(allocator, SBX_MEMORY_SUBSYSTEM_PARTICLE, capacity * sizeof(SBX_particle_scalar_t));
+        (*pool)->positionsY   = SBXAllocatorAllocate(allocator, SBX_MEMORY_SUBSYSTEM_PARTICLE, capacity * sizeof(SBX_particle_scalar_t));
+        (*pool)->velocitiesX  = SBXAllocatorAllocate(allocator, SBX_MEMORY_SUBSYSTEM_PARTICLE, capacity * sizeof(SBX_particle_scalar_t));
+        (*pool)->velocitiesY  = SBXAllocatorAllocate(allocator, SBX_MEMORY_SUBSYSTEM_PARTICLE, capacity * sizeof(SBX_particle_scalar_t));
+        (*pool)->types        = SBXAllocatorAllocate(allocator, SBX_MEMORY_SUBSYSTEM_PARTICLE, capacity * sizeof(SBX_plock_type_id_t));
+        (*pool)->temperatures = SBXAllocatorAllocate(allocator, SBX_MEMORY_SUBSYSTEM_PARTICLE, capacity * sizeof(SBX_plock_temperature_t));
+        (*pool)->previousX    = SBXAllocatorAllocate(allocator, SBX_MEMORY_SUBSYSTEM_PARTICLE, capacity * sizeof(SBX_particle_scalar_t));
+        (*pool)->previousY    = SBXAllocatorAllocate(allocator, SBX_MEMORY_SUBSYSTEM_PARTICLE, capacity * sizeof(SBX_particle_scalar_t));
+        (*pool)->collided     = SBXAllocatorAllocate(allocator, SBX_MEMORY_SUBSYSTEM_PARTICLE, capacity * sizeof(uint8_t));
+        (*pool)->count        = 0;
+    }
+
+    // Check for a memory allocation error
+    if(!*pool || !(*pool)->positionsX || !(*pool)->positionsY || !(*pool)->velocitiesX || !(*pool)->velocitiesY ||
+       !(*pool)->types || !(*pool)->temperatures || !(*pool)->previousX || !(*pool)->previousY || !(*pool)->collided) {
+        // Free anything that was allocated before exiting
+        if(*pool) {
+            SBXParticlePoolDestroy(*pool);
+            *pool = SBX_POINTER_UNSET;
+        }
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMMON_CREATION_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXParticlePoolDestroy(SBX_particle_pool_t* pool) {
+    // Check if required arguments are provided
+    if(pool == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    SBXAllocatorFree(pool->allocator, SBX_MEMORY_SUBSYSTEM_PARTICLE, pool->positionsX, pool->capacity * sizeof(SBX_particle_scalar_t));
+    SBXAllocatorFree(pool->allocator, SBX_MEMORY_SUBSYSTEM_PARTICLE, pool->positionsY, pool->capacity * sizeof(SBX_particle_scalar_t));
+    SBXAllocatorFree(pool->allocator, SBX_MEMORY_SUBSYSTEM_PARTICLE, pool->velocitiesX, pool->capacity * sizeof(SBX_particle_scalar_t));
+    SBXAllocatorFree(pool->allocator, SBX_MEMORY_SUBSYSTEM_PARTICLE, pool->velocitiesY, pool->capacity * sizeof(SBX_particle_scalar_t));
+    SBXAllocatorFree(pool->allocator, SBX_MEMORY_SUBSYSTEM_PARTICLE, pool->types, pool->capacity * sizeof(SBX_plock_type_id_t));
+    SBXAllocatorFree(pool->allocator, SBX_MEMORY_SUBSYSTEM_PARTICLE, pool->temperatures, pool->capacity * sizeof(SBX_plock_temperature_t));
+    SBXAllocatorFree(pool->allocator, SBX_MEMORY_SUBSYSTEM_PARTICLE, pool->previousX, pool->capacity * sizeof(SBX_particle_scalar_t));
+    SBXAllocatorFree(pool->allocator, SBX_MEMORY_SUBSYSTEM_PARTICLE, pool->previousY, pool->capacity * sizeof(SBX_particle_scalar_t));
+    SBXAllocatorFree(pool->allocator, SBX_MEMORY_SUBSYSTEM_PARTICLE, pool->collided, pool->capacity * sizeof(uint8_t));
+    SBXAllocatorFree(pool->allocator, SBX_MEMORY_SUBSYSTEM_PARTICLE, pool, sizeof(SBX_particle_pool_t));
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMMON_DESTRUCTION_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXParticlePoolEject(SBX_particle_pool_t* pool, SBX_box_t* box, SBX_box_position_t x, SBX_box_position_t y,
+                                  SBX_particle_scalar_t velocityX, SBX_particle_scalar_t velocityY) {
+    // Check if required arguments are provided
+    if((pool == SBX_POINTER_UNSET) || (box == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Get the plock, this checks the box state and position, so it always takes the validated call
+    SBX_plock_t plock;
+    SBX_report_t report = (SBXBoxGetPlock)(box, x, y, &plock);
+    if(report.errorFlags) {
+        return report;
+    }
+    if(plock.type == SBX_PLOCK_TYPE_ID_UNSET) {
+        return (SBX_report_t){
+            .errorFlags    = 0,
+            .reportMessage = SBX_REPORT_STRING_PARTICLE_POOL_EJECT_SUCCESSFUL
+        };
+    }
+
+    // Check for a free particle
+    if(pool->count == pool->capacity) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_PARTICLE_POOL_ERROR_FULL,
+            .reportMessage = SBX_REPORT_STRING_PARTICLE_POOL_FULL
+        };
+    }
+
+    // Unsetting a plock never allocates, so this can't fail after the checks above
+    SBXBoxSetPlock(box, x, y, (SBX_plock_t){.type = SBX_PLOCK_TYPE_ID_UNSET, .temperature = SBX_TEMPERATURE_UNSET});
+
+    SBX_particle_count_t i = pool->count++;
+    pool->positionsX[i]   = x + 0.5f;
+    pool->positionsY[i]   = y + 0.5f;
+    pool->velocitiesX[i]  = velocityX;
+    pool->velocitiesY[i]  = velocityY;
+    pool->types[i]        = plock.type;
+    pool->temperatures[i] = plock.temperature;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_PARTICLE_POOL_EJECT_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXParticlePoolStep(SBX_particle_pool_t* pool, SBX_box_t* box, SBX_particle_scalar_t gravity, SBX_particle_scalar_t timeStep) {
+    // Check if required arguments are provided
+    if((pool == SBX_POINTER_UNSET) || (box == SBX_POINTER_UNSET) || !(timeStep > 0.0f)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for box initialized
+    if(!box->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_NOT_INIT,
+            .reportMessage = SBX_REPORT_STRING_BOX_NOT_INIT
+        };
+    }
+
+    SBX_report_t report = {
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_PARTICLE_POOL_STEP_SUCCESSFUL
+    };
+
+    // Accelerate, clamp velocities so a particle moves at most SBX_PARTICLE_POOL_MAX_SUBSTEPS cells, and find the fastest particle
+    SBX_particle_count_t  count   = pool->count;
+    SBX_particle_scalar_t fastest = SBXParticlePoolAccelerate(pool->velocitiesX, pool->velocitiesY, count,
+                                                              gravity * timeStep, SBX_PARTICLE_POOL_MAX_SUBSTEPS / timeStep);
+
+    // Split the step so no particle skips over a cell
+    uint32_t substeps = (uint32_t)ceilf(fastest * timeStep);
+    substeps = substeps < 1 ? 1 : substeps > SBX_PARTICLE_POOL_MAX_SUBSTEPS ? SBX_PARTICLE_POOL_MAX_SUBSTEPS : substeps;
+    SBX_particle_scalar_t substep = timeStep / substeps;
+
+    SBX_particle_scalar_t* positionsX  = pool->positionsX;
+    SBX_particle_scalar_t* positionsY  = pool->positionsY;
+    SBX_particle_scalar_t* velocitiesX = pool->velocitiesX;
+    SBX_particle_scalar_t* velocitiesY = pool->velocitiesY;
+    SBX_particle_scalar_t* previousX   = pool->previousX;
+    SBX_particle_scalar_t* previousY   = pool->previousY;
+    uint8_t*               collided    = pool->collided;
+
+    for(uint32_t s = 0; s < substeps && count; s++) {
+        SBXParticlePoolIntegrate(positionsX, positionsY, velocitiesX, velocitiesY, previousX, previousY,
+                                 count, substep, (SBX_particle_scalar_t)box->width);
+
+        // Test the cells the particles moved into or through
+        SBX_particle_count_t collisions = 0;
+        for(SBX_particle_count_t i = 0; i < count; i++) {
+            collided[i] = SBXParticlePoolBlocked(box, previousX[i], previousY[i], positionsX[i], positionsY[i]);
+            collisions += collided[i];
+        }
+        if(!collisions) {
+            continue;
+        }
+
+        // Put particles that collided back into the box, in the cell they came from or the first free cell above it
+        for(SBX_particle_count_t i = 0; i < count; i++) {
+            if(!collided[i]) {
+                continue;
+            }
+
+            uint32_t x = SBXParticlePoolColumn(box, previousX[i]);
+            int64_t  y = (int64_t)floorf(previousY[i]);
+            y = y < box->height ? y : box->height - 1;
+            while((y >= 0) && SBXParticlePoolOccupied(box, x, (uint32_t)y)) {
+                y--;
+            }
+
+            // A particle over a column filled to the top of the box rests on top of it in flight, landing once the column has room
+            if(y < 0) {
+                collided[i]    = false;
+                positionsX[i]  = x + 0.5f;
+                positionsY[i]  = -0.5f;
+                velocitiesX[i] = 0.0f;
+                velocitiesY[i] = 0.0f;
+                continue;
+            }
+
+            SBX_report_t setReport = SBXBoxSetPlock(box, (SBX_box_position_t)x, (SBX_box_position_t)y,
+                                                    (SBX_plock_t){.type = pool->types[i], .temperature = pool->temperatures[i]});
+            if(setReport.errorFlags) {
+                // Keep the particle in flight where it was so the next step tries again
+                report         = setReport;
+                collided[i]    = false;
+                positionsX[i]  = previousX[i];
+                positionsY[i]  = previousY[i];
+                velocitiesX[i] = 0.0f;
+                velocitiesY[i] = 0.0f;
+            }
+        }
+
+        // Compact the arrays over the particles that left flight
+        SBX_particle_count_t kept = 0;
+        for(SBX_particle_count_t i = 0; i < count; i++) {
+            positionsX[kept]          = positionsX[i];
+            positionsY[kept]          = positionsY[i];
+            velocitiesX[kept]         = velocitiesX[i];
+            velocitiesY[kept]         = velocitiesY[i];
+            pool->types[kept]         = pool->types[i];
+            pool->temperatures[kept]  = pool->temperatures[i];
+            kept                     += !collided[i];
+        }
+        count = kept;
+    }
+    pool->count = count;
+
+    return report;
+}
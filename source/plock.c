@@ -3,6 +3,7 @@
 #include <SBX/strings.h>
 
 // LibC headers
+#include <stdlib.h>
 #include <string.h>
 
 SBX_report_t SBXPlockArrayGetSize(SBX_plock_array_t* plockArray, SBX_plock_count_t* count) {
@@ -37,9 +38,13 @@ SBX_report_t SBXPlockArraySetSize(SBX_plock_array_t* plockArray, SBX_plock_count
     }
 
     // If count is 0 destroy the array
-    if(!count && (plockArray->plocks =! SBX_POINTER_UNSET)) {
-        free(plockArray->plocks);
-        plockArray->count = 0;
+    if(!count) {
+        SBXAllocatorFree(plockArray->allocator, SBX_MEMORY_SUBSYSTEM_PLOCK_ARRAY, plockArray->plocks, sizeof(SBX_plock_t) * plockArray->count);
+        SBXAllocatorFree(plockArray->allocator, SBX_MEMORY_SUBSYSTEM_PLOCK_ARRAY, plockArray->freeIDs, sizeof(SBX_plock_id_t) * plockArray->count);
+        plockArray->plocks    = SBX_POINTER_UNSET;
+        plockArray->freeIDs   = SBX_POINTER_UNSET;
+        plockArray->count     = 0;
+        plockArray->freeCount = 0;
 
         return (SBX_report_t){
             .errorFlags    = 0,
@@ -47,17 +52,46 @@ SBX_report_t SBXPlockArraySetSize(SBX_plock_array_t* plockArray, SBX_plock_count
         };
     }
 
-    // Allocate memory for the internal array in the SBXPlockArray structure, realloc will malloc if the plocks pointer is NULL
-    plockArray->plocks = realloc(plockArray->plocks, sizeof(SBX_plock_t) * count);
+    // Allocate memory for the internal array in the SBXPlockArray structure, reallocation will allocate if the plocks pointer is NULL
+    SBX_plock_t* newPlocks = SBXAllocatorReallocate(plockArray->allocator, SBX_MEMORY_SUBSYSTEM_PLOCK_ARRAY, plockArray->plocks,
+                                                    sizeof(SBX_plock_t) * plockArray->count, sizeof(SBX_plock_t) * count);
 
     // Check for a memory allocation error
-    if(plockArray->plocks == SBX_POINTER_UNSET) {
+    if(newPlocks == SBX_POINTER_UNSET) {
         // Return error
         return (SBX_report_t){
             .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
             .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
         };
     }
+    plockArray->plocks = newPlocks;
+
+    // Allocate memory for the free ID stack, every plock can be free at once so it matches the plock count
+    SBX_plock_id_t* newFreeIDs = SBXAllocatorReallocate(plockArray->allocator, SBX_MEMORY_SUBSYSTEM_PLOCK_ARRAY, plockArray->freeIDs,
+                                                        sizeof(SBX_plock_id_t) * plockArray->count, sizeof(SBX_plock_id_t) * count);
+
+    // Check for a memory allocation error
+    if(newFreeIDs == SBX_POINTER_UNSET) {
+        // Put the plocks back to the old count so the array stays consistent with its allocator
+        if(!plockArray->count) {
+            SBXAllocatorFree(plockArray->allocator, SBX_MEMORY_SUBSYSTEM_PLOCK_ARRAY, plockArray->plocks, sizeof(SBX_plock_t) * count);
+            plockArray->plocks = SBX_POINTER_UNSET;
+        }
+        else {
+            newPlocks = SBXAllocatorReallocate(plockArray->allocator, SBX_MEMORY_SUBSYSTEM_PLOCK_ARRAY, plockArray->plocks,
+                                               sizeof(SBX_plock_t) * count, sizeof(SBX_plock_t) * plockArray->count);
+            if(newPlocks != SBX_POINTER_UNSET) {
+                plockArray->plocks = newPlocks;
+            }
+        }
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+    plockArray->freeIDs = newFreeIDs;
 
     // Set SBXPlockArray new internal array members to values unset
     for(SBX_plock_count_t i = plockArray->count; i < count; i++) {
@@ -68,12 +102,72 @@ SBX_report_t SBXPlockArraySetSize(SBX_plock_array_t* plockArray, SBX_plock_count
     // Update the count variable in the SBXPlockArray
     plockArray->count = count;
 
+    // Rebuild the free ID stack from the highest ID down so the lowest IDs get handed out first
+    plockArray->freeCount = 0;
+    for(SBX_plock_count_t i = count; i > 0; i--) {
+        if(plockArray->plocks[i - 1].type == SBX_PLOCK_TYPE_ID_UNSET) {
+            plockArray->freeIDs[plockArray->freeCount++] = SBX_PLOCK_INDEX_TO_ID(i - 1);
+        }
+    }
+
     return (SBX_report_t){
         .errorFlags    = 0,
         .reportMessage = SBX_REPORT_STRING_PLOCK_ARRAY_SET_SIZE_SUCCESSFUL
     };
 }
 
+SBX_report_t SBXPlockArrayAcquire(SBX_plock_array_t* plockArray, SBX_plock_id_t* plockID) {
+    // Check if required arguments are provided
+    if((plockArray == SBX_POINTER_UNSET) || (plockID == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for a free plock ID
+    if(!plockArray->freeCount) {
+        *plockID = SBX_PLOCK_ID_UNSET;
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_PLOCK_ARRAY_ERROR_FULL,
+            .reportMessage = SBX_REPORT_STRING_PLOCK_ARRAY_FULL
+        };
+    }
+
+    // Pop a plock ID off the free ID stack
+    *plockID = plockArray->freeIDs[--plockArray->freeCount];
+
+    // Return success
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_PLOCK_ARRAY_ACQUIRE_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXPlockArrayRelease(SBX_plock_array_t* plockArray, SBX_plock_id_t plockID) {
+    // Check if required arguments are provided
+    if((plockArray == SBX_POINTER_UNSET) || (plockID == SBX_PLOCK_ID_UNSET) || (plockID > plockArray->count)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Reset the plock to unset values and push its ID back onto the free ID stack
+    plockArray->plocks[SBX_PLOCK_ID_TO_INDEX(plockID)].temperature = SBX_TEMPERATURE_UNSET;
+    plockArray->plocks[SBX_PLOCK_ID_TO_INDEX(plockID)].type        = SBX_PLOCK_TYPE_ID_UNSET;
+    plockArray->freeIDs[plockArray->freeCount++] = plockID;
+
+    // Return success
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_PLOCK_ARRAY_RELEASE_SUCCESSFUL
+    };
+}
+
 SBX_report_t SBXPlockIDMatrixGetSize(SBX_plock_id_matrix_t* plockIDMatrix,
                                      SBX_plock_id_matrix_dimensions_t* width, SBX_plock_id_matrix_dimensions_t* height)
 {
@@ -86,10 +180,10 @@ SBX_report_t SBXPlockIDMatrixGetSize(SBX_plock_id_matrix_t* plockIDMatrix,
         };
     }
 
-    if(width != SBX_DIMENSION_UNSET) {
+    if(width != SBX_POINTER_UNSET) {
         *width = plockIDMatrix->width;
     }
-    if(height != SBX_DIMENSION_UNSET) {
+    if(height != SBX_POINTER_UNSET) {
         *height = plockIDMatrix->height;
     }
 
@@ -113,8 +207,10 @@ SBX_report_t SBXPlockIDMatrixSetSize(SBX_plock_id_matrix_t* plockIDMatrix,
     }
 
     // If width or height is 0 destroy the matrix
-    if((width == SBX_DIMENSION_UNSET || height == SBX_DIMENSION_UNSET) && plockIDMatrix->plockIDs != SBX_POINTER_UNSET) {
-        free(plockIDMatrix->plockIDs);
+    if(width == SBX_DIMENSION_UNSET || height == SBX_DIMENSION_UNSET) {
+        SBXAllocatorFree(plockIDMatrix->allocator, SBX_MEMORY_SUBSYSTEM_PLOCK_ID_MATRIX, plockIDMatrix->plockIDs,
+                         sizeof(SBX_plock_id_t) * plockIDMatrix->width * plockIDMatrix->height);
+        plockIDMatrix->plockIDs = SBX_POINTER_UNSET;
         plockIDMatrix->width  = 0;
         plockIDMatrix->height = 0;
 
@@ -124,8 +220,8 @@ SBX_report_t SBXPlockIDMatrixSetSize(SBX_plock_id_matrix_t* plockIDMatrix,
         };
     }
 
-    // Allocate memory for the new internal array in the SBXPlockArray structure, calloc is used to NULL the new memory on allocation, cleaning up the code
-    SBX_plock_id_t* newPlockIDs = calloc(width * height, sizeof(SBX_plock_id_t));
+    // Allocate memory for the new internal array in the SBXPlockArray structure
+    SBX_plock_id_t* newPlockIDs = SBXAllocatorAllocate(plockIDMatrix->allocator, SBX_MEMORY_SUBSYSTEM_PLOCK_ID_MATRIX, sizeof(SBX_plock_id_t) * width * height);
 
     // Check for a memory allocation error
     if(newPlockIDs == SBX_POINTER_UNSET) {
@@ -136,21 +232,25 @@ SBX_report_t SBXPlockIDMatrixSetSize(SBX_plock_id_matrix_t* plockIDMatrix,
         };
     }
 
-    // Copy SBX_plock_id_t data from old matrix to new one
-    for(SBX_plock_id_matrix_dimensions_t y = plockIDMatrix->height - 1; y > 0; y--) {
+    // Unset every plock ID, then copy SBX_plock_id_t data from old matrix to new one
+    memset(newPlockIDs, 0, sizeof(SBX_plock_id_t) * width * height);
+    SBX_plock_id_matrix_dimensions_t copyWidth  = plockIDMatrix->width  < width  ? plockIDMatrix->width  : width;
+    SBX_plock_id_matrix_dimensions_t copyHeight = plockIDMatrix->height < height ? plockIDMatrix->height : height;
+    for(SBX_plock_id_matrix_dimensions_t y = 0; y < copyHeight; y++) {
         void* dest = &newPlockIDs[y * width];
         void* src  = &plockIDMatrix->plockIDs[y * plockIDMatrix->width];
-        memcpy(dest, src, (plockIDMatrix->width < width ? plockIDMatrix->width : width) * sizeof(SBX_plock_id_t));
+        memcpy(dest, src, copyWidth * sizeof(SBX_plock_id_t));
     }
 
+    // Free old plockIDs pointer and set to newPlockIDs
+    SBXAllocatorFree(plockIDMatrix->allocator, SBX_MEMORY_SUBSYSTEM_PLOCK_ID_MATRIX, plockIDMatrix->plockIDs,
+                     sizeof(SBX_plock_id_t) * plockIDMatrix->width * plockIDMatrix->height);
+    plockIDMatrix->plockIDs = newPlockIDs;
+
     // Update the width and height variables in the SBXPlockIDMatrix
     plockIDMatrix->width  = width;
     plockIDMatrix->height = height;
 
-    // Free old plockIDs pointer and set to newPlockIDs
-    free(plockIDMatrix->plockIDs);
-    plockIDMatrix->plockIDs = newPlockIDs;
-
     return (SBX_report_t){
         .errorFlags    = 0,
         .reportMessage = SBX_REPORT_STRING_PLOCK_ID_MATRIX_SET_SIZE_SUCCESSFUL
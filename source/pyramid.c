@@ -0,0 +1,415 @@
+// Project headers
+#include <SBX/pyramid.h>
+#include <SBX/strings.h>
+#include <SBX/chunk.h>
+#include <SBX/plock.h>
+
+// LibC headers
+#include <math.h>
+#include <string.h>
+
+// Frees the levels of every chunk and the chunk array, sized for the current chunk table
+static void SBXColorPyramidFreeChunks(SBX_color_pyramid_t* pyramid) {
+    SBX_chunk_index_t chunkCount = (SBX_chunk_index_t)pyramid->chunkColumns * pyramid->chunkRows;
+    if(pyramid->chunks == SBX_POINTER_UNSET) {
+        return;
+    }
+    for(SBX_chunk_index_t c = 0; c < chunkCount; c++) {
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_RENDER, pyramid->chunks[c].texels, SBX_COLOR_PYRAMID_CHUNK_TEXELS * SBX_COLOR_PYRAMID_TEXEL_SIZE);
+    }
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_RENDER, pyramid->chunks, (chunkCount ? chunkCount : 1) * sizeof(SBX_color_pyramid_chunk_t));
+    pyramid->chunks = SBX_POINTER_UNSET;
+}
+
+// Converts the colors of the plock types to RGBA8
+static void SBXColorPyramidFillPalette(SBX_color_pyramid_t* pyramid, const SBX_plock_type_t* types) {
+    for(uint32_t t = 0; t < SBX_PLOCK_TYPE_COUNT; t++) {
+        SBX_color_t color = types[t].color;
+        if((color.raw[0] < 0.0f) && (color.raw[1] < 0.0f) && (color.raw[2] < 0.0f)) {
+            memset(pyramid->palette[t], 0, SBX_COLOR_PYRAMID_TEXEL_SIZE);
+            continue;
+        }
+        for(uint32_t channel = 0; channel < 3; channel++) {
+            float value = color.raw[channel] < 0.0f ? 0.0f : color.raw[channel] > 1.0f ? 1.0f : color.raw[channel];
+            pyramid->palette[t][channel] = (uint8_t)(value * 255.0f + 0.5f);
+        }
+        pyramid->palette[t][3] = UINT8_MAX;
+    }
+}
+
+// Lays the chunk array out again when the chunk table changed size, every chunk is reduced again
+static SBX_report_t SBXColorPyramidFit(SBX_color_pyramid_t* pyramid, SBX_box_t* box) {
+    if((pyramid->chunks != SBX_POINTER_UNSET) && (pyramid->chunkColumns == box->chunkColumns) && (pyramid->chunkRows == box->chunkRows)) {
+        return (SBX_report_t){
+            .errorFlags    = 0,
+            .reportMessage = SBX_REPORT_STRING_COLOR_PYRAMID_UPDATE_SUCCESSFUL
+        };
+    }
+
+    // Empty chunk tables still get one entry so the array is never empty
+    SBX_chunk_index_t chunkCount = (SBX_chunk_index_t)box->chunkColumns * box->chunkRows;
+    size_t            entries    = chunkCount ? chunkCount : 1;
+    SBX_color_pyramid_chunk_t* chunks = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_RENDER, entries * sizeof(SBX_color_pyramid_chunk_t));
+
+    // Check for a memory allocation error
+    if(!chunks) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+    memset(chunks, 0, entries * sizeof(SBX_color_pyramid_chunk_t));
+
+    SBXColorPyramidFreeChunks(pyramid);
+    pyramid->chunks       = chunks;
+    pyramid->chunkColumns = box->chunkColumns;
+    pyramid->chunkRows    = box->chunkRows;
+    pyramid->stale        = true;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COLOR_PYRAMID_UPDATE_SUCCESSFUL
+    };
+}
+
+// Premultiplied RGBA8 color of the plock at a position of a chunk, transparent for unset positions
+static inline const uint8_t* SBXColorPyramidPlockColor(const SBX_color_pyramid_t* pyramid, const SBX_chunk_data_t* data, uint32_t x, uint32_t y) {
+    static const uint8_t transparent[SBX_COLOR_PYRAMID_TEXEL_SIZE] = {0, 0, 0, 0};
+    SBX_plock_id_t id = *SBXPlockIDMatrixAt(&data->plockIDMatrix, x, y);
+    if(id == SBX_PLOCK_ID_UNSET) {
+        return transparent;
+    }
+    return pyramid->palette[data->plockArray.plocks[SBX_PLOCK_ID_TO_INDEX(id)].type];
+}
+
+// Reduces the plocks of a chunk into level 1, then every level into the next by averaging 2 by 2 texels
+static void SBXColorPyramidBuild(const SBX_color_pyramid_t* pyramid, const SBX_chunk_data_t* data, uint8_t* texels) {
+    uint8_t* level = &texels[SBX_COLOR_PYRAMID_LEVEL_OFFSET(1) * SBX_COLOR_PYRAMID_TEXEL_SIZE];
+    for(uint32_t y = 0; y < SBX_COLOR_PYRAMID_LEVEL_SIZE(1); y++) {
+        for(uint32_t x = 0; x < SBX_COLOR_PYRAMID_LEVEL_SIZE(1); x++) {
+            const uint8_t* a = SBXColorPyramidPlockColor(pyramid, data, 2 * x, 2 * y);
+            const uint8_t* b = SBXColorPyramidPlockColor(pyramid, data, 2 * x + 1, 2 * y);
+            const uint8_t* c = SBXColorPyramidPlockColor(pyramid, data, 2 * x, 2 * y + 1);
+            const uint8_t* d = SBXColorPyramidPlockColor(pyramid, data, 2 * x + 1, 2 * y + 1);
+            uint8_t* texel = &level[(y * SBX_COLOR_PYRAMID_LEVEL_SIZE(1) + x) * SBX_COLOR_PYRAMID_TEXEL_SIZE];
+            for(uint32_t channel = 0; channel < SBX_COLOR_PYRAMID_TEXEL_SIZE; channel++) {
+                texel[channel] = (uint8_t)((a[channel] + b[channel] + c[channel] + d[channel] + 2) >> 2);
+            }
+        }
+    }
+
+    for(uint8_t l = 2; l < SBX_COLOR_PYRAMID_LEVEL_COUNT; l++) {
+        const uint8_t* source     = &texels[SBX_COLOR_PYRAMID_LEVEL_OFFSET(l - 1) * SBX_COLOR_PYRAMID_TEXEL_SIZE];
+        uint8_t*       target     = &texels[SBX_COLOR_PYRAMID_LEVEL_OFFSET(l) * SBX_COLOR_PYRAMID_TEXEL_SIZE];
+        uint32_t       sourceRow  = SBX_COLOR_PYRAMID_LEVEL_SIZE(l - 1) * SBX_COLOR_PYRAMID_TEXEL_SIZE;
+        uint32_t       targetSize = SBX_COLOR_PYRAMID_LEVEL_SIZE(l);
+        for(uint32_t y = 0; y < targetSize; y++) {
+            for(uint32_t x = 0; x < targetSize; x++) {
+                const uint8_t* top    = &source[2 * y * sourceRow + 2 * x * SBX_COLOR_PYRAMID_TEXEL_SIZE];
+                const uint8_t* bottom = top + sourceRow;
+                uint8_t*       texel  = &target[(y * targetSize + x) * SBX_COLOR_PYRAMID_TEXEL_SIZE];
+                for(uint32_t channel = 0; channel < SBX_COLOR_PYRAMID_TEXEL_SIZE; channel++) {
+                    texel[channel] = (uint8_t)((top[channel] + top[channel + SBX_COLOR_PYRAMID_TEXEL_SIZE] +
+                                                bottom[channel] + bottom[channel + SBX_COLOR_PYRAMID_TEXEL_SIZE] + 2) >> 2);
+                }
+            }
+        }
+    }
+}
+
+SBX_report_t SBXColorPyramidCreate(SBX_color_pyramid_t** pyramid, const SBX_plock_type_t* types) {
+    // Check if required arguments are provided
+    if((pyramid == SBX_POINTER_UNSET) || (types == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Allocate memory for the SBXColorPyramid struture, the chunk levels are allocated once a box is known
+    *pyramid = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_RENDER, sizeof(SBX_color_pyramid_t));
+
+    // Check for a memory allocation error
+    if(!*pyramid) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    memset(*pyramid, 0, sizeof(SBX_color_pyramid_t));
+    SBXColorPyramidFillPalette(*pyramid, types);
+    (*pyramid)->stale = true;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMMON_CREATION_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXColorPyramidDestroy(SBX_color_pyramid_t* pyramid) {
+    // Check if required arguments are provided
+    if(pyramid == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    SBXColorPyramidFreeChunks(pyramid);
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_RENDER, pyramid, sizeof(SBX_color_pyramid_t));
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMMON_DESTRUCTION_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXColorPyramidSetPalette(SBX_color_pyramid_t* pyramid, const SBX_plock_type_t* types) {
+    // Check if required arguments are provided
+    if((pyramid == SBX_POINTER_UNSET) || (types == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    SBXColorPyramidFillPalette(pyramid, types);
+    pyramid->stale = true;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COLOR_PYRAMID_SET_PALETTE_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXColorPyramidBeginUpdate(SBX_color_pyramid_t* pyramid, SBX_box_t* box) {
+    // Check if required arguments are provided
+    if((pyramid == SBX_POINTER_UNSET) || (box == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for box initialized
+    if(!box->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_NOT_INIT,
+            .reportMessage = SBX_REPORT_STRING_BOX_NOT_INIT
+        };
+    }
+
+    SBX_report_t report = SBXColorPyramidFit(pyramid, box);
+    if(report.errorFlags) {
+        return report;
+    }
+    atomic_store_explicit(&pyramid->rebuiltChunkCount, 0, memory_order_relaxed);
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COLOR_PYRAMID_UPDATE_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXColorPyramidUpdateChunk(SBX_color_pyramid_t* pyramid, SBX_box_t* box, SBX_chunk_index_t chunkIndex) {
+    // Check if required arguments are provided
+    if((pyramid == SBX_POINTER_UNSET) || (box == SBX_POINTER_UNSET) || (pyramid->chunks == SBX_POINTER_UNSET) ||
+       (pyramid->chunkColumns != box->chunkColumns) || (pyramid->chunkRows != box->chunkRows) ||
+       (chunkIndex >= (SBX_chunk_index_t)box->chunkColumns * box->chunkRows)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    SBX_color_pyramid_chunk_t* chunk = &pyramid->chunks[chunkIndex];
+    SBX_chunk_data_t*          data  = box->chunks[chunkIndex].data;
+    uint64_t hash = data == SBX_POINTER_UNSET ? 0 : data->typeHash;
+    if(!pyramid->stale && (chunk->hash == hash)) {
+        return (SBX_report_t){
+            .errorFlags    = 0,
+            .reportMessage = SBX_REPORT_STRING_COLOR_PYRAMID_UPDATE_SUCCESSFUL
+        };
+    }
+
+    // Chunks without plocks are transparent at every level and keep no texels
+    if((data == SBX_POINTER_UNSET) || !data->plockCount) {
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_RENDER, chunk->texels, SBX_COLOR_PYRAMID_CHUNK_TEXELS * SBX_COLOR_PYRAMID_TEXEL_SIZE);
+        chunk->texels = SBX_POINTER_UNSET;
+    }
+    else {
+        if(chunk->texels == SBX_POINTER_UNSET) {
+            chunk->texels = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_RENDER, SBX_COLOR_PYRAMID_CHUNK_TEXELS * SBX_COLOR_PYRAMID_TEXEL_SIZE);
+
+            // Check for a memory allocation error, the chunk keeps its old hash so the next update tries again
+            if(!chunk->texels) {
+                // Return error
+                return (SBX_report_t){
+                    .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+                    .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+                };
+            }
+        }
+        SBXColorPyramidBuild(pyramid, data, chunk->texels);
+    }
+
+    chunk->hash = hash;
+    chunk->revision++;
+    atomic_fetch_add_explicit(&pyramid->rebuiltChunkCount, 1, memory_order_relaxed);
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COLOR_PYRAMID_UPDATE_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXColorPyramidEndUpdate(SBX_color_pyramid_t* pyramid) {
+    // Check if required arguments are provided
+    if(pyramid == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    pyramid->stale = false;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COLOR_PYRAMID_UPDATE_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXColorPyramidUpdate(SBX_color_pyramid_t* pyramid, SBX_box_t* box) {
+    SBX_report_t report = SBXColorPyramidBeginUpdate(pyramid, box);
+    if(report.errorFlags) {
+        return report;
+    }
+
+    SBX_chunk_index_t chunkCount = (SBX_chunk_index_t)box->chunkColumns * box->chunkRows;
+    for(SBX_chunk_index_t c = 0; c < chunkCount; c++) {
+        report = SBXColorPyramidUpdateChunk(pyramid, box, c);
+        if(report.errorFlags) {
+            return report;
+        }
+    }
+
+    return SBXColorPyramidEndUpdate(pyramid);
+}
+
+SBX_report_t SBXColorPyramidGetView(SBX_color_pyramid_t* pyramid, float cameraX, float cameraY, float cameraWidth, float cameraHeight,
+                                    uint32_t pixelWidth, uint32_t pixelHeight, SBX_color_pyramid_view_t* view) {
+    // Check if required arguments are provided
+    if((pyramid == SBX_POINTER_UNSET) || !(cameraWidth > 0.0f) || !(cameraHeight > 0.0f) || !pixelWidth || !pixelHeight || (view == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Largest level whose texels are no bigger than a screen pixel, so the drawn texels are at most about 2 screen widths across
+    float positionsPerPixel = cameraWidth / (float)pixelWidth;
+    if(cameraHeight / (float)pixelHeight > positionsPerPixel) {
+        positionsPerPixel = cameraHeight / (float)pixelHeight;
+    }
+    uint8_t level = 0;
+    while((level < SBX_CHUNK_SHIFT) && ((float)(2u << level) <= positionsPerPixel)) {
+        level++;
+    }
+
+    // Chunks overlapped by the camera, clipped to the chunk table
+    float firstX = cameraX < 0.0f ? 0.0f : cameraX;
+    float firstY = cameraY < 0.0f ? 0.0f : cameraY;
+    float lastX  = cameraX + cameraWidth;
+    float lastY  = cameraY + cameraHeight;
+    float tableWidth  = (float)((uint32_t)pyramid->chunkColumns << SBX_CHUNK_SHIFT);
+    float tableHeight = (float)((uint32_t)pyramid->chunkRows << SBX_CHUNK_SHIFT);
+    lastX = lastX > tableWidth ? tableWidth : lastX;
+    lastY = lastY > tableHeight ? tableHeight : lastY;
+
+    *view = (SBX_color_pyramid_view_t){
+        .level       = level,
+        .firstColumn = 0,
+        .firstRow    = 0,
+        .columns     = 0,
+        .rows        = 0
+    };
+    if((lastX > firstX) && (lastY > firstY)) {
+        uint32_t firstColumn = (uint32_t)firstX >> SBX_CHUNK_SHIFT;
+        uint32_t firstRow    = (uint32_t)firstY >> SBX_CHUNK_SHIFT;
+        uint32_t lastColumn  = ((uint32_t)ceilf(lastX) - 1) >> SBX_CHUNK_SHIFT;
+        uint32_t lastRow     = ((uint32_t)ceilf(lastY) - 1) >> SBX_CHUNK_SHIFT;
+        view->firstColumn = (SBX_chunk_dimensions_t)firstColumn;
+        view->firstRow    = (SBX_chunk_dimensions_t)firstRow;
+        view->columns     = (SBX_chunk_dimensions_t)(lastColumn - firstColumn + 1);
+        view->rows        = (SBX_chunk_dimensions_t)(lastRow - firstRow + 1);
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COLOR_PYRAMID_GET_VIEW_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXColorPyramidWriteChunk(SBX_color_pyramid_t* pyramid, SBX_box_t* box, SBX_chunk_index_t chunkIndex, uint8_t level,
+                                       uint8_t* pixels, size_t rowStride) {
+    // Check if required arguments are provided
+    if((pyramid == SBX_POINTER_UNSET) || (box == SBX_POINTER_UNSET) || (level >= SBX_COLOR_PYRAMID_LEVEL_COUNT) || (pixels == SBX_POINTER_UNSET) ||
+       (rowStride < (size_t)SBX_COLOR_PYRAMID_LEVEL_SIZE(level) * SBX_COLOR_PYRAMID_TEXEL_SIZE)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check if the chunk is part of the last update
+    if((pyramid->chunks == SBX_POINTER_UNSET) || (chunkIndex >= (SBX_chunk_index_t)pyramid->chunkColumns * pyramid->chunkRows) ||
+       (pyramid->chunkColumns != box->chunkColumns) || (pyramid->chunkRows != box->chunkRows)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_OUT_OF_BOUNDS,
+            .reportMessage = SBX_REPORT_STRING_BOX_OUT_OF_BOUNDS
+        };
+    }
+
+    uint32_t size     = SBX_COLOR_PYRAMID_LEVEL_SIZE(level);
+    size_t   rowBytes = (size_t)size * SBX_COLOR_PYRAMID_TEXEL_SIZE;
+    if(level == 0) {
+        SBX_chunk_data_t* data = box->chunks[chunkIndex].data;
+        for(uint32_t y = 0; y < size; y++) {
+            uint8_t* row = &pixels[y * rowStride];
+            if((data == SBX_POINTER_UNSET) || !data->plockCount) {
+                memset(row, 0, rowBytes);
+                continue;
+            }
+            for(uint32_t x = 0; x < size; x++) {
+                memcpy(&row[x * SBX_COLOR_PYRAMID_TEXEL_SIZE], SBXColorPyramidPlockColor(pyramid, data, x, y), SBX_COLOR_PYRAMID_TEXEL_SIZE);
+            }
+        }
+    }
+    else {
+        const uint8_t* texels = pyramid->chunks[chunkIndex].texels;
+        for(uint32_t y = 0; y < size; y++) {
+            if(texels == SBX_POINTER_UNSET) {
+                memset(&pixels[y * rowStride], 0, rowBytes);
+            } else {
+                memcpy(&pixels[y * rowStride], &texels[(SBX_COLOR_PYRAMID_LEVEL_OFFSET(level) + y * size) * SBX_COLOR_PYRAMID_TEXEL_SIZE], rowBytes);
+            }
+        }
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COLOR_PYRAMID_WRITE_CHUNK_SUCCESSFUL
+    };
+}
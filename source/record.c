@@ -0,0 +1,1193 @@
+// Sockets, fcntl, and unlink are POSIX extensions on top of C17
+#if defined(__linux__)
+    #define _GNU_SOURCE
+#endif
+
+// Project headers
+#include <SBX/record.h>
+#include <SBX/strings.h>
+#include <SBX/chunk.h>
+#include <SBX/plock.h>
+
+// LibC headers
+#include <errno.h>
+#include <string.h>
+#include <time.h>
+
+// Platform headers
+#if defined(__unix__) || defined(__APPLE__)
+    #define SBX_RECORDING_SOCKETS
+    #include <fcntl.h>
+    #include <sys/socket.h>
+    #include <sys/un.h>
+    #include <unistd.h>
+#endif
+
+// Size of the stdio buffer frames are written through
+#define SBX_RECORDING_BUFFER_SIZE     (1 << 20)
+// Size of the recording header, the magic, version, chunk size, and keyframe interval
+#define SBX_RECORDING_HEADER_SIZE     (4 + sizeof(uint32_t) + sizeof(uint16_t) + sizeof(uint32_t))
+// Size of a frame header, the kind, tick, box size, number of chunks, and payload size
+#define SBX_RECORDING_FRAME_HEADER_SIZE (1 + sizeof(uint64_t) + 2 * sizeof(uint16_t) + 2 * sizeof(uint32_t))
+// Size of the header of every chunk of a frame, its index and encoded size
+#define SBX_RECORDING_CHUNK_HEADER_SIZE (sizeof(uint32_t) + sizeof(uint16_t))
+// Largest size an encoded plane can take, one control byte for every 128 literal types
+#define SBX_RECORDING_ENCODED_MAXIMUM (SBX_CHUNK_PLOCK_COUNT + SBX_CHUNK_PLOCK_COUNT / 128)
+// Longest literal and repeat runs of the encoding
+#define SBX_RECORDING_LITERAL_MAXIMUM 128
+#define SBX_RECORDING_REPEAT_MAXIMUM  129
+// Bytes read from a spectator socket at once
+#define SBX_RECORDING_RECEIVE_SIZE    (1 << 16)
+
+// Suppresses SIGPIPE when a spectator hangs up mid send, platforms without the flag set SO_NOSIGPIPE on the socket instead
+#if defined(MSG_NOSIGNAL)
+    #define SBX_RECORDING_SEND_FLAGS MSG_NOSIGNAL
+#else
+    #define SBX_RECORDING_SEND_FLAGS 0
+#endif
+
+// Reads the current time in nanoseconds
+static uint64_t SBXBoxRecorderNow(void) {
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+// Counts how many types from a position of a plane repeat the type there, up to limit, eight at a time while they can
+static inline uint32_t SBXRecordingRepeatLength(const SBX_plock_type_id_t* plane, uint32_t i, uint32_t limit) {
+    uint64_t pattern = (uint64_t)plane[i] * 0x0101010101010101ULL;
+    uint32_t run = 1;
+    while(run + sizeof(uint64_t) <= limit) {
+        uint64_t types;
+        memcpy(&types, &plane[i + run], sizeof(uint64_t));
+        if(types != pattern) {
+            break;
+        }
+        run += sizeof(uint64_t);
+    }
+    while((run < limit) && (plane[i + run] == plane[i])) {
+        run++;
+    }
+    return run;
+}
+
+// Run-length encodes a type plane and returns the amount of bytes written, at most SBX_RECORDING_ENCODED_MAXIMUM.
+// A control byte below 128 is followed by that many plus one literal types, one of 128 and above by a type repeated that many minus 126 times
+static size_t SBXRecordingEncode(const SBX_plock_type_id_t* plane, uint8_t* buffer) {
+    size_t size = 0;
+    uint32_t i = 0;
+
+    while(i < SBX_CHUNK_PLOCK_COUNT) {
+        uint32_t limit = SBX_CHUNK_PLOCK_COUNT - i < SBX_RECORDING_REPEAT_MAXIMUM ? SBX_CHUNK_PLOCK_COUNT - i : SBX_RECORDING_REPEAT_MAXIMUM;
+        uint32_t run = SBXRecordingRepeatLength(plane, i, limit);
+        if(run > 1) {
+            buffer[size++] = (uint8_t)(128 + run - 2);
+            buffer[size++] = plane[i];
+            i += run;
+            continue;
+        }
+
+        // Literals run until two equal types in a row, which are cheaper as a repeat
+        uint32_t start = i;
+        while((i < SBX_CHUNK_PLOCK_COUNT) && (i - start < SBX_RECORDING_LITERAL_MAXIMUM) &&
+              !((i + 1 < SBX_CHUNK_PLOCK_COUNT) && (plane[i] == plane[i + 1]))) {
+            i++;
+        }
+        buffer[size++] = (uint8_t)(i - start - 1);
+        memcpy(&buffer[size], &plane[start], i - start);
+        size += i - start;
+    }
+
+    return size;
+}
+
+// Decodes a run-length encoded type plane, returns false if the runs don't add up to exactly one plane
+static SBX_bool_t SBXRecordingDecode(const uint8_t* buffer, size_t size, SBX_plock_type_id_t* plane) {
+    size_t offset = 0;
+    uint32_t i = 0;
+
+    while(offset < size) {
+        uint8_t control = buffer[offset++];
+        if(control < 128) {
+            uint32_t run = (uint32_t)control + 1;
+            if((offset + run > size) || (i + run > SBX_CHUNK_PLOCK_COUNT)) {
+                return false;
+            }
+            memcpy(&plane[i], &buffer[offset], run);
+            offset += run;
+            i      += run;
+        } else {
+            uint32_t run = (uint32_t)control - 126;
+            if((offset >= size) || (i + run > SBX_CHUNK_PLOCK_COUNT)) {
+                return false;
+            }
+            memset(&plane[i], buffer[offset++], run);
+            i += run;
+        }
+    }
+
+    return i == SBX_CHUNK_PLOCK_COUNT;
+}
+
+// Checks whether every type of a plane is SBX_PLOCK_TYPE_ID_UNSET, eight at a time
+static SBX_bool_t SBXRecordingPlaneEmpty(const SBX_plock_type_id_t* plane) {
+    for(uint32_t i = 0; i < SBX_CHUNK_PLOCK_COUNT; i += sizeof(uint64_t)) {
+        uint64_t types;
+        memcpy(&types, &plane[i], sizeof(uint64_t));
+        if(types) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Writes the recording header into a buffer, all values are written in native byte order
+static void SBXRecordingWriteHeader(uint8_t* buffer, uint32_t keyframeInterval) {
+    uint32_t version = SBX_RECORDING_VERSION;
+    uint16_t chunkSize = SBX_CHUNK_SIZE;
+    memcpy(&buffer[0], SBX_RECORDING_MAGIC, 4);
+    memcpy(&buffer[4], &version, sizeof(version));
+    memcpy(&buffer[8], &chunkSize, sizeof(chunkSize));
+    memcpy(&buffer[10], &keyframeInterval, sizeof(keyframeInterval));
+}
+
+// Reads the type of a plock ID of a chunk
+static inline SBX_plock_type_id_t SBXBoxRecorderType(SBX_chunk_data_t* data, SBX_plock_id_t plockID) {
+    return plockID == SBX_PLOCK_ID_UNSET ? SBX_PLOCK_TYPE_ID_UNSET : data->plockArray.plocks[SBX_PLOCK_ID_TO_INDEX(plockID)].type;
+}
+
+// Reads the types of a rectangle of a chunk into its row-major type plane, and the XOR of every type with the one the plane held into a delta plane.
+// Returns whether any type changed
+static SBX_bool_t SBXBoxRecorderReadRect(SBX_chunk_data_t* data, uint32_t x, uint32_t y, uint32_t width, uint32_t height,
+                                         SBX_plock_type_id_t* plane, SBX_plock_type_id_t* delta) {
+    SBX_plock_type_id_t changed = 0;
+
+    for(uint32_t row = y; row < y + height; row++) {
+        SBX_plock_type_id_t* types  = &plane[row * SBX_CHUNK_SIZE];
+        SBX_plock_type_id_t* deltas = &delta[row * SBX_CHUNK_SIZE];
+        if(data == SBX_POINTER_UNSET) {
+            for(uint32_t column = x; column < x + width; column++) {
+                deltas[column] = types[column];
+                changed       |= types[column];
+                types[column]  = SBX_PLOCK_TYPE_ID_UNSET;
+            }
+        } else {
+            // Rows are contiguous in the plock ID matrix
+            const SBX_plock_id_t* plockIDs = SBXPlockIDMatrixAt(&data->plockIDMatrix, 0, (SBX_plock_id_matrix_dimensions_t)row);
+            for(uint32_t column = x; column < x + width; column++) {
+                SBX_plock_type_id_t type = SBXBoxRecorderType(data, plockIDs[column]);
+                deltas[column] = type ^ types[column];
+                changed       |= deltas[column];
+                types[column]  = type;
+            }
+        }
+    }
+
+    return changed != 0;
+}
+
+// Makes room for size more bytes in the frame buffer
+static SBX_bool_t SBXBoxRecorderReserve(SBX_box_recorder_t* recorder, size_t size) {
+    if(recorder->frameSize + size <= recorder->frameCapacity) {
+        return true;
+    }
+
+    size_t capacity = recorder->frameCapacity ? recorder->frameCapacity : SBX_RECORDING_BUFFER_SIZE;
+    while(capacity < recorder->frameSize + size) {
+        capacity *= 2;
+    }
+    uint8_t* frame = SBXAllocatorReallocate(recorder->allocator, SBX_MEMORY_SUBSYSTEM_SAVE, recorder->frame, recorder->frameCapacity, capacity);
+    if(frame == SBX_POINTER_UNSET) {
+        return false;
+    }
+    recorder->frame         = frame;
+    recorder->frameCapacity = capacity;
+    return true;
+}
+
+// Starts a frame in the frame buffer, its chunk count and payload size are filled in by SBXBoxRecorderFrameEnd
+static SBX_bool_t SBXBoxRecorderFrameBegin(SBX_box_recorder_t* recorder, uint8_t kind, SBX_box_tick_t tick) {
+    recorder->frameSize = 0;
+    if(!SBXBoxRecorderReserve(recorder, SBX_RECORDING_FRAME_HEADER_SIZE)) {
+        return false;
+    }
+
+    uint64_t frameTick = tick;
+    recorder->frame[0] = kind;
+    memcpy(&recorder->frame[1], &frameTick, sizeof(uint64_t));
+    memcpy(&recorder->frame[9], &recorder->width, sizeof(uint16_t));
+    memcpy(&recorder->frame[11], &recorder->height, sizeof(uint16_t));
+    recorder->frameSize = SBX_RECORDING_FRAME_HEADER_SIZE;
+    return true;
+}
+
+// Encodes a plane into the frame being built
+static SBX_bool_t SBXBoxRecorderFrameAdd(SBX_box_recorder_t* recorder, SBX_chunk_index_t chunkIndex, const SBX_plock_type_id_t* plane) {
+    if(!SBXBoxRecorderReserve(recorder, SBX_RECORDING_CHUNK_HEADER_SIZE + SBX_RECORDING_ENCODED_MAXIMUM)) {
+        return false;
+    }
+
+    uint32_t index = chunkIndex;
+    uint16_t size  = (uint16_t)SBXRecordingEncode(plane, &recorder->frame[recorder->frameSize + SBX_RECORDING_CHUNK_HEADER_SIZE]);
+    memcpy(&recorder->frame[recorder->frameSize], &index, sizeof(uint32_t));
+    memcpy(&recorder->frame[recorder->frameSize + sizeof(uint32_t)], &size, sizeof(uint16_t));
+    recorder->frameSize += SBX_RECORDING_CHUNK_HEADER_SIZE + size;
+    recorder->stats.chunkCount++;
+    return true;
+}
+
+// Fills in the chunk count and payload size of the frame being built
+static void SBXBoxRecorderFrameEnd(SBX_box_recorder_t* recorder, uint32_t chunkCount) {
+    uint32_t payloadSize = (uint32_t)(recorder->frameSize - SBX_RECORDING_FRAME_HEADER_SIZE);
+    memcpy(&recorder->frame[13], &chunkCount, sizeof(uint32_t));
+    memcpy(&recorder->frame[17], &payloadSize, sizeof(uint32_t));
+}
+
+// Builds a keyframe of every chunk with a type set from the planes
+static SBX_bool_t SBXBoxRecorderBuildKeyframe(SBX_box_recorder_t* recorder, SBX_box_tick_t tick) {
+    if(!SBXBoxRecorderFrameBegin(recorder, SBX_RECORDING_FRAME_KEYFRAME, tick)) {
+        return false;
+    }
+
+    uint32_t chunkCount = 0;
+    SBX_chunk_index_t planeCount = (SBX_chunk_index_t)((recorder->width + SBX_CHUNK_MASK) >> SBX_CHUNK_SHIFT) * ((recorder->height + SBX_CHUNK_MASK) >> SBX_CHUNK_SHIFT);
+    for(SBX_chunk_index_t i = 0; i < planeCount; i++) {
+        const SBX_plock_type_id_t* plane = &recorder->planes[(size_t)i * SBX_CHUNK_PLOCK_COUNT];
+        if(SBXRecordingPlaneEmpty(plane)) {
+            continue;
+        }
+        if(!SBXBoxRecorderFrameAdd(recorder, i, plane)) {
+            return false;
+        }
+        chunkCount++;
+    }
+
+    SBXBoxRecorderFrameEnd(recorder, chunkCount);
+    return true;
+}
+
+// Reads every chunk of the box into the planes, growing them to the size of the box
+static SBX_bool_t SBXBoxRecorderReadPlanes(SBX_box_recorder_t* recorder) {
+    SBX_box_t* box = recorder->box;
+    SBX_chunk_index_t chunkCount = (SBX_chunk_index_t)box->chunkColumns * box->chunkRows;
+    if(chunkCount > recorder->planeCapacity) {
+        SBX_plock_type_id_t* planes = SBXAllocatorReallocate(recorder->allocator, SBX_MEMORY_SUBSYSTEM_SAVE, recorder->planes,
+                                                             (size_t)recorder->planeCapacity * SBX_CHUNK_PLOCK_COUNT, (size_t)chunkCount * SBX_CHUNK_PLOCK_COUNT);
+        if(planes == SBX_POINTER_UNSET) {
+            return false;
+        }
+        recorder->planes        = planes;
+        recorder->planeCapacity = chunkCount;
+    }
+
+    // Positions of edge chunks past the box stay unset
+    memset(recorder->planes, SBX_PLOCK_TYPE_ID_UNSET, (size_t)chunkCount * SBX_CHUNK_PLOCK_COUNT);
+    SBX_plock_type_id_t delta[SBX_CHUNK_PLOCK_COUNT];
+    for(SBX_chunk_index_t i = 0; i < chunkCount; i++) {
+        uint32_t originX = (uint32_t)(i % box->chunkColumns) << SBX_CHUNK_SHIFT, originY = (uint32_t)(i / box->chunkColumns) << SBX_CHUNK_SHIFT;
+        uint32_t width   = box->width - originX < SBX_CHUNK_SIZE ? box->width - originX : SBX_CHUNK_SIZE;
+        uint32_t height  = box->height - originY < SBX_CHUNK_SIZE ? box->height - originY : SBX_CHUNK_SIZE;
+        if(box->chunks[i].data != SBX_POINTER_UNSET) {
+            SBXBoxRecorderReadRect(box->chunks[i].data, 0, 0, width, height, &recorder->planes[(size_t)i * SBX_CHUNK_PLOCK_COUNT], delta);
+        }
+    }
+
+    recorder->width  = box->width;
+    recorder->height = box->height;
+    return true;
+}
+
+// Closes a spectator and frees its backlog
+static void SBXBoxRecorderDrop(SBX_box_recorder_t* recorder, SBX_recording_spectator_t* spectator) {
+#if defined(SBX_RECORDING_SOCKETS)
+    close(spectator->socket);
+#endif
+    SBXAllocatorFree(recorder->allocator, SBX_MEMORY_SUBSYSTEM_SAVE, spectator->backlog, spectator->backlogCapacity);
+    *spectator = (SBX_recording_spectator_t){.socket = -1};
+    recorder->stats.spectatorCount--;
+}
+
+// Sends as much of the backlog of a spectator as its socket takes, returns false if the spectator was dropped
+static SBX_bool_t SBXBoxRecorderFlush(SBX_box_recorder_t* recorder, SBX_recording_spectator_t* spectator) {
+#if defined(SBX_RECORDING_SOCKETS)
+    size_t sent = 0;
+    while(sent < spectator->backlogSize) {
+        ssize_t result = send(spectator->socket, &spectator->backlog[sent], spectator->backlogSize - sent, SBX_RECORDING_SEND_FLAGS);
+        if(result < 0) {
+            if(errno == EINTR) {
+                continue;
+            }
+            if((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+                break;
+            }
+            SBXBoxRecorderDrop(recorder, spectator);
+            return false;
+        }
+        sent += (size_t)result;
+    }
+    memmove(spectator->backlog, &spectator->backlog[sent], spectator->backlogSize - sent);
+    spectator->backlogSize -= sent;
+#else
+    (void)recorder;
+    (void)spectator;
+#endif
+    return true;
+}
+
+// Sends bytes to a spectator without blocking, what its socket doesn't take waits in its backlog.
+// Spectators that hang up or fall more than SBX_RECORDING_SPECTATOR_BACKLOG bytes behind are dropped
+static void SBXBoxRecorderSend(SBX_box_recorder_t* recorder, SBX_recording_spectator_t* spectator, const uint8_t* bytes, size_t size) {
+#if defined(SBX_RECORDING_SOCKETS)
+    // Bytes already waiting go first
+    if((spectator->backlogSize > 0) && !SBXBoxRecorderFlush(recorder, spectator)) {
+        return;
+    }
+
+    size_t sent = 0;
+    while((spectator->backlogSize == 0) && (sent < size)) {
+        ssize_t result = send(spectator->socket, &bytes[sent], size - sent, SBX_RECORDING_SEND_FLAGS);
+        if(result < 0) {
+            if(errno == EINTR) {
+                continue;
+            }
+            if((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+                break;
+            }
+            SBXBoxRecorderDrop(recorder, spectator);
+            return;
+        }
+        sent += (size_t)result;
+    }
+    if(sent == size) {
+        return;
+    }
+
+    // Keep the rest, a spectator that can't keep up is dropped rather than slowing the box down
+    size_t backlogSize = spectator->backlogSize + size - sent;
+    if(backlogSize > SBX_RECORDING_SPECTATOR_BACKLOG) {
+        SBXBoxRecorderDrop(recorder, spectator);
+        return;
+    }
+    if(backlogSize > spectator->backlogCapacity) {
+        size_t capacity = spectator->backlogCapacity ? spectator->backlogCapacity : SBX_RECORDING_RECEIVE_SIZE;
+        while(capacity < backlogSize) {
+            capacity *= 2;
+        }
+        uint8_t* backlog = SBXAllocatorReallocate(recorder->allocator, SBX_MEMORY_SUBSYSTEM_SAVE, spectator->backlog, spectator->backlogCapacity, capacity);
+        if(backlog == SBX_POINTER_UNSET) {
+            SBXBoxRecorderDrop(recorder, spectator);
+            return;
+        }
+        spectator->backlog         = backlog;
+        spectator->backlogCapacity = capacity;
+    }
+    memcpy(&spectator->backlog[spectator->backlogSize], &bytes[sent], size - sent);
+    spectator->backlogSize = backlogSize;
+#else
+    (void)recorder;
+    (void)spectator;
+    (void)bytes;
+    (void)size;
+#endif
+}
+
+// Writes the frame buffer to the file and every spectator
+static void SBXBoxRecorderWrite(SBX_box_recorder_t* recorder, const uint8_t* bytes, size_t size) {
+    if((recorder->file != SBX_POINTER_UNSET) && (fwrite(bytes, 1, size, recorder->file) != size) && !recorder->report.errorFlags) {
+        recorder->report = (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_IO_FAILURE
+        };
+    }
+    for(uint32_t i = 0; i < SBX_RECORDING_SPECTATOR_COUNT; i++) {
+        if(recorder->spectators[i].socket >= 0) {
+            SBXBoxRecorderSend(recorder, &recorder->spectators[i], bytes, size);
+        }
+    }
+    recorder->stats.byteCount += size;
+}
+
+// Accepts every waiting spectator, and starts it off with the header and a keyframe of the planes
+static SBX_bool_t SBXBoxRecorderAccept(SBX_box_recorder_t* recorder, SBX_box_tick_t tick) {
+#if defined(SBX_RECORDING_SOCKETS)
+    if(recorder->listener < 0) {
+        return true;
+    }
+
+    SBX_bool_t keyframeBuilt = false;
+    for(;;) {
+        int socket = accept(recorder->listener, NULL, NULL);
+        if(socket < 0) {
+            // Nothing left waiting, or a connection that went away before it was accepted
+            if(errno == EINTR) {
+                continue;
+            }
+            return true;
+        }
+
+        SBX_recording_spectator_t* spectator = SBX_POINTER_UNSET;
+        for(uint32_t i = 0; (spectator == SBX_POINTER_UNSET) && (i < SBX_RECORDING_SPECTATOR_COUNT); i++) {
+            spectator = recorder->spectators[i].socket < 0 ? &recorder->spectators[i] : SBX_POINTER_UNSET;
+        }
+        if(spectator == SBX_POINTER_UNSET) {
+            close(socket);
+            continue;
+        }
+        fcntl(socket, F_SETFL, fcntl(socket, F_GETFL) | O_NONBLOCK);
+#if defined(SO_NOSIGPIPE)
+        int noSignal = 1;
+        setsockopt(socket, SOL_SOCKET, SO_NOSIGPIPE, &noSignal, sizeof(noSignal));
+#endif
+        spectator->socket = socket;
+        recorder->stats.spectatorCount++;
+
+        // Every spectator joining on this tick gets the same keyframe, which isn't part of the recording
+        if(!keyframeBuilt) {
+            uint64_t chunkCount = recorder->stats.chunkCount;
+            if(!SBXBoxRecorderBuildKeyframe(recorder, tick)) {
+                return false;
+            }
+            recorder->stats.chunkCount = chunkCount;
+            keyframeBuilt = true;
+        }
+
+        uint8_t header[SBX_RECORDING_HEADER_SIZE];
+        SBXRecordingWriteHeader(header, recorder->keyframeInterval);
+        SBXBoxRecorderSend(recorder, spectator, header, SBX_RECORDING_HEADER_SIZE);
+        if(spectator->socket >= 0) {
+            SBXBoxRecorderSend(recorder, spectator, recorder->frame, recorder->frameSize);
+        }
+    }
+#else
+    (void)recorder;
+    (void)tick;
+    return true;
+#endif
+}
+
+// Change callback, records the changes of a tick as a frame
+static void SBXBoxRecorderChanges(SBX_box_t* box, const SBX_box_changes_t* changes, void* userData) {
+    SBX_box_recorder_t* recorder = userData;
+    if(recorder->report.errorFlags) {
+        return;
+    }
+    uint64_t start = SBXBoxRecorderNow();
+
+    SBX_bool_t keyframe = changes->resized || (box->width != recorder->width) || (box->height != recorder->height) ||
+                          (changes->tick - recorder->keyframeTick >= recorder->keyframeInterval);
+    SBX_bool_t failed = false;
+    uint32_t chunkCount = 0;
+    if(keyframe) {
+        // A full read keeps the planes right whatever happened to the box
+        failed = !SBXBoxRecorderReadPlanes(recorder) || !SBXBoxRecorderBuildKeyframe(recorder, changes->tick);
+        recorder->keyframeTick = changes->tick;
+        recorder->stats.keyframeCount += !failed;
+    } else {
+        // Only the dirty rectangle of every changed chunk is read, the rest of its delta plane is zero
+        failed = !SBXBoxRecorderFrameBegin(recorder, SBX_RECORDING_FRAME_DELTA, changes->tick);
+        SBX_plock_type_id_t delta[SBX_CHUNK_PLOCK_COUNT];
+        for(SBX_chunk_index_t i = 0; !failed && (i < changes->rectCount); i++) {
+            const SBX_box_dirty_rect_t* rect = &changes->rects[i];
+            SBX_chunk_index_t chunkIndex = (SBX_chunk_index_t)(rect->y >> SBX_CHUNK_SHIFT) * box->chunkColumns + (rect->x >> SBX_CHUNK_SHIFT);
+
+            // Chunks where only temperatures were written, most of the chunks the thermal pass touches, keep their planes
+            if(!rect->typesChanged) {
+                continue;
+            }
+            memset(delta, 0, SBX_CHUNK_PLOCK_COUNT);
+            if(!SBXBoxRecorderReadRect(box->chunks[chunkIndex].data, rect->x & SBX_CHUNK_MASK, rect->y & SBX_CHUNK_MASK, rect->width, rect->height,
+                                       &recorder->planes[(size_t)chunkIndex * SBX_CHUNK_PLOCK_COUNT], delta)) {
+                continue;
+            }
+            failed = !SBXBoxRecorderFrameAdd(recorder, chunkIndex, delta);
+            chunkCount++;
+        }
+        if(!failed) {
+            SBXBoxRecorderFrameEnd(recorder, chunkCount);
+        }
+    }
+
+    if(failed) {
+        recorder->report = (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    } else if(keyframe || (chunkCount > 0)) {
+        SBXBoxRecorderWrite(recorder, recorder->frame, recorder->frameSize);
+        recorder->stats.frameCount++;
+    }
+
+    // Spectators joining now start from the planes as of this tick
+    if(!recorder->report.errorFlags && !SBXBoxRecorderAccept(recorder, changes->tick)) {
+        recorder->report = (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    recorder->stats.nanoseconds += SBXBoxRecorderNow() - start;
+}
+
+// Closes everything a recorder opened and deallocates it
+static SBX_bool_t SBXBoxRecorderFree(SBX_box_recorder_t* recorder) {
+    SBX_bool_t failed = false;
+    if(recorder->file != SBX_POINTER_UNSET) {
+        failed |= fclose(recorder->file) != 0;
+    }
+    for(uint32_t i = 0; i < SBX_RECORDING_SPECTATOR_COUNT; i++) {
+        if(recorder->spectators[i].socket >= 0) {
+            SBXBoxRecorderDrop(recorder, &recorder->spectators[i]);
+        }
+    }
+#if defined(SBX_RECORDING_SOCKETS)
+    if(recorder->listener >= 0) {
+        close(recorder->listener);
+        unlink(recorder->socketPath);
+    }
+#endif
+    if(recorder->socketPath != SBX_POINTER_UNSET) {
+        SBXAllocatorFree(recorder->allocator, SBX_MEMORY_SUBSYSTEM_SAVE, recorder->socketPath, strlen(recorder->socketPath) + 1);
+    }
+
+    SBXAllocatorFree(recorder->allocator, SBX_MEMORY_SUBSYSTEM_SAVE, recorder->frame, recorder->frameCapacity);
+    SBXAllocatorFree(recorder->allocator, SBX_MEMORY_SUBSYSTEM_SAVE, recorder->planes, (size_t)recorder->planeCapacity * SBX_CHUNK_PLOCK_COUNT);
+    SBXAllocatorFree(recorder->allocator, SBX_MEMORY_SUBSYSTEM_SAVE, recorder, sizeof(SBX_box_recorder_t));
+    return !failed;
+}
+
+// Opens the listening socket spectators connect to, nonblocking so accepting never waits
+static SBX_report_t SBXBoxRecorderListen(SBX_box_recorder_t* recorder, SBX_string_t socketPath) {
+#if defined(SBX_RECORDING_SOCKETS)
+    struct sockaddr_un address = {.sun_family = AF_UNIX};
+    size_t length = strlen(socketPath);
+    if(length >= sizeof(address.sun_path)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_IO_FAILURE
+        };
+    }
+    recorder->socketPath = SBXAllocatorAllocate(recorder->allocator, SBX_MEMORY_SUBSYSTEM_SAVE, length + 1);
+    if(recorder->socketPath == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+    memcpy(recorder->socketPath, socketPath, length + 1);
+    memcpy(address.sun_path, socketPath, length + 1);
+
+    // A socket file left by a recorder that didn't end would make bind fail
+    unlink(socketPath);
+    recorder->listener = socket(AF_UNIX, SOCK_STREAM, 0);
+    if((recorder->listener < 0) || (bind(recorder->listener, (struct sockaddr*)&address, sizeof(address)) != 0) ||
+       (listen(recorder->listener, SBX_RECORDING_SPECTATOR_COUNT) != 0) ||
+       (fcntl(recorder->listener, F_SETFL, fcntl(recorder->listener, F_GETFL) | O_NONBLOCK) != 0)) {
+        if(recorder->listener >= 0) {
+            close(recorder->listener);
+            recorder->listener = -1;
+        }
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_IO_FAILURE
+        };
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_RECORD_BEGIN_SUCCESSFUL
+    };
+#else
+    (void)recorder;
+    (void)socketPath;
+
+    // Return error
+    return (SBX_report_t){
+        .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+        .reportMessage = SBX_REPORT_STRING_RECORDING_UNSUPPORTED
+    };
+#endif
+}
+
+SBX_report_t SBXBoxRecordBegin(SBX_box_t* box, SBX_string_t path, SBX_string_t socketPath, uint32_t keyframeInterval, SBX_box_recorder_t** recorder) {
+    // Check if required arguments are provided
+    if((box == SBX_POINTER_UNSET) || (recorder == SBX_POINTER_UNSET) || ((path == SBX_POINTER_UNSET) && (socketPath == SBX_POINTER_UNSET))) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for box initialized
+    if(!box->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_NOT_INIT,
+            .reportMessage = SBX_REPORT_STRING_BOX_NOT_INIT
+        };
+    }
+
+    // Allocate memory for the SBXBoxRecorder structure
+    *recorder = SBXAllocatorAllocate(box->allocator, SBX_MEMORY_SUBSYSTEM_SAVE, sizeof(SBX_box_recorder_t));
+    if(*recorder == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+    **recorder = (SBX_box_recorder_t){
+        .allocator        = box->allocator,
+        .box              = box,
+        .keyframeInterval = keyframeInterval ? keyframeInterval : SBX_RECORDING_DEFAULT_KEYFRAME_INTERVAL,
+        .keyframeTick     = box->tick,
+        .listener         = -1,
+        .report           = {.errorFlags = 0, .reportMessage = NULL}
+    };
+    for(uint32_t i = 0; i < SBX_RECORDING_SPECTATOR_COUNT; i++) {
+        (*recorder)->spectators[i].socket = -1;
+    }
+
+    // The current state of the box is the first keyframe
+    SBX_report_t report = {.errorFlags = 0, .reportMessage = SBX_REPORT_STRING_BOX_RECORD_BEGIN_SUCCESSFUL};
+    if(!SBXBoxRecorderReadPlanes(*recorder) || !SBXBoxRecorderBuildKeyframe(*recorder, box->tick)) {
+        report = (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    // Open the file with a large stdio buffer so frames go out in few big writes
+    if(!report.errorFlags && (path != SBX_POINTER_UNSET)) {
+        (*recorder)->file = fopen(path, "wb");
+        if((*recorder)->file == SBX_POINTER_UNSET) {
+            report = (SBX_report_t){
+                .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+                .reportMessage = SBX_REPORT_STRING_COMMON_IO_FAILURE
+            };
+        } else {
+            setvbuf((*recorder)->file, NULL, _IOFBF, SBX_RECORDING_BUFFER_SIZE);
+        }
+    }
+    if(!report.errorFlags && (socketPath != SBX_POINTER_UNSET)) {
+        report = SBXBoxRecorderListen(*recorder, socketPath);
+    }
+    if(!report.errorFlags) {
+        // The first subscriber of a box is handed a full refresh with its first changes, the keyframe of the current state already is one,
+        // so only the changes made from now on are left to deliver
+        SBX_bool_t first = !box->changes.subscriptionCount;
+        report = SBXBoxSubscribe(box, SBXBoxRecorderChanges, *recorder, &(*recorder)->subscription);
+        if(!report.errorFlags && first) {
+            box->changes.resized = false;
+        }
+    }
+
+    // Check for an error starting the recording
+    if(report.errorFlags) {
+        SBXBoxRecorderFree(*recorder);
+        *recorder = SBX_POINTER_UNSET;
+
+        // Return error
+        return report;
+    }
+
+    // Write the header and the first keyframe
+    uint8_t header[SBX_RECORDING_HEADER_SIZE];
+    SBXRecordingWriteHeader(header, (*recorder)->keyframeInterval);
+    SBXBoxRecorderWrite(*recorder, header, SBX_RECORDING_HEADER_SIZE);
+    SBXBoxRecorderWrite(*recorder, (*recorder)->frame, (*recorder)->frameSize);
+    (*recorder)->stats.frameCount    = 1;
+    (*recorder)->stats.keyframeCount = 1;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_RECORD_BEGIN_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxRecordEnd(SBX_box_recorder_t* recorder) {
+    // Check if required arguments are provided
+    if(recorder == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    SBXBoxUnsubscribe(recorder->box, recorder->subscription);
+    SBX_report_t report = recorder->report;
+    if(!SBXBoxRecorderFree(recorder) && !report.errorFlags) {
+        // Return error, the last frames may not have made it out of the stdio buffer
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_IO_FAILURE
+        };
+    }
+    if(report.errorFlags) {
+        // Return error
+        return report;
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_RECORD_END_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxRecorderGetStats(SBX_box_recorder_t* recorder, SBX_box_recorder_stats_t* stats) {
+    // Check if required arguments are provided
+    if((recorder == SBX_POINTER_UNSET) || (stats == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    *stats = recorder->stats;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_RECORDER_GET_STATS_SUCCESSFUL
+    };
+}
+
+// Allocates a player reading from nothing yet
+static SBX_recording_player_t* SBXRecordingPlayerAllocate(void) {
+    SBX_recording_player_t* player = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_SAVE, sizeof(SBX_recording_player_t));
+    if(player != SBX_POINTER_UNSET) {
+        *player = (SBX_recording_player_t){.socket = -1};
+    }
+    return player;
+}
+
+// Makes room for size bytes in the read buffer
+static SBX_bool_t SBXRecordingPlayerReserve(SBX_recording_player_t* player, size_t size) {
+    if(size <= player->bufferCapacity) {
+        return true;
+    }
+
+    size_t capacity = player->bufferCapacity ? player->bufferCapacity : SBX_RECORDING_RECEIVE_SIZE;
+    while(capacity < size) {
+        capacity *= 2;
+    }
+    uint8_t* buffer = SBXAllocatorReallocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_SAVE, player->buffer, player->bufferCapacity, capacity);
+    if(buffer == SBX_POINTER_UNSET) {
+        return false;
+    }
+    player->buffer         = buffer;
+    player->bufferCapacity = capacity;
+    return true;
+}
+
+// Reads until the buffer holds size bytes, returns false if they aren't there yet or the recording ended, setting failed on read errors.
+// The buffer must have room for size bytes
+static SBX_bool_t SBXRecordingPlayerFill(SBX_recording_player_t* player, size_t size, SBX_bool_t* failed) {
+    if(player->file != SBX_POINTER_UNSET) {
+        // Files are read exactly as far as needed, so the buffer never holds part of the next frame
+        if(player->bufferSize < size) {
+            player->bufferSize += fread(&player->buffer[player->bufferSize], 1, size - player->bufferSize, player->file);
+        }
+        if(player->bufferSize < size) {
+            player->ended = true;
+            *failed       = ferror(player->file) != 0;
+        }
+        return player->bufferSize >= size;
+    }
+
+#if defined(SBX_RECORDING_SOCKETS)
+    // Sockets are read as far as the recorder has sent, and never waited on
+    while(player->bufferSize < size) {
+        ssize_t result = recv(player->socket, &player->buffer[player->bufferSize], player->bufferCapacity - player->bufferSize, 0);
+        if(result > 0) {
+            player->bufferSize += (size_t)result;
+            continue;
+        }
+        if((result < 0) && (errno == EINTR)) {
+            continue;
+        }
+        if((result < 0) && ((errno == EAGAIN) || (errno == EWOULDBLOCK))) {
+            return false;
+        }
+        player->ended = true;
+        *failed       = result < 0;
+        return false;
+    }
+#endif
+    return player->bufferSize >= size;
+}
+
+// Decodes a whole frame from the start of the read buffer into the planes
+static SBX_report_t SBXRecordingPlayerDecode(SBX_recording_player_t* player, uint8_t kind, uint16_t width, uint16_t height, uint32_t chunkCount, uint32_t payloadSize) {
+    const uint8_t* payload = &player->buffer[SBX_RECORDING_FRAME_HEADER_SIZE];
+    SBX_chunk_dimensions_t chunkColumns = (SBX_chunk_dimensions_t)((width + SBX_CHUNK_MASK) >> SBX_CHUNK_SHIFT);
+    SBX_chunk_dimensions_t chunkRows    = (SBX_chunk_dimensions_t)((height + SBX_CHUNK_MASK) >> SBX_CHUNK_SHIFT);
+    SBX_chunk_index_t      planeCount   = (SBX_chunk_index_t)chunkColumns * chunkRows;
+
+    // Deltas only make sense on top of a keyframe of the same size
+    if(((kind != SBX_RECORDING_FRAME_KEYFRAME) && (kind != SBX_RECORDING_FRAME_DELTA)) || (width == 0) || (height == 0) ||
+       ((kind == SBX_RECORDING_FRAME_DELTA) && ((player->planes == SBX_POINTER_UNSET) || (width != player->width) || (height != player->height)))) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_RECORDING_INVALID
+        };
+    }
+
+    // Keyframes replace everything
+    if(kind == SBX_RECORDING_FRAME_KEYFRAME) {
+        if(planeCount > player->chunkCapacity) {
+            // The old planes are dropped anyway, so new arrays are allocated instead of copying them over
+            SBX_plock_type_id_t* planes  = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_SAVE, (size_t)planeCount * SBX_CHUNK_PLOCK_COUNT);
+            uint8_t*             changed = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_SAVE, planeCount);
+            if((planes == SBX_POINTER_UNSET) || (changed == SBX_POINTER_UNSET)) {
+                SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_SAVE, planes, (size_t)planeCount * SBX_CHUNK_PLOCK_COUNT);
+                SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_SAVE, changed, planeCount);
+
+                // Return error
+                return (SBX_report_t){
+                    .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+                    .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+                };
+            }
+            SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_SAVE, player->planes, (size_t)player->chunkCapacity * SBX_CHUNK_PLOCK_COUNT);
+            SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_SAVE, player->changed, player->chunkCapacity);
+            player->planes        = planes;
+            player->changed       = changed;
+            player->chunkCapacity = planeCount;
+        }
+        memset(player->planes, SBX_PLOCK_TYPE_ID_UNSET, (size_t)planeCount * SBX_CHUNK_PLOCK_COUNT);
+        memset(player->changed, true, planeCount);
+        player->resized     |= (width != player->width) || (height != player->height);
+        player->width        = width;
+        player->height       = height;
+        player->chunkColumns = chunkColumns;
+        player->chunkRows    = chunkRows;
+    }
+
+    size_t offset = 0;
+    SBX_plock_type_id_t delta[SBX_CHUNK_PLOCK_COUNT];
+    for(uint32_t c = 0; c < chunkCount; c++) {
+        uint32_t index = 0;
+        uint16_t size  = 0;
+        if(offset + SBX_RECORDING_CHUNK_HEADER_SIZE <= payloadSize) {
+            memcpy(&index, &payload[offset], sizeof(uint32_t));
+            memcpy(&size, &payload[offset + sizeof(uint32_t)], sizeof(uint16_t));
+            offset += SBX_RECORDING_CHUNK_HEADER_SIZE;
+        }
+
+        SBX_plock_type_id_t* plane = &player->planes[(size_t)(index < planeCount ? index : 0) * SBX_CHUNK_PLOCK_COUNT];
+        if((size == 0) || (index >= planeCount) || (offset + size > payloadSize) ||
+           !SBXRecordingDecode(&payload[offset], size, kind == SBX_RECORDING_FRAME_KEYFRAME ? plane : delta)) {
+            // Return error
+            return (SBX_report_t){
+                .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+                .reportMessage = SBX_REPORT_STRING_RECORDING_INVALID
+            };
+        }
+        offset += size;
+
+        // Deltas are XORed in eight types at a time
+        if(kind == SBX_RECORDING_FRAME_DELTA) {
+            for(uint32_t i = 0; i < SBX_CHUNK_PLOCK_COUNT; i += sizeof(uint64_t)) {
+                uint64_t types, changes;
+                memcpy(&types, &plane[i], sizeof(uint64_t));
+                memcpy(&changes, &delta[i], sizeof(uint64_t));
+                types ^= changes;
+                memcpy(&plane[i], &types, sizeof(uint64_t));
+            }
+        }
+        player->changed[index] = true;
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_RECORDING_PLAYER_NEXT_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXRecordingPlayerOpen(SBX_recording_player_t** player, SBX_string_t path) {
+    // Check if required arguments are provided
+    if((player == SBX_POINTER_UNSET) || (path == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Allocate memory for the SBXRecordingPlayer structure
+    *player = SBXRecordingPlayerAllocate();
+    if(*player == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    (*player)->file = fopen(path, "rb");
+    if((*player)->file == SBX_POINTER_UNSET) {
+        SBXRecordingPlayerClose(*player);
+        *player = SBX_POINTER_UNSET;
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_IO_FAILURE
+        };
+    }
+    setvbuf((*player)->file, NULL, _IOFBF, SBX_RECORDING_BUFFER_SIZE);
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_RECORDING_PLAYER_OPEN_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXRecordingPlayerConnect(SBX_recording_player_t** player, SBX_string_t socketPath) {
+    // Check if required arguments are provided
+    if((player == SBX_POINTER_UNSET) || (socketPath == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+#if defined(SBX_RECORDING_SOCKETS)
+    // Allocate memory for the SBXRecordingPlayer structure
+    *player = SBXRecordingPlayerAllocate();
+    if(*player == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    // Connect blocking, then read without ever waiting on the recorder
+    struct sockaddr_un address = {.sun_family = AF_UNIX};
+    size_t length = strlen(socketPath);
+    (*player)->socket = length < sizeof(address.sun_path) ? socket(AF_UNIX, SOCK_STREAM, 0) : -1;
+    if((*player)->socket >= 0) {
+        memcpy(address.sun_path, socketPath, length + 1);
+    }
+    if(((*player)->socket < 0) || (connect((*player)->socket, (struct sockaddr*)&address, sizeof(address)) != 0) ||
+       (fcntl((*player)->socket, F_SETFL, fcntl((*player)->socket, F_GETFL) | O_NONBLOCK) != 0)) {
+        SBXRecordingPlayerClose(*player);
+        *player = SBX_POINTER_UNSET;
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_IO_FAILURE
+        };
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_RECORDING_PLAYER_CONNECT_SUCCESSFUL
+    };
+#else
+    // Return error
+    return (SBX_report_t){
+        .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+        .reportMessage = SBX_REPORT_STRING_RECORDING_UNSUPPORTED
+    };
+#endif
+}
+
+SBX_report_t SBXRecordingPlayerClose(SBX_recording_player_t* player) {
+    // Check if required arguments are provided
+    if(player == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    if(player->file != SBX_POINTER_UNSET) {
+        fclose(player->file);
+    }
+#if defined(SBX_RECORDING_SOCKETS)
+    if(player->socket >= 0) {
+        close(player->socket);
+    }
+#endif
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_SAVE, player->buffer, player->bufferCapacity);
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_SAVE, player->planes, (size_t)player->chunkCapacity * SBX_CHUNK_PLOCK_COUNT);
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_SAVE, player->changed, player->chunkCapacity);
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_SAVE, player, sizeof(SBX_recording_player_t));
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_RECORDING_PLAYER_CLOSE_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXRecordingPlayerNext(SBX_recording_player_t* player, SBX_bool_t* decoded) {
+    // Check if required arguments are provided
+    if((player == SBX_POINTER_UNSET) || (decoded == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    *decoded = false;
+    SBX_bool_t failed = false;
+    if(!SBXRecordingPlayerReserve(player, SBX_RECORDING_RECEIVE_SIZE)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    // Check the header before the first frame
+    if(!player->started) {
+        if(!SBXRecordingPlayerFill(player, SBX_RECORDING_HEADER_SIZE, &failed)) {
+            // Return error, or wait for the recorder
+            return (SBX_report_t){
+                .errorFlags    = failed ? SBX_COMMON_ERROR_IO_FAILURE : 0,
+                .reportMessage = failed ? SBX_REPORT_STRING_COMMON_IO_FAILURE : SBX_REPORT_STRING_RECORDING_PLAYER_NEXT_SUCCESSFUL
+            };
+        }
+
+        uint32_t version = 0;
+        uint16_t chunkSize = 0;
+        memcpy(&version, &player->buffer[4], sizeof(version));
+        memcpy(&chunkSize, &player->buffer[8], sizeof(chunkSize));
+        if(memcmp(player->buffer, SBX_RECORDING_MAGIC, 4) || (version != SBX_RECORDING_VERSION) || (chunkSize != SBX_CHUNK_SIZE)) {
+            // Return error
+            return (SBX_report_t){
+                .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+                .reportMessage = SBX_REPORT_STRING_RECORDING_INVALID
+            };
+        }
+        player->bufferSize -= SBX_RECORDING_HEADER_SIZE;
+        memmove(player->buffer, &player->buffer[SBX_RECORDING_HEADER_SIZE], player->bufferSize);
+        player->started = true;
+    }
+
+    // Read the frame header, then the rest of the frame
+    if(!SBXRecordingPlayerFill(player, SBX_RECORDING_FRAME_HEADER_SIZE, &failed)) {
+        // Return error, or wait for the recorder
+        return (SBX_report_t){
+            .errorFlags    = failed ? SBX_COMMON_ERROR_IO_FAILURE : 0,
+            .reportMessage = failed ? SBX_REPORT_STRING_COMMON_IO_FAILURE : SBX_REPORT_STRING_RECORDING_PLAYER_NEXT_SUCCESSFUL
+        };
+    }
+    uint8_t  kind = player->buffer[0];
+    uint64_t tick = 0;
+    uint16_t width = 0, height = 0;
+    uint32_t chunkCount = 0, payloadSize = 0;
+    memcpy(&tick, &player->buffer[1], sizeof(uint64_t));
+    memcpy(&width, &player->buffer[9], sizeof(uint16_t));
+    memcpy(&height, &player->buffer[11], sizeof(uint16_t));
+    memcpy(&chunkCount, &player->buffer[13], sizeof(uint32_t));
+    memcpy(&payloadSize, &player->buffer[17], sizeof(uint32_t));
+    if((uint64_t)payloadSize > (uint64_t)chunkCount * (SBX_RECORDING_CHUNK_HEADER_SIZE + SBX_RECORDING_ENCODED_MAXIMUM)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_RECORDING_INVALID
+        };
+    }
+    if(!SBXRecordingPlayerReserve(player, SBX_RECORDING_FRAME_HEADER_SIZE + (size_t)payloadSize)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+    if(!SBXRecordingPlayerFill(player, SBX_RECORDING_FRAME_HEADER_SIZE + (size_t)payloadSize, &failed)) {
+        // Return error, or wait for the recorder
+        return (SBX_report_t){
+            .errorFlags    = failed ? SBX_COMMON_ERROR_IO_FAILURE : 0,
+            .reportMessage = failed ? SBX_REPORT_STRING_COMMON_IO_FAILURE : SBX_REPORT_STRING_RECORDING_PLAYER_NEXT_SUCCESSFUL
+        };
+    }
+
+    SBX_report_t report = SBXRecordingPlayerDecode(player, kind, width, height, chunkCount, payloadSize);
+    if(report.errorFlags) {
+        // Return error
+        return report;
+    }
+    player->tick        = tick;
+    player->bufferSize -= SBX_RECORDING_FRAME_HEADER_SIZE + (size_t)payloadSize;
+    memmove(player->buffer, &player->buffer[SBX_RECORDING_FRAME_HEADER_SIZE + (size_t)payloadSize], player->bufferSize);
+    *decoded = true;
+
+    return report;
+}
+
+SBX_report_t SBXRecordingPlayerApply(SBX_recording_player_t* player, SBX_box_t* box, SBX_plock_temperature_t temperature) {
+    // Check if required arguments are provided
+    if((player == SBX_POINTER_UNSET) || (box == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Nothing to apply before the first keyframe
+    SBX_report_t report = {.errorFlags = 0, .reportMessage = SBX_REPORT_STRING_RECORDING_PLAYER_APPLY_SUCCESSFUL};
+    if(player->planes == SBX_POINTER_UNSET) {
+        return report;
+    }
+
+    // Match the recorded size
+    if(!box->initialized) {
+        report = SBXBoxInit(box, player->width, player->height);
+    } else if((box->width != player->width) || (box->height != player->height)) {
+        report = SBXBoxSetSize(box, player->width, player->height);
+    }
+    if(report.errorFlags) {
+        // Return error
+        return report;
+    }
+    player->resized = false;
+
+    // Only positions whose type differs are written, so unchanged plocks keep their temperature
+    SBX_chunk_index_t planeCount = (SBX_chunk_index_t)player->chunkColumns * player->chunkRows;
+    for(SBX_chunk_index_t i = 0; i < planeCount; i++) {
+        if(!player->changed[i]) {
+            continue;
+        }
+
+        const SBX_plock_type_id_t* plane = &player->planes[(size_t)i * SBX_CHUNK_PLOCK_COUNT];
+        uint32_t originX = (uint32_t)(i % player->chunkColumns) << SBX_CHUNK_SHIFT, originY = (uint32_t)(i / player->chunkColumns) << SBX_CHUNK_SHIFT;
+        uint32_t width   = player->width - originX < SBX_CHUNK_SIZE ? player->width - originX : SBX_CHUNK_SIZE;
+        uint32_t height  = player->height - originY < SBX_CHUNK_SIZE ? player->height - originY : SBX_CHUNK_SIZE;
+        for(uint32_t y = 0; y < height; y++) {
+            for(uint32_t x = 0; x < width; x++) {
+                SBX_plock_type_id_t type = plane[y * SBX_CHUNK_SIZE + x];
+                if(type == SBXChunkGetTypeUnchecked(box->chunks[i].data, (SBX_box_position_t)x, (SBX_box_position_t)y)) {
+                    continue;
+                }
+
+                SBX_plock_t plock = {.type = type, .temperature = type == SBX_PLOCK_TYPE_ID_UNSET ? SBX_TEMPERATURE_UNSET : temperature};
+                report = SBXBoxSetPlock(box, (SBX_box_position_t)(originX + x), (SBX_box_position_t)(originY + y), plock);
+                if(report.errorFlags) {
+                    // Return error
+                    return report;
+                }
+            }
+        }
+        player->changed[i] = false;
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_RECORDING_PLAYER_APPLY_SUCCESSFUL
+    };
+}
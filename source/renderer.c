@@ -0,0 +1,319 @@
+// Project headers
+#include <SBX/renderer.h>
+#include <SBX/strings.h>
+
+// LibC headers
+#include <string.h>
+
+// Lays the revision array out again when the chunk table changed size, the next draw uploads every visible chunk
+static SBX_report_t SBXRendererFitChunks(SBX_renderer_t* renderer, SBX_box_t* box) {
+    SBX_chunk_index_t chunkCount = (SBX_chunk_index_t)box->chunkColumns * box->chunkRows;
+    if((renderer->uploadedRevisions != SBX_POINTER_UNSET) && (renderer->chunkCount == chunkCount)) {
+        return (SBX_report_t){
+            .errorFlags    = 0,
+            .reportMessage = SBX_REPORT_STRING_RENDERER_DRAW_SUCCESSFUL
+        };
+    }
+
+    // Empty chunk tables still get one entry so the array is never empty
+    size_t    entries   = chunkCount ? chunkCount : 1;
+    uint32_t* revisions = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_RENDER, entries * sizeof(uint32_t));
+
+    // Check for a memory allocation error
+    if(!revisions) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+    memset(revisions, 0, entries * sizeof(uint32_t));
+
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_RENDER, renderer->uploadedRevisions,
+                     (renderer->chunkCount ? renderer->chunkCount : 1) * sizeof(uint32_t));
+    renderer->uploadedRevisions = revisions;
+    renderer->chunkCount        = chunkCount;
+    renderer->viewUploaded      = false;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_RENDERER_DRAW_SUCCESSFUL
+    };
+}
+
+// Grows the texture and staging image to hold at least width by height texels, their contents are lost
+static SBX_report_t SBXRendererFitTexture(SBX_renderer_t* renderer, uint32_t width, uint32_t height) {
+    if((width <= renderer->textureWidth) && (height <= renderer->textureHeight)) {
+        return (SBX_report_t){
+            .errorFlags    = 0,
+            .reportMessage = SBX_REPORT_STRING_RENDERER_DRAW_SUCCESSFUL
+        };
+    }
+
+    // Grow both sides to the largest size asked for so far, so panning between shapes does not keep recreating the texture
+    width  = width > renderer->textureWidth ? width : renderer->textureWidth;
+    height = height > renderer->textureHeight ? height : renderer->textureHeight;
+
+    size_t   stagingSize = (size_t)width * height * SBX_COLOR_PYRAMID_TEXEL_SIZE;
+    uint8_t* staging     = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_RENDER, stagingSize);
+
+    // Check for a memory allocation error
+    if(!staging) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_RENDER, renderer->staging, renderer->stagingSize);
+    renderer->staging     = staging;
+    renderer->stagingSize = stagingSize;
+
+    // Texture storage is immutable, so a bigger texture replaces the old one on the framebuffer
+    GladGLContext* gl = renderer->window->openglContext;
+    if(renderer->texture) {
+        gl->DeleteTextures(1, &renderer->texture);
+    }
+    gl->CreateTextures(GL_TEXTURE_2D, 1, &renderer->texture);
+    gl->TextureStorage2D(renderer->texture, 1, GL_RGBA8, (GLsizei)width, (GLsizei)height);
+    gl->NamedFramebufferTexture(renderer->framebuffer, GL_COLOR_ATTACHMENT0, renderer->texture, 0);
+
+    renderer->textureWidth  = width;
+    renderer->textureHeight = height;
+    renderer->viewUploaded  = false;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_RENDERER_DRAW_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXRendererCreate(SBX_renderer_t** renderer, SBX_window_t* window, const SBX_plock_type_t* types) {
+    // Check if required arguments are provided
+    if((renderer == SBX_POINTER_UNSET) || (window == SBX_POINTER_UNSET) || (types == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for window initialized
+    if(!window->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_WINDOW_ERROR_NOT_INIT,
+            .reportMessage = SBX_REPORT_STRING_WINDOW_NOT_INIT
+        };
+    }
+
+    // Allocate memory for the SBXRenderer struture, the texture is sized on the first draw
+    *renderer = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_RENDER, sizeof(SBX_renderer_t));
+
+    // Check for a memory allocation error
+    if(!*renderer) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+    memset(*renderer, 0, sizeof(SBX_renderer_t));
+    (*renderer)->window = window;
+
+    SBX_report_t report = SBXColorPyramidCreate(&(*renderer)->pyramid, types);
+    if(report.errorFlags) {
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_RENDER, *renderer, sizeof(SBX_renderer_t));
+        *renderer = SBX_POINTER_UNSET;
+        return report;
+    }
+
+    window->openglContext->CreateFramebuffers(1, &(*renderer)->framebuffer);
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMMON_CREATION_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXRendererDestroy(SBX_renderer_t* renderer) {
+    // Check if required arguments are provided
+    if(renderer == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // The OpenGL objects can only be deleted while the context of the window still exists
+    if(renderer->window->initialized) {
+        GladGLContext* gl = renderer->window->openglContext;
+        if(renderer->texture) {
+            gl->DeleteTextures(1, &renderer->texture);
+        }
+        gl->DeleteFramebuffers(1, &renderer->framebuffer);
+    }
+
+    SBXColorPyramidDestroy(renderer->pyramid);
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_RENDER, renderer->staging, renderer->stagingSize);
+    if(renderer->uploadedRevisions != SBX_POINTER_UNSET) {
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_RENDER, renderer->uploadedRevisions,
+                         (renderer->chunkCount ? renderer->chunkCount : 1) * sizeof(uint32_t));
+    }
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_RENDER, renderer, sizeof(SBX_renderer_t));
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMMON_DESTRUCTION_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXRendererSetPalette(SBX_renderer_t* renderer, const SBX_plock_type_t* types) {
+    // Check if required arguments are provided
+    if((renderer == SBX_POINTER_UNSET) || (types == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Every chunk gets a new revision on the next pyramid update, which uploads it again
+    return SBXColorPyramidSetPalette(renderer->pyramid, types);
+}
+
+SBX_report_t SBXRendererSetTarget(SBX_renderer_t* renderer, GLuint framebuffer, uint32_t width, uint32_t height) {
+    // Check if required arguments are provided
+    if((renderer == SBX_POINTER_UNSET) || (framebuffer && (!width || !height))) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    renderer->targetFramebuffer = framebuffer;
+    renderer->targetWidth       = framebuffer ? width : 0;
+    renderer->targetHeight      = framebuffer ? height : 0;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_RENDERER_SET_TARGET_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXRendererDraw(SBX_renderer_t* renderer, SBX_box_t* box, float cameraX, float cameraY, float cameraWidth, float cameraHeight) {
+    // Check if required arguments are provided
+    if((renderer == SBX_POINTER_UNSET) || (box == SBX_POINTER_UNSET) || !(cameraWidth > 0.0f) || !(cameraHeight > 0.0f)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for window initialized
+    if(!renderer->window->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_WINDOW_ERROR_NOT_INIT,
+            .reportMessage = SBX_REPORT_STRING_WINDOW_NOT_INIT
+        };
+    }
+
+    SBX_report_t report = SBXColorPyramidUpdate(renderer->pyramid, box);
+    if(report.errorFlags) {
+        return report;
+    }
+    report = SBXRendererFitChunks(renderer, box);
+    if(report.errorFlags) {
+        return report;
+    }
+    renderer->uploadedChunkCount = 0;
+
+    // Minimized windows have an empty framebuffer and nothing to draw
+    int framebufferWidth = (int)renderer->targetWidth, framebufferHeight = (int)renderer->targetHeight;
+    if(!renderer->targetFramebuffer) {
+        glfwGetFramebufferSize(renderer->window->windowHandle, &framebufferWidth, &framebufferHeight);
+    }
+    if((framebufferWidth <= 0) || (framebufferHeight <= 0)) {
+        return (SBX_report_t){
+            .errorFlags    = 0,
+            .reportMessage = SBX_REPORT_STRING_RENDERER_DRAW_SUCCESSFUL
+        };
+    }
+
+    SBX_color_pyramid_view_t view;
+    SBXColorPyramidGetView(renderer->pyramid, cameraX, cameraY, cameraWidth, cameraHeight, (uint32_t)framebufferWidth, (uint32_t)framebufferHeight, &view);
+    if(!view.columns || !view.rows) {
+        return (SBX_report_t){
+            .errorFlags    = 0,
+            .reportMessage = SBX_REPORT_STRING_RENDERER_DRAW_SUCCESSFUL
+        };
+    }
+
+    uint32_t tileSize = SBX_COLOR_PYRAMID_LEVEL_SIZE(view.level);
+    report = SBXRendererFitTexture(renderer, view.columns * tileSize, view.rows * tileSize);
+    if(report.errorFlags) {
+        return report;
+    }
+
+    // A new level or chunk range rewrites the whole texture in one upload, otherwise only chunks with a new revision are uploaded
+    SBX_bool_t wholeView = !renderer->viewUploaded || (view.level != renderer->view.level) ||
+                           (view.firstColumn != renderer->view.firstColumn) || (view.firstRow != renderer->view.firstRow) ||
+                           (view.columns != renderer->view.columns) || (view.rows != renderer->view.rows);
+    GladGLContext* gl      = renderer->window->openglContext;
+    size_t         stride  = (size_t)renderer->textureWidth * SBX_COLOR_PYRAMID_TEXEL_SIZE;
+    gl->PixelStorei(GL_UNPACK_ROW_LENGTH, (GLint)renderer->textureWidth);
+    for(uint32_t row = 0; row < view.rows; row++) {
+        for(uint32_t column = 0; column < view.columns; column++) {
+            SBX_chunk_index_t chunkIndex = (SBX_chunk_index_t)(view.firstRow + row) * box->chunkColumns + view.firstColumn + column;
+            uint32_t          revision   = renderer->pyramid->chunks[chunkIndex].revision;
+            if(!wholeView && (renderer->uploadedRevisions[chunkIndex] == revision)) {
+                continue;
+            }
+
+            uint8_t* tile = &renderer->staging[(size_t)row * tileSize * stride + (size_t)column * tileSize * SBX_COLOR_PYRAMID_TEXEL_SIZE];
+            SBXColorPyramidWriteChunk(renderer->pyramid, box, chunkIndex, view.level, tile, stride);
+            if(!wholeView) {
+                gl->TextureSubImage2D(renderer->texture, 0, (GLint)(column * tileSize), (GLint)(row * tileSize), (GLsizei)tileSize, (GLsizei)tileSize,
+                                      GL_RGBA, GL_UNSIGNED_BYTE, tile);
+            }
+            renderer->uploadedRevisions[chunkIndex] = revision;
+            renderer->uploadedChunkCount++;
+        }
+    }
+    if(wholeView) {
+        gl->TextureSubImage2D(renderer->texture, 0, 0, 0, (GLsizei)(view.columns * tileSize), (GLsizei)(view.rows * tileSize),
+                              GL_RGBA, GL_UNSIGNED_BYTE, renderer->staging);
+    }
+    gl->PixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    renderer->view         = view;
+    renderer->viewUploaded = true;
+
+    // Part of the camera the texture covers, in box positions
+    float scale      = (float)(1u << view.level);
+    float textureX   = (float)((uint32_t)view.firstColumn << SBX_CHUNK_SHIFT);
+    float textureY   = (float)((uint32_t)view.firstRow << SBX_CHUNK_SHIFT);
+    float coveredX0  = cameraX > textureX ? cameraX : textureX;
+    float coveredY0  = cameraY > textureY ? cameraY : textureY;
+    float coveredX1  = cameraX + cameraWidth < textureX + (float)(view.columns * tileSize) * scale ? cameraX + cameraWidth : textureX + (float)(view.columns * tileSize) * scale;
+    float coveredY1  = cameraY + cameraHeight < textureY + (float)(view.rows * tileSize) * scale ? cameraY + cameraHeight : textureY + (float)(view.rows * tileSize) * scale;
+    float pixelsPerX = (float)framebufferWidth / cameraWidth;
+    float pixelsPerY = (float)framebufferHeight / cameraHeight;
+
+    // Box rows grow downwards and framebuffer rows upwards, so the destination rectangle is flipped
+    GLint sourceX0 = (GLint)((coveredX0 - textureX) / scale + 0.5f), sourceX1 = (GLint)((coveredX1 - textureX) / scale + 0.5f);
+    GLint sourceY0 = (GLint)((coveredY0 - textureY) / scale + 0.5f), sourceY1 = (GLint)((coveredY1 - textureY) / scale + 0.5f);
+    GLint targetX0 = (GLint)((coveredX0 - cameraX) * pixelsPerX + 0.5f), targetX1 = (GLint)((coveredX1 - cameraX) * pixelsPerX + 0.5f);
+    GLint targetY0 = framebufferHeight - (GLint)((coveredY0 - cameraY) * pixelsPerY + 0.5f);
+    GLint targetY1 = framebufferHeight - (GLint)((coveredY1 - cameraY) * pixelsPerY + 0.5f);
+
+    // Magnified texels stay square, minified ones are filtered
+    gl->BlitNamedFramebuffer(renderer->framebuffer, renderer->targetFramebuffer, sourceX0, sourceY0, sourceX1, sourceY1, targetX0, targetY0, targetX1, targetY1,
+                             GL_COLOR_BUFFER_BIT, pixelsPerX >= 1.0f / scale ? GL_NEAREST : GL_LINEAR);
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_RENDERER_DRAW_SUCCESSFUL
+    };
+}
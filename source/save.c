@@ -0,0 +1,379 @@
+// Project headers
+#include <SBX/save.h>
+#include <SBX/strings.h>
+#include <SBX/chunk.h>
+#include <SBX/plock.h>
+
+// LibC headers
+#include <stdlib.h>
+#include <string.h>
+
+// Size of the stdio buffer the writer thread streams through
+#define SBX_BOX_SAVE_BUFFER_SIZE   (1 << 20)
+// Largest size a serialized chunk can take, a type byte and a temperature for every plock plus the present byte and the content hash
+#define SBX_BOX_SAVE_CHUNK_MAXIMUM (1 + sizeof(uint64_t) + SBX_CHUNK_PLOCK_COUNT * (sizeof(SBX_plock_type_id_t) + sizeof(double)))
+// Oldest save version that can still be loaded, version 1 saves have no chunk content hashes
+#define SBX_BOX_SAVE_VERSION_MINIMUM 1
+
+// Serializes a chunk into a buffer, its content hash followed by its plocks in row-major order, and returns the amount of bytes written.
+// Unset plocks only take their type byte
+static size_t SBXBoxSaveSerializeChunk(SBX_chunk_data_t* data, uint8_t* buffer) {
+    size_t size = 0;
+
+    // Empty chunks are a single absent byte
+    buffer[size++] = data != SBX_POINTER_UNSET;
+    if(data == SBX_POINTER_UNSET) {
+        return size;
+    }
+
+    // The content hash lets readers compare chunks without decoding them, and loads check it
+    memcpy(&buffer[size], &data->contentHash, sizeof(uint64_t));
+    size += sizeof(uint64_t);
+
+    for(SBX_plock_count_t i = 0; i < SBX_CHUNK_PLOCK_COUNT; i++) {
+        SBX_plock_id_t plockID = *SBXPlockIDMatrixAt(&data->plockIDMatrix, i & SBX_CHUNK_MASK, i >> SBX_CHUNK_SHIFT);
+        if(plockID == SBX_PLOCK_ID_UNSET) {
+            buffer[size++] = SBX_PLOCK_TYPE_ID_UNSET;
+            continue;
+        }
+
+        SBX_plock_t* plock = &data->plockArray.plocks[SBX_PLOCK_ID_TO_INDEX(plockID)];
+        double temperature = (double)plock->temperature;
+        buffer[size++] = plock->type;
+        memcpy(&buffer[size], &temperature, sizeof(double));
+        size += sizeof(double);
+    }
+
+    return size;
+}
+
+// Writer thread entry, streams the header and every chunk of the snapshot then closes the file
+static int SBXBoxSaveWriterThread(void* argument) {
+    SBX_box_save_t* save = argument;
+    SBX_bool_t failed = false;
+
+    // Write header, all values are written in native byte order
+    uint32_t version = SBX_BOX_SAVE_VERSION;
+    uint16_t chunkSize = SBX_CHUNK_SIZE;
+    failed |= fwrite(SBX_BOX_SAVE_MAGIC, 1, 4, save->file) != 4;
+    failed |= fwrite(&version, sizeof(version), 1, save->file) != 1;
+    failed |= fwrite(&save->width, sizeof(save->width), 1, save->file) != 1;
+    failed |= fwrite(&save->height, sizeof(save->height), 1, save->file) != 1;
+    failed |= fwrite(&chunkSize, sizeof(chunkSize), 1, save->file) != 1;
+
+    // Serialize chunks one at a time, giving each reference back as soon as it is on its way to disk
+    uint8_t* buffer = SBXAllocatorAllocate(save->allocator, SBX_MEMORY_SUBSYSTEM_SAVE, SBX_BOX_SAVE_CHUNK_MAXIMUM);
+    failed |= buffer == SBX_POINTER_UNSET;
+    for(SBX_chunk_index_t i = 0; i < (SBX_chunk_index_t)save->chunkColumns * save->chunkRows; i++) {
+        if(!failed) {
+            size_t size = SBXBoxSaveSerializeChunk(save->chunks[i], buffer);
+            failed |= fwrite(buffer, 1, size, save->file) != size;
+        }
+
+        if(save->chunks[i] != SBX_POINTER_UNSET) {
+            SBXChunkDataRelease(save->chunks[i]);
+            save->chunks[i] = SBX_POINTER_UNSET;
+        }
+    }
+    SBXAllocatorFree(save->allocator, SBX_MEMORY_SUBSYSTEM_SAVE, buffer, SBX_BOX_SAVE_CHUNK_MAXIMUM);
+
+    // Flush and close the file, this is where most buffered write errors show up
+    failed |= fclose(save->file) != 0;
+    save->file = SBX_POINTER_UNSET;
+
+    if(failed) {
+        save->writerReport = (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_IO_FAILURE
+        };
+    } else {
+        save->writerReport = (SBX_report_t){
+            .errorFlags    = 0,
+            .reportMessage = SBX_REPORT_STRING_BOX_SAVE_SUCCESSFUL
+        };
+    }
+
+    atomic_store_explicit(&save->finished, true, memory_order_release);
+
+    return 0;
+}
+
+SBX_report_t SBXBoxSaveBegin(SBX_box_t* box, SBX_string_t path, SBX_box_save_t** save) {
+    // Check if required arguments are provided
+    if((box == SBX_POINTER_UNSET) || (path == SBX_POINTER_UNSET) || (save == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for box initialized
+    if(!box->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_NOT_INIT,
+            .reportMessage = SBX_REPORT_STRING_BOX_NOT_INIT
+        };
+    }
+
+    // Allocate memory for the SBXBoxSave structure and the snapshot chunk table
+    SBX_chunk_index_t chunkCount = (SBX_chunk_index_t)box->chunkColumns * box->chunkRows;
+    *save = SBXAllocatorAllocate(box->allocator, SBX_MEMORY_SUBSYSTEM_SAVE, sizeof(SBX_box_save_t));
+    if(*save != SBX_POINTER_UNSET) {
+        (*save)->allocator = box->allocator;
+        (*save)->chunks    = SBXAllocatorAllocate(box->allocator, SBX_MEMORY_SUBSYSTEM_SAVE, sizeof(SBX_chunk_data_t*) * chunkCount);
+    }
+
+    // Check for a memory allocation error
+    if((*save == SBX_POINTER_UNSET) || ((*save)->chunks == SBX_POINTER_UNSET)) {
+        SBXAllocatorFree(box->allocator, SBX_MEMORY_SUBSYSTEM_SAVE, *save, sizeof(SBX_box_save_t));
+        *save = SBX_POINTER_UNSET;
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    // Open the file with a large stdio buffer so the writer thread does few big writes
+    (*save)->file = fopen(path, "wb");
+    if((*save)->file == SBX_POINTER_UNSET) {
+        SBXAllocatorFree(box->allocator, SBX_MEMORY_SUBSYSTEM_SAVE, (*save)->chunks, sizeof(SBX_chunk_data_t*) * chunkCount);
+        SBXAllocatorFree(box->allocator, SBX_MEMORY_SUBSYSTEM_SAVE, *save, sizeof(SBX_box_save_t));
+        *save = SBX_POINTER_UNSET;
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_IO_FAILURE
+        };
+    }
+    setvbuf((*save)->file, NULL, _IOFBF, SBX_BOX_SAVE_BUFFER_SIZE);
+
+    // Take the snapshot, this only references chunk storage so it is O(chunks) no matter how many plocks the box has
+    (*save)->width        = box->width;
+    (*save)->height       = box->height;
+    (*save)->chunkColumns = box->chunkColumns;
+    (*save)->chunkRows    = box->chunkRows;
+    for(SBX_chunk_index_t i = 0; i < chunkCount; i++) {
+        (*save)->chunks[i] = box->chunks[i].data;
+        if((*save)->chunks[i] != SBX_POINTER_UNSET) {
+            SBXChunkDataRetain((*save)->chunks[i]);
+        }
+    }
+    atomic_init(&(*save)->finished, false);
+    (*save)->writerReport = (SBX_report_t){.errorFlags = 0, .reportMessage = NULL};
+
+    // Start the writer thread
+    if(thrd_create(&(*save)->writerThread, SBXBoxSaveWriterThread, *save) != thrd_success) {
+        // Give the snapshot back before exiting
+        for(SBX_chunk_index_t i = 0; i < chunkCount; i++) {
+            if((*save)->chunks[i] != SBX_POINTER_UNSET) {
+                SBXChunkDataRelease((*save)->chunks[i]);
+            }
+        }
+        fclose((*save)->file);
+        SBXAllocatorFree(box->allocator, SBX_MEMORY_SUBSYSTEM_SAVE, (*save)->chunks, sizeof(SBX_chunk_data_t*) * chunkCount);
+        SBXAllocatorFree(box->allocator, SBX_MEMORY_SUBSYSTEM_SAVE, *save, sizeof(SBX_box_save_t));
+        *save = SBX_POINTER_UNSET;
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_THREAD_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_THREAD_FAILURE
+        };
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_SAVE_BEGIN_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxSavePoll(SBX_box_save_t* save, SBX_bool_t* finished) {
+    // Check if required arguments are provided
+    if((save == SBX_POINTER_UNSET) || (finished == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    *finished = atomic_load_explicit(&save->finished, memory_order_acquire);
+
+    // Return success
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_SAVE_POLL_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxSaveEnd(SBX_box_save_t* save) {
+    // Check if required arguments are provided
+    if(save == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Wait for the writer thread, it has released every chunk reference by the time it exits
+    SBX_report_t report;
+    if(thrd_join(save->writerThread, NULL) != thrd_success) {
+        report = (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_THREAD_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_THREAD_FAILURE
+        };
+    } else {
+        report = save->writerReport;
+    }
+
+    SBX_allocator_t* allocator = save->allocator;
+    SBXAllocatorFree(allocator, SBX_MEMORY_SUBSYSTEM_SAVE, save->chunks, sizeof(SBX_chunk_data_t*) * save->chunkColumns * save->chunkRows);
+    SBXAllocatorFree(allocator, SBX_MEMORY_SUBSYSTEM_SAVE, save, sizeof(SBX_box_save_t));
+
+    return report;
+}
+
+SBX_report_t SBXBoxSave(SBX_box_t* box, SBX_string_t path) {
+    SBX_box_save_t* save = SBX_POINTER_UNSET;
+
+    // Start the save and wait for it straight away
+    SBX_report_t report = SBXBoxSaveBegin(box, path, &save);
+    if(report.errorFlags) {
+        return report;
+    }
+
+    return SBXBoxSaveEnd(save);
+}
+
+SBX_report_t SBXBoxLoad(SBX_box_t* box, SBX_string_t path) {
+    // Check if required arguments are provided
+    if((box == SBX_POINTER_UNSET) || (path == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for box not already initialized
+    if(box->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_ALREADY_INIT,
+            .reportMessage = SBX_REPORT_STRING_BOX_ALREADY_INIT
+        };
+    }
+
+    FILE* file = fopen(path, "rb");
+    if(file == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_IO_FAILURE
+        };
+    }
+
+    // Read and check header
+    char magic[4];
+    uint32_t version = 0;
+    uint16_t chunkSize = 0;
+    SBX_box_dimensions_t width = SBX_DIMENSION_UNSET, height = SBX_DIMENSION_UNSET;
+    SBX_bool_t valid = fread(magic, 1, 4, file) == 4 && !memcmp(magic, SBX_BOX_SAVE_MAGIC, 4) &&
+                       fread(&version, sizeof(version), 1, file) == 1 &&
+                       version >= SBX_BOX_SAVE_VERSION_MINIMUM && version <= SBX_BOX_SAVE_VERSION &&
+                       fread(&width, sizeof(width), 1, file) == 1 && width != SBX_DIMENSION_UNSET &&
+                       fread(&height, sizeof(height), 1, file) == 1 && height != SBX_DIMENSION_UNSET &&
+                       fread(&chunkSize, sizeof(chunkSize), 1, file) == 1 && chunkSize == SBX_CHUNK_SIZE;
+    if(!valid) {
+        fclose(file);
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_BOX_SAVE_INVALID_FILE
+        };
+    }
+
+    // Initialize the box with the saved size
+    SBX_report_t report = SBXBoxInit(box, width, height);
+    if(report.errorFlags) {
+        fclose(file);
+        return report;
+    }
+
+    // Read chunks straight into fresh chunk storage
+    for(SBX_chunk_index_t i = 0; valid && i < (SBX_chunk_index_t)box->chunkColumns * box->chunkRows; i++) {
+        uint8_t present = 0;
+        valid = fread(&present, 1, 1, file) == 1;
+        if(!valid || !present) {
+            continue;
+        }
+
+        uint64_t contentHash = 0;
+        if(version >= 2) {
+            valid = fread(&contentHash, sizeof(contentHash), 1, file) == 1;
+            if(!valid) {
+                continue;
+            }
+        }
+
+        SBX_chunk_t* chunk = &box->chunks[i];
+        report = SBXChunkMakeWritable(chunk, box->allocator);
+        if(report.errorFlags) {
+            break;
+        }
+
+        for(SBX_plock_count_t j = 0; valid && j < SBX_CHUNK_PLOCK_COUNT; j++) {
+            SBX_plock_type_id_t type = SBX_PLOCK_TYPE_ID_UNSET;
+            double temperature = 0.0;
+            valid = fread(&type, sizeof(type), 1, file) == 1;
+            if(!valid || type == SBX_PLOCK_TYPE_ID_UNSET) {
+                continue;
+            }
+            valid = fread(&temperature, sizeof(temperature), 1, file) == 1;
+
+            SBX_plock_id_t* plockID = SBXPlockIDMatrixAt(&chunk->data->plockIDMatrix, j & SBX_CHUNK_MASK, j >> SBX_CHUNK_SHIFT);
+            SBXPlockArrayAcquire(&chunk->data->plockArray, plockID);
+            chunk->data->plockArray.plocks[SBX_PLOCK_ID_TO_INDEX(*plockID)] = (SBX_plock_t){
+                .type        = type,
+                .temperature = temperature
+            };
+            box->plockTypeCounts[type]++;
+        }
+        chunk->data->spatiallyOrdered = false;
+        SBXChunkDataRecountStats(chunk->data);
+        SBXChunkDataRecountHash(chunk->data);
+
+        // A chunk that does not hash to what was saved was damaged on the way
+        if(version >= 2) {
+            valid = valid && chunk->data->contentHash == contentHash;
+        }
+    }
+    fclose(file);
+
+    // The chunks were filled without going through plock writes
+    SBXBoxThermalActivateAll(box);
+
+    // Check if reading the chunks failed, then deinitialize the half loaded box
+    if(!valid || report.errorFlags) {
+        SBXBoxDeinit(box);
+
+        // Return error
+        if(report.errorFlags) {
+            return report;
+        }
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_BOX_SAVE_INVALID_FILE
+        };
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_LOAD_SUCCESSFUL
+    };
+}
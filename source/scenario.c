@@ -0,0 +1,359 @@
+// Project headers
+#include <SBX/scenario.h>
+#include <SBX/strings.h>
+#include <SBX/command.h>
+#include <SBX/chunk.h>
+#include <SBX/plock.h>
+#include <SBX/step.h>
+
+// LibC headers
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Built-in corpus, golden files are named after the scenarios so renaming one needs its golden file rewritten
+static const SBX_scenario_t SBXScenarioCorpus[] = {
+    {.name = "small-dense",   .seed = 0x5B0001, .width = 96,   .height = 80,   .tickCount = 240, .editsPerTick = 64,  .resizes = false},
+    {.name = "large-sparse",  .seed = 0x5B0002, .width = 1024, .height = 768,  .tickCount = 120, .editsPerTick = 16,  .resizes = false},
+    {.name = "resizing",      .seed = 0x5B0003, .width = 200,  .height = 150,  .tickCount = 200, .editsPerTick = 48,  .resizes = true},
+    {.name = "fill-heavy",    .seed = 0x5B0004, .width = 320,  .height = 320,  .tickCount = 160, .editsPerTick = 256, .resizes = false}
+};
+
+// Advances a splitmix64 state and returns the next value
+static uint64_t SBXScenarioRandom(uint64_t* state) {
+    uint64_t value = (*state += 0x9E3779B97F4A7C15ULL);
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+// Derives the next edit of a scenario, width and height follow the resizes already pushed this tick so every position is inside the box when applied
+static SBX_box_command_t SBXScenarioNextCommand(const SBX_scenario_t* scenario, uint64_t* state, uint32_t edit,
+                                                SBX_box_dimensions_t* width, SBX_box_dimensions_t* height)
+{
+    uint64_t roll = SBXScenarioRandom(state);
+    SBX_box_command_t command = {
+        .x     = (SBX_box_position_t)(SBXScenarioRandom(state) % *width),
+        .y     = (SBX_box_position_t)(SBXScenarioRandom(state) % *height),
+        .plock = {
+            .type        = (SBX_plock_type_id_t)(1 + SBXScenarioRandom(state) % 8),
+            .temperature = (SBX_plock_temperature_t)(SBXScenarioRandom(state) % 200000) / 100 - 100
+        }
+    };
+
+    // Resizes only lead a tick, keeping the positions of the edits after them valid
+    if(scenario->resizes && !edit && (roll % 100 < 20)) {
+        command.type   = SBX_BOX_COMMAND_RESIZE;
+        command.width  = (SBX_box_dimensions_t)(scenario->width  / 2 + SBXScenarioRandom(state) % scenario->width);
+        command.height = (SBX_box_dimensions_t)(scenario->height / 2 + SBXScenarioRandom(state) % scenario->height);
+        *width  = command.width;
+        *height = command.height;
+        return command;
+    }
+
+    roll %= 100;
+    if(roll < 70) {
+        command.type = SBX_BOX_COMMAND_PAINT;
+    }
+    else if(roll < 85) {
+        command.type   = SBX_BOX_COMMAND_FILL;
+        command.width  = (SBX_box_dimensions_t)(1 + SBXScenarioRandom(state) % 32);
+        command.height = (SBX_box_dimensions_t)(1 + SBXScenarioRandom(state) % 32);
+    }
+    else if(roll < 95) {
+        command.type = SBX_BOX_COMMAND_SET_TEMPERATURE;
+    }
+    else {
+        // Erase, unset plocks are part of the state too
+        command.type       = SBX_BOX_COMMAND_PAINT;
+        command.plock.type = SBX_PLOCK_TYPE_ID_UNSET;
+    }
+
+    return command;
+}
+
+// Splitmix64 finalizer, mixes a plock hash the same way chunk hashes do
+static inline uint64_t SBXScenarioHashMix(uint64_t hash) {
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+    return hash ^ (hash >> 31);
+}
+
+// Reads the current time in nanoseconds
+static uint64_t SBXScenarioNow(void) {
+    struct timespec now;
+    timespec_get(&now, TIME_UTC);
+    return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+SBX_report_t SBXScenarioGetCorpus(const SBX_scenario_t** scenarios, uint32_t* count) {
+    // Check if required arguments are provided
+    if((scenarios == SBX_POINTER_UNSET) || (count == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    *scenarios = SBXScenarioCorpus;
+    *count     = sizeof(SBXScenarioCorpus) / sizeof(SBXScenarioCorpus[0]);
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_SCENARIO_GET_CORPUS_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXScenarioHashChunks(SBX_box_t* box, uint64_t* hashes) {
+    // Check if required arguments are provided
+    if((box == SBX_POINTER_UNSET) || (hashes == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for box initialized
+    if(!box->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_NOT_INIT,
+            .reportMessage = SBX_REPORT_STRING_BOX_NOT_INIT
+        };
+    }
+
+    // Temperatures are rounded to SBX_SCENARIO_TEMPERATURE_QUANTA steps per degree before hashing, so the last bits diffusion leaves
+    // behind, which differ between long double formats, don't take part
+    for(SBX_chunk_index_t i = 0; i < (SBX_chunk_index_t)box->chunkColumns * box->chunkRows; i++) {
+        SBX_chunk_data_t* data = box->chunks[i].data;
+        hashes[i] = 0;
+        if(data == SBX_POINTER_UNSET) {
+            continue;
+        }
+        for(SBX_plock_count_t position = 0; position < SBX_CHUNK_PLOCK_COUNT; position++) {
+            SBX_plock_id_t plockID = *SBXPlockIDMatrixAt(&data->plockIDMatrix, position & SBX_CHUNK_MASK, position >> SBX_CHUNK_SHIFT);
+            if(plockID != SBX_PLOCK_ID_UNSET) {
+                const SBX_plock_t* plock = &data->plockArray.plocks[SBX_PLOCK_ID_TO_INDEX(plockID)];
+                uint64_t temperature = (uint64_t)llroundl(plock->temperature * SBX_SCENARIO_TEMPERATURE_QUANTA);
+                hashes[i] += SBXScenarioHashMix(SBXChunkHashPlockType(position, plock->type) ^ temperature);
+            }
+        }
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_SCENARIO_HASH_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXScenarioRun(const SBX_scenario_t* scenario, const SBX_scenario_options_t* options, SBX_scenario_result_t* result) {
+    // Check if required arguments are provided
+    if((scenario == SBX_POINTER_UNSET) || (options == SBX_POINTER_UNSET) || (options->goldenDirectory == SBX_POINTER_UNSET) ||
+       (scenario->name == SBX_POINTER_UNSET) || !scenario->tickCount || !scenario->editsPerTick) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    SBX_scenario_result_t localResult;
+    if(result == SBX_POINTER_UNSET) {
+        result = &localResult;
+    }
+    *result = (SBX_scenario_result_t){
+        .divergedTick            = SBX_SCENARIO_TICK_UNSET,
+        .divergedChunk           = SBX_SCENARIO_CHUNK_UNSET,
+        .meanStepNanoseconds     = 0,
+        .baselineStepNanoseconds = 0
+    };
+
+    // Open the golden file, writing it from scratch when updating
+    char path[1024];
+    if(snprintf(path, sizeof(path), "%s/%s%s", options->goldenDirectory, scenario->name, SBX_SCENARIO_GOLDEN_EXTENSION) >= (int)sizeof(path)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    FILE* golden = fopen(path, options->update ? "wb" : "rb");
+    if(golden == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_IO_FAILURE
+        };
+    }
+
+    // Header, all values are in native byte order, the baseline is patched in once the run is over
+    uint32_t version = SBX_SCENARIO_GOLDEN_VERSION;
+    uint64_t tickCount = scenario->tickCount;
+    SBX_bool_t valid;
+    if(options->update) {
+        uint64_t baseline = 0;
+        valid = fwrite(SBX_SCENARIO_GOLDEN_MAGIC, 1, 4, golden) == 4 && fwrite(&version, sizeof(version), 1, golden) == 1 &&
+                fwrite(&baseline, sizeof(baseline), 1, golden) == 1 && fwrite(&tickCount, sizeof(tickCount), 1, golden) == 1;
+    } else {
+        char magic[4];
+        valid = fread(magic, 1, 4, golden) == 4 && !memcmp(magic, SBX_SCENARIO_GOLDEN_MAGIC, 4) &&
+                fread(&version, sizeof(version), 1, golden) == 1 && version == SBX_SCENARIO_GOLDEN_VERSION &&
+                fread(&result->baselineStepNanoseconds, sizeof(result->baselineStepNanoseconds), 1, golden) == 1 &&
+                fread(&tickCount, sizeof(tickCount), 1, golden) == 1 && tickCount == scenario->tickCount;
+    }
+    if(!valid) {
+        fclose(golden);
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+            .reportMessage = options->update ? SBX_REPORT_STRING_COMMON_IO_FAILURE : SBX_REPORT_STRING_SCENARIO_INVALID_GOLDEN
+        };
+    }
+
+    // Set up the box
+    SBX_box_t* box = SBX_POINTER_UNSET;
+    SBX_report_t report = SBXBoxCreate(&box);
+    if(!report.errorFlags) {
+        report = SBXBoxInit(box, scenario->width, scenario->height);
+        if(report.errorFlags) {
+            SBXBoxDestroy(box);
+        }
+    }
+    if(report.errorFlags) {
+        fclose(golden);
+        return report;
+    }
+
+    uint64_t* hashes       = SBX_POINTER_UNSET;
+    uint64_t* goldenHashes = SBX_POINTER_UNSET;
+    SBX_chunk_index_t hashCapacity = 0;
+    uint64_t state         = scenario->seed;
+    uint64_t stepTime      = 0;
+    SBX_box_tick_t tick;
+    for(tick = 0; tick < scenario->tickCount; tick++) {
+        // Push the edits of the tick, then time the step that applies them
+        SBX_box_dimensions_t width = box->width, height = box->height;
+        for(uint32_t edit = 0; !report.errorFlags && edit < scenario->editsPerTick; edit++) {
+            report = SBXBoxPushCommand(box, SBXScenarioNextCommand(scenario, &state, edit, &width, &height));
+        }
+        if(report.errorFlags) {
+            break;
+        }
+
+        uint64_t start = SBXScenarioNow();
+        report = SBXBoxStep(box);
+        stepTime += SBXScenarioNow() - start;
+        if(report.errorFlags) {
+            break;
+        }
+
+        // Make room for the hashes of the chunk table, which resizes can grow
+        SBX_chunk_index_t chunkCount = (SBX_chunk_index_t)box->chunkColumns * box->chunkRows;
+        if(chunkCount > hashCapacity) {
+            free(hashes);
+            free(goldenHashes);
+            hashes       = malloc(sizeof(uint64_t) * chunkCount);
+            goldenHashes = malloc(sizeof(uint64_t) * chunkCount);
+            hashCapacity = chunkCount;
+            if((hashes == SBX_POINTER_UNSET) || (goldenHashes == SBX_POINTER_UNSET)) {
+                report = (SBX_report_t){
+                    .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+                    .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+                };
+                break;
+            }
+        }
+        SBXScenarioHashChunks(box, hashes);
+
+        // Every tick is the chunk table size followed by one hash per chunk
+        uint16_t chunkColumns = box->chunkColumns, chunkRows = box->chunkRows;
+        if(options->update) {
+            valid = fwrite(&chunkColumns, sizeof(chunkColumns), 1, golden) == 1 && fwrite(&chunkRows, sizeof(chunkRows), 1, golden) == 1 &&
+                    fwrite(hashes, sizeof(uint64_t), chunkCount, golden) == chunkCount;
+        } else {
+            uint16_t goldenColumns = 0, goldenRows = 0;
+            valid = fread(&goldenColumns, sizeof(goldenColumns), 1, golden) == 1 && fread(&goldenRows, sizeof(goldenRows), 1, golden) == 1;
+            if(valid && ((goldenColumns != chunkColumns) || (goldenRows != chunkRows))) {
+                result->divergedTick = tick;
+                break;
+            }
+            valid = valid && fread(goldenHashes, sizeof(uint64_t), chunkCount, golden) == chunkCount;
+            for(SBX_chunk_index_t i = 0; valid && i < chunkCount; i++) {
+                if(hashes[i] != goldenHashes[i]) {
+                    result->divergedTick  = tick;
+                    result->divergedChunk = i;
+                    break;
+                }
+            }
+            if(result->divergedTick != SBX_SCENARIO_TICK_UNSET) {
+                break;
+            }
+        }
+        if(!valid) {
+            report = (SBX_report_t){
+                .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+                .reportMessage = options->update ? SBX_REPORT_STRING_COMMON_IO_FAILURE : SBX_REPORT_STRING_SCENARIO_INVALID_GOLDEN
+            };
+            break;
+        }
+    }
+    result->meanStepNanoseconds = tick ? stepTime / tick : 0;
+
+    // Record this run as the timing baseline when updating
+    if(options->update && !report.errorFlags) {
+        result->baselineStepNanoseconds = result->meanStepNanoseconds;
+        valid = !fseek(golden, 4 + sizeof(version), SEEK_SET) &&
+                fwrite(&result->meanStepNanoseconds, sizeof(result->meanStepNanoseconds), 1, golden) == 1;
+        if(!valid) {
+            report = (SBX_report_t){
+                .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+                .reportMessage = SBX_REPORT_STRING_COMMON_IO_FAILURE
+            };
+        }
+    }
+    if(fclose(golden) && options->update && !report.errorFlags) {
+        report = (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_IO_FAILURE
+        };
+    }
+
+    free(hashes);
+    free(goldenHashes);
+    SBXBoxDeinit(box);
+    SBXBoxDestroy(box);
+
+    if(report.errorFlags) {
+        return report;
+    }
+    if(options->update) {
+        return (SBX_report_t){
+            .errorFlags    = 0,
+            .reportMessage = SBX_REPORT_STRING_SCENARIO_UPDATE_SUCCESSFUL
+        };
+    }
+
+    // Divergence wins over timing, a diverged run stopped early so its timing means little
+    if(result->divergedTick != SBX_SCENARIO_TICK_UNSET) {
+        return (SBX_report_t){
+            .errorFlags    = SBX_SCENARIO_ERROR_DIVERGED,
+            .reportMessage = SBX_REPORT_STRING_SCENARIO_DIVERGED
+        };
+    }
+    if((options->timingThreshold > 0.0) && result->baselineStepNanoseconds &&
+       ((double)result->meanStepNanoseconds > (double)result->baselineStepNanoseconds * options->timingThreshold)) {
+        return (SBX_report_t){
+            .errorFlags    = SBX_SCENARIO_ERROR_TOO_SLOW,
+            .reportMessage = SBX_REPORT_STRING_SCENARIO_TOO_SLOW
+        };
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_SCENARIO_RUN_SUCCESSFUL
+    };
+}
@@ -0,0 +1,664 @@
+// shm_open, mmap, ftruncate, and the futex system call are extensions on top of C17
+#if defined(__linux__)
+    #define _GNU_SOURCE
+#endif
+
+// Project headers
+#include <SBX/slab.h>
+#include <SBX/strings.h>
+#include <SBX/step.h>
+
+// LibC headers
+#include <limits.h>
+#include <string.h>
+#include <threads.h>
+#include <time.h>
+
+// Platform headers
+#if defined(__linux__)
+    #define SBX_SLAB_SHARED_MEMORY
+    #include <fcntl.h>
+    #include <linux/futex.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+// Rounds a size up to a cache line, so channels and queues written by different processes never share one
+#define SBX_SLAB_ALIGN(size) (((size) + 63) & ~(size_t)63)
+
+// Where the parts of the shared memory of a group are, derived from its header so every process lays it out the same way
+typedef struct SBXSlabLayout {
+    uint32_t lineCount;
+    uint32_t lineLength;
+    size_t   channelOffset;
+    size_t   channelStride;
+    size_t   queueOffset;
+    size_t   queueStride;
+    size_t   size;
+} SBX_slab_layout_t;
+
+static SBX_slab_layout_t SBXSlabGetLayout(SBX_slab_axis_t axis, SBX_box_dimensions_t width, SBX_box_dimensions_t height,
+                                          uint16_t slabCount, uint32_t migrationCapacity) {
+    SBX_slab_layout_t layout;
+    layout.lineCount     = axis == SBX_SLAB_AXIS_HORIZONTAL ? height : width;
+    layout.lineLength    = axis == SBX_SLAB_AXIS_HORIZONTAL ? width : height;
+    layout.channelOffset = SBX_SLAB_ALIGN(sizeof(SBX_slab_shared_t));
+    layout.channelStride = SBX_SLAB_ALIGN(SBX_SLAB_ALIGN(sizeof(SBX_slab_channel_t)) +
+                                          (size_t)SBX_SLAB_HALO_SLOTS * SBX_SLAB_HALO_DEPTH * layout.lineLength * sizeof(SBX_plock_t));
+    layout.queueOffset   = layout.channelOffset + 2 * (size_t)slabCount * layout.channelStride;
+    layout.queueStride   = SBX_SLAB_ALIGN(SBX_SLAB_ALIGN(sizeof(SBX_slab_queue_t)) + (size_t)migrationCapacity * sizeof(SBX_slab_migration_t));
+    layout.size          = layout.queueOffset + (size_t)slabCount * layout.queueStride;
+    return layout;
+}
+
+static inline SBX_slab_layout_t SBXSlabGetSharedLayout(const SBX_slab_shared_t* shared) {
+    return SBXSlabGetLayout(shared->axis, shared->width, shared->height, shared->slabCount, shared->migrationCapacity);
+}
+
+// Channel a slab sends its border lines to a neighbor through, direction 0 goes to the slab before it and 1 to the slab after it
+static inline SBX_slab_channel_t* SBXSlabGetChannel(SBX_slab_shared_t* shared, const SBX_slab_layout_t* layout, uint16_t sender, uint32_t direction) {
+    return (SBX_slab_channel_t*)((uint8_t*)shared + layout->channelOffset + (2 * (size_t)sender + direction) * layout->channelStride);
+}
+
+// Lines of a channel for a tick
+static inline SBX_plock_t* SBXSlabGetChannelLines(SBX_slab_channel_t* channel, const SBX_slab_layout_t* layout, uint32_t tick) {
+    return (SBX_plock_t*)((uint8_t*)channel + SBX_SLAB_ALIGN(sizeof(SBX_slab_channel_t))) +
+           (size_t)(tick % SBX_SLAB_HALO_SLOTS) * SBX_SLAB_HALO_DEPTH * layout->lineLength;
+}
+
+static inline SBX_slab_queue_t* SBXSlabGetQueue(SBX_slab_shared_t* shared, const SBX_slab_layout_t* layout, uint16_t slab) {
+    return (SBX_slab_queue_t*)((uint8_t*)shared + layout->queueOffset + (size_t)slab * layout->queueStride);
+}
+
+static inline SBX_slab_migration_t* SBXSlabGetQueueSlots(SBX_slab_queue_t* queue) {
+    return (SBX_slab_migration_t*)((uint8_t*)queue + SBX_SLAB_ALIGN(sizeof(SBX_slab_queue_t)));
+}
+
+// First world line a slab owns, slabs split the lines as evenly as possible
+static inline uint32_t SBXSlabGetFirstLine(uint32_t lineCount, uint16_t slabCount, uint32_t slab) {
+    return (uint32_t)((uint64_t)lineCount * slab / slabCount);
+}
+
+// Slab owning a world line
+static uint16_t SBXSlabGetOwner(uint32_t lineCount, uint16_t slabCount, uint32_t line) {
+    uint32_t slab = (uint32_t)((uint64_t)line * slabCount / lineCount);
+    while((slab + 1 < slabCount) && (SBXSlabGetFirstLine(lineCount, slabCount, slab + 1) <= line)) {
+        slab++;
+    }
+    while(SBXSlabGetFirstLine(lineCount, slabCount, slab) > line) {
+        slab--;
+    }
+    return (uint16_t)slab;
+}
+
+// Whether a wrapping counter reached a target
+static inline SBX_bool_t SBXSlabReached(uint32_t value, uint32_t target) {
+    return (int32_t)(value - target) >= 0;
+}
+
+// Whether a migration is applied before another one, the queue of one sender is already in order
+static inline SBX_bool_t SBXSlabPrecedes(const SBX_slab_migration_t* migration, const SBX_slab_migration_t* other) {
+    int32_t distance = (int32_t)(migration->tick - other->tick);
+    return (distance < 0) || ((distance == 0) && (migration->sender < other->sender));
+}
+
+static void SBXSlabWake(_Atomic uint32_t* word) {
+#if defined(SBX_SLAB_SHARED_MEMORY)
+    syscall(SYS_futex, (uint32_t*)word, FUTEX_WAKE, INT_MAX, NULL, NULL, 0);
+#else
+    (void)word;
+#endif
+}
+
+// Sleeps until a counter written by another process reaches a target, false after SBX_SLAB_TIMEOUT_MILLISECONDS
+static SBX_bool_t SBXSlabWaitFor(_Atomic uint32_t* word, uint32_t target) {
+    struct timespec start;
+    timespec_get(&start, TIME_UTC);
+    for(;;) {
+        uint32_t value = atomic_load_explicit(word, memory_order_acquire);
+        if(SBXSlabReached(value, target)) {
+            return true;
+        }
+
+        struct timespec now;
+        timespec_get(&now, TIME_UTC);
+        long long elapsed = (long long)(now.tv_sec - start.tv_sec) * 1000 + (now.tv_nsec - start.tv_nsec) / 1000000;
+        if(elapsed >= SBX_SLAB_TIMEOUT_MILLISECONDS) {
+            return false;
+        }
+
+        // Sleeps only while the counter still holds the value just read, so a wake between the load and the wait is not lost
+#if defined(SBX_SLAB_SHARED_MEMORY)
+        struct timespec timeout = {.tv_sec = 0, .tv_nsec = 100000000};
+        syscall(SYS_futex, (uint32_t*)word, FUTEX_WAIT, value, &timeout, NULL, 0);
+#else
+        thrd_yield();
+#endif
+    }
+}
+
+// Adds a migration to the queue of a slab, false when the queue is full
+static SBX_bool_t SBXSlabEnqueue(SBX_slab_queue_t* queue, uint32_t capacity, const SBX_slab_migration_t* migration) {
+    SBX_slab_migration_t* slots    = SBXSlabGetQueueSlots(queue);
+    uint32_t              position = atomic_load_explicit(&queue->enqueuePosition, memory_order_relaxed);
+    for(;;) {
+        SBX_slab_migration_t* slot     = &slots[position & (capacity - 1)];
+        uint32_t              sequence = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        int32_t               distance = (int32_t)(sequence - position);
+        if(distance == 0) {
+            if(atomic_compare_exchange_weak_explicit(&queue->enqueuePosition, &position, position + 1, memory_order_relaxed, memory_order_relaxed)) {
+                slot->tick   = migration->tick;
+                slot->sender = migration->sender;
+                slot->x      = migration->x;
+                slot->y      = migration->y;
+                slot->plock  = migration->plock;
+                atomic_store_explicit(&slot->sequence, position + 1, memory_order_release);
+                return true;
+            }
+        }
+        else if(distance < 0) {
+            return false;
+        }
+        else {
+            position = atomic_load_explicit(&queue->enqueuePosition, memory_order_relaxed);
+        }
+    }
+}
+
+// Takes the oldest migration out of the queue of the calling slab, false when the queue is empty
+static SBX_bool_t SBXSlabDequeue(SBX_slab_queue_t* queue, uint32_t capacity, SBX_slab_migration_t* migration) {
+    uint32_t              position = atomic_load_explicit(&queue->dequeuePosition, memory_order_relaxed);
+    SBX_slab_migration_t* slot     = &SBXSlabGetQueueSlots(queue)[position & (capacity - 1)];
+    if(atomic_load_explicit(&slot->sequence, memory_order_acquire) != position + 1) {
+        return false;
+    }
+    migration->tick   = slot->tick;
+    migration->sender = slot->sender;
+    migration->x      = slot->x;
+    migration->y      = slot->y;
+    migration->plock  = slot->plock;
+    atomic_store_explicit(&queue->dequeuePosition, position + 1, memory_order_relaxed);
+    atomic_store_explicit(&slot->sequence, position + capacity, memory_order_release);
+    return true;
+}
+
+// Copies lines of the box of a slab to or from a channel, halo lines are only written where they changed
+static void SBXSlabCopyLines(SBX_slab_t* slab, uint32_t firstLocalLine, SBX_plock_t* lines, uint32_t lineLength, SBX_bool_t toChannel) {
+    SBX_bool_t horizontal = slab->shared->axis == SBX_SLAB_AXIS_HORIZONTAL;
+    for(uint32_t line = 0; line < SBX_SLAB_HALO_DEPTH; line++) {
+        for(uint32_t i = 0; i < lineLength; i++) {
+            SBX_box_position_t x = (SBX_box_position_t)(horizontal ? i : firstLocalLine + line);
+            SBX_box_position_t y = (SBX_box_position_t)(horizontal ? firstLocalLine + line : i);
+            SBX_plock_t*       channelPlock = &lines[(size_t)line * lineLength + i];
+            SBX_plock_t        boxPlock;
+            SBXBoxGetPlock(slab->box, x, y, &boxPlock);
+            if(toChannel) {
+                *channelPlock = boxPlock;
+            }
+            else if((boxPlock.type != channelPlock->type) || (boxPlock.temperature != channelPlock->temperature)) {
+                SBXBoxSetPlock(slab->box, x, y, *channelPlock);
+            }
+        }
+    }
+}
+
+// Maps the shared memory of a group, creating it with the given size when create is set, or storing the size it has otherwise
+static SBX_slab_shared_t* SBXSlabMap(SBX_string_t name, SBX_bool_t create, size_t* size) {
+#if defined(SBX_SLAB_SHARED_MEMORY)
+    int descriptor = shm_open(name, create ? (O_RDWR | O_CREAT | O_EXCL) : O_RDWR, 0600);
+    if(descriptor < 0) {
+        return SBX_POINTER_UNSET;
+    }
+
+    struct stat status;
+    if(create ? (ftruncate(descriptor, (off_t)*size) != 0) : (fstat(descriptor, &status) != 0)) {
+        close(descriptor);
+        if(create) {
+            shm_unlink(name);
+        }
+        return SBX_POINTER_UNSET;
+    }
+    *size = create ? *size : (size_t)status.st_size;
+
+    void* mapping = *size >= sizeof(SBX_slab_shared_t) ? mmap(NULL, *size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0) : MAP_FAILED;
+    close(descriptor);
+    if(mapping == MAP_FAILED) {
+        if(create) {
+            shm_unlink(name);
+        }
+        return SBX_POINTER_UNSET;
+    }
+    return mapping;
+#else
+    (void)name;
+    (void)create;
+    (void)size;
+    return SBX_POINTER_UNSET;
+#endif
+}
+
+static void SBXSlabUnmap(SBX_slab_shared_t* shared, size_t size) {
+#if defined(SBX_SLAB_SHARED_MEMORY)
+    munmap(shared, size);
+#else
+    (void)shared;
+    (void)size;
+#endif
+}
+
+SBX_report_t SBXSlabGroupCreate(SBX_string_t name, SBX_slab_axis_t axis, SBX_box_dimensions_t width, SBX_box_dimensions_t height,
+                                uint16_t slabCount, uint32_t migrationCapacity) {
+    uint32_t lineCount = axis == SBX_SLAB_AXIS_HORIZONTAL ? height : width;
+
+    // Check if required arguments are provided, every slab needs enough lines to fill the halo of its neighbors
+    if((name == SBX_POINTER_UNSET) || (axis > SBX_SLAB_AXIS_VERTICAL) || (width == SBX_DIMENSION_UNSET) || (height == SBX_DIMENSION_UNSET) ||
+       !slabCount || (lineCount / slabCount < SBX_SLAB_HALO_DEPTH) || !migrationCapacity || (migrationCapacity > (UINT32_MAX >> 1) + 1)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+#if !defined(SBX_SLAB_SHARED_MEMORY)
+    // Return error
+    return (SBX_report_t){
+        .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+        .reportMessage = SBX_REPORT_STRING_SLAB_UNSUPPORTED
+    };
+#endif
+
+    // Queue positions are masked, so the capacity has to be a power of 2
+    uint32_t capacity = 1;
+    while(capacity < migrationCapacity) {
+        capacity <<= 1;
+    }
+
+    SBX_slab_layout_t  layout = SBXSlabGetLayout(axis, width, height, slabCount, capacity);
+    SBX_slab_shared_t* shared = SBXSlabMap(name, true, &layout.size);
+
+    // Check for a shared memory error
+    if(shared == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_IO_FAILURE
+        };
+    }
+
+    // New shared memory is zeroed, which already is the starting state of every channel and queue position
+    shared->axis              = axis;
+    shared->slabCount         = slabCount;
+    shared->width             = width;
+    shared->height            = height;
+    shared->migrationCapacity = capacity;
+    shared->size              = layout.size;
+    for(uint16_t s = 0; s < slabCount; s++) {
+        SBX_slab_migration_t* slots = SBXSlabGetQueueSlots(SBXSlabGetQueue(shared, &layout, s));
+        for(uint32_t i = 0; i < capacity; i++) {
+            atomic_init(&slots[i].sequence, i);
+        }
+    }
+
+    // The magic is written last, attaching processes only trust a group that has it
+    atomic_store_explicit(&shared->magic, SBX_SLAB_MAGIC, memory_order_release);
+    SBXSlabUnmap(shared, layout.size);
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_SLAB_GROUP_CREATE_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXSlabGroupDestroy(SBX_string_t name) {
+    // Check if required arguments are provided
+    if(name == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+#if defined(SBX_SLAB_SHARED_MEMORY)
+    // Check for a shared memory error
+    if(shm_unlink(name) != 0) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_IO_FAILURE
+        };
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_SLAB_GROUP_DESTROY_SUCCESSFUL
+    };
+#else
+    // Return error
+    return (SBX_report_t){
+        .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+        .reportMessage = SBX_REPORT_STRING_SLAB_UNSUPPORTED
+    };
+#endif
+}
+
+SBX_report_t SBXSlabAttach(SBX_slab_t** slab, SBX_string_t name, uint16_t index) {
+    // Check if required arguments are provided
+    if((slab == SBX_POINTER_UNSET) || (name == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+#if !defined(SBX_SLAB_SHARED_MEMORY)
+    // Return error
+    return (SBX_report_t){
+        .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+        .reportMessage = SBX_REPORT_STRING_SLAB_UNSUPPORTED
+    };
+#endif
+
+    size_t             size   = 0;
+    SBX_slab_shared_t* shared = SBXSlabMap(name, false, &size);
+
+    // Check for a shared memory error
+    if(shared == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_IO_FAILURE
+        };
+    }
+    // Check the group was fully laid out and matches its own header
+    if((atomic_load_explicit(&shared->magic, memory_order_acquire) != SBX_SLAB_MAGIC) || (shared->size != size) ||
+       (SBXSlabGetSharedLayout(shared).size != size)) {
+        SBXSlabUnmap(shared, size);
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_SLAB_INVALID_GROUP
+        };
+    }
+    // Check if the slab is in the group
+    if(index >= shared->slabCount) {
+        SBXSlabUnmap(shared, size);
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Allocate memory for the SBXSlab structure
+    *slab = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_SLAB, sizeof(SBX_slab_t));
+    SBX_slab_migration_t* pending = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_SLAB, shared->migrationCapacity * sizeof(SBX_slab_migration_t));
+
+    // Check for a memory allocation error
+    if(!*slab || !pending) {
+        // Free anything that was allocated before exiting
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_SLAB, *slab, sizeof(SBX_slab_t));
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_SLAB, pending, shared->migrationCapacity * sizeof(SBX_slab_migration_t));
+        SBXSlabUnmap(shared, shared->size);
+        *slab = SBX_POINTER_UNSET;
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    SBX_slab_layout_t layout = SBXSlabGetSharedLayout(shared);
+    **slab = (SBX_slab_t){
+        .shared       = shared,
+        .index        = index,
+        .box          = SBX_POINTER_UNSET,
+        .firstLine    = SBXSlabGetFirstLine(layout.lineCount, shared->slabCount, index),
+        .lastLine     = SBXSlabGetFirstLine(layout.lineCount, shared->slabCount, index + 1),
+        .haloBefore   = index > 0 ? SBX_SLAB_HALO_DEPTH : 0,
+        .haloAfter    = index + 1 < shared->slabCount ? SBX_SLAB_HALO_DEPTH : 0,
+        .tick         = 0,
+        .pending      = pending,
+        .pendingCount = 0
+    };
+
+    // The box holds the owned lines between the halos of both neighbors
+    uint32_t     lines  = (*slab)->lastLine - (*slab)->firstLine + (*slab)->haloBefore + (*slab)->haloAfter;
+    SBX_report_t report = SBXBoxCreate(&(*slab)->box);
+    if(!report.errorFlags) {
+        report = shared->axis == SBX_SLAB_AXIS_HORIZONTAL ? SBXBoxInit((*slab)->box, shared->width, (SBX_box_dimensions_t)lines) :
+                                                            SBXBoxInit((*slab)->box, (SBX_box_dimensions_t)lines, shared->height);
+        if(report.errorFlags) {
+            SBXBoxDestroy((*slab)->box);
+        }
+    }
+    if(report.errorFlags) {
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_SLAB, pending, shared->migrationCapacity * sizeof(SBX_slab_migration_t));
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_SLAB, *slab, sizeof(SBX_slab_t));
+        SBXSlabUnmap(shared, shared->size);
+        *slab = SBX_POINTER_UNSET;
+        return report;
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_SLAB_ATTACH_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXSlabDetach(SBX_slab_t* slab) {
+    // Check if required arguments are provided
+    if(slab == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    SBXBoxDeinit(slab->box);
+    SBXBoxDestroy(slab->box);
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_SLAB, slab->pending, slab->shared->migrationCapacity * sizeof(SBX_slab_migration_t));
+    SBXSlabUnmap(slab->shared, slab->shared->size);
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_SLAB, slab, sizeof(SBX_slab_t));
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_SLAB_DETACH_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXSlabGetLocalPosition(SBX_slab_t* slab, SBX_box_position_t worldX, SBX_box_position_t worldY, SBX_box_position_t* x, SBX_box_position_t* y) {
+    // Check if required arguments are provided
+    if((slab == SBX_POINTER_UNSET) || (x == SBX_POINTER_UNSET) || (y == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    SBX_bool_t horizontal = slab->shared->axis == SBX_SLAB_AXIS_HORIZONTAL;
+    uint32_t   line       = horizontal ? worldY : worldX;
+    uint32_t   across     = horizontal ? worldX : worldY;
+    // Check if the position is in the slab or its halo
+    if((line + slab->haloBefore < slab->firstLine) || (line >= slab->lastLine + slab->haloAfter) ||
+       (across >= (uint32_t)(horizontal ? slab->shared->width : slab->shared->height))) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_OUT_OF_BOUNDS,
+            .reportMessage = SBX_REPORT_STRING_BOX_OUT_OF_BOUNDS
+        };
+    }
+
+    SBX_box_position_t localLine = (SBX_box_position_t)(line + slab->haloBefore - slab->firstLine);
+    *x = horizontal ? worldX : localLine;
+    *y = horizontal ? localLine : worldY;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_SLAB_GET_LOCAL_POSITION_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXSlabSetPlock(SBX_slab_t* slab, SBX_box_position_t worldX, SBX_box_position_t worldY, SBX_plock_t plock) {
+    // Check if required arguments are provided
+    if(slab == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check if the position is in the world
+    if((worldX >= slab->shared->width) || (worldY >= slab->shared->height)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_OUT_OF_BOUNDS,
+            .reportMessage = SBX_REPORT_STRING_BOX_OUT_OF_BOUNDS
+        };
+    }
+
+    SBX_slab_layout_t layout = SBXSlabGetSharedLayout(slab->shared);
+    uint32_t          line   = slab->shared->axis == SBX_SLAB_AXIS_HORIZONTAL ? worldY : worldX;
+
+    // Owned positions are written now, halo positions belong to a neighbor and go through its queue like any other
+    if((line >= slab->firstLine) && (line < slab->lastLine)) {
+        SBX_box_position_t x, y;
+        SBXSlabGetLocalPosition(slab, worldX, worldY, &x, &y);
+        SBX_report_t report = SBXBoxSetPlock(slab->box, x, y, plock);
+        if(report.errorFlags) {
+            return report;
+        }
+    }
+    else {
+        // A slab d slabs away has surely drained everything sent before this tick once it took d more steps, since every step waits on the neighbors
+        uint16_t             owner     = SBXSlabGetOwner(layout.lineCount, slab->shared->slabCount, line);
+        SBX_slab_migration_t migration = {
+            .tick   = slab->tick + (uint32_t)(owner > slab->index ? owner - slab->index : slab->index - owner),
+            .sender = slab->index,
+            .x      = worldX,
+            .y      = worldY,
+            .plock  = plock
+        };
+        // Check for a full migration queue
+        if(!SBXSlabEnqueue(SBXSlabGetQueue(slab->shared, &layout, owner), slab->shared->migrationCapacity, &migration)) {
+            // Return error
+            return (SBX_report_t){
+                .errorFlags    = SBX_SLAB_ERROR_MIGRATION_FULL,
+                .reportMessage = SBX_REPORT_STRING_SLAB_MIGRATION_FULL
+            };
+        }
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_SLAB_SET_PLOCK_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXSlabStep(SBX_slab_t* slab) {
+    // Check if required arguments are provided
+    if(slab == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    SBX_slab_shared_t* shared     = slab->shared;
+    SBX_slab_layout_t  layout     = SBXSlabGetSharedLayout(shared);
+    uint32_t           ownedLines = slab->lastLine - slab->firstLine;
+    SBX_bool_t         hasNeighbor[2] = {slab->haloBefore != 0, slab->haloAfter != 0};
+
+    // Migrations due this tick land before the border lines are sent, so both sides of a border see them on the same tick
+    SBX_report_t report = {
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_SLAB_STEP_SUCCESSFUL
+    };
+    uint32_t applied = 0;
+    while((applied < slab->pendingCount) && SBXSlabReached(slab->tick, slab->pending[applied].tick)) {
+        SBX_box_position_t x, y;
+        SBXSlabGetLocalPosition(slab, slab->pending[applied].x, slab->pending[applied].y, &x, &y);
+        SBX_report_t setReport = SBXBoxSetPlock(slab->box, x, y, slab->pending[applied].plock);
+        report = report.errorFlags ? report : setReport;
+        applied++;
+    }
+    memmove(slab->pending, slab->pending + applied, (slab->pendingCount - applied) * sizeof(SBX_slab_migration_t));
+    slab->pendingCount -= applied;
+
+    // Send both borders before waiting on either neighbor, so neighbors waiting on each other never deadlock
+    for(uint32_t direction = 0; direction < 2; direction++) {
+        if(!hasNeighbor[direction]) {
+            continue;
+        }
+        SBX_slab_channel_t* channel = SBXSlabGetChannel(shared, &layout, slab->index, direction);
+        // Check the slot being overwritten was read by the neighbor
+        if(!SBXSlabWaitFor(&channel->consumed, slab->tick + 1 - SBX_SLAB_HALO_SLOTS)) {
+            // Return error
+            return (SBX_report_t){
+                .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+                .reportMessage = SBX_REPORT_STRING_SLAB_TIMEOUT
+            };
+        }
+        uint32_t firstLocalLine = direction == 0 ? slab->haloBefore : slab->haloBefore + ownedLines - SBX_SLAB_HALO_DEPTH;
+        SBXSlabCopyLines(slab, firstLocalLine, SBXSlabGetChannelLines(channel, &layout, slab->tick), layout.lineLength, true);
+        atomic_store_explicit(&channel->published, slab->tick + 1, memory_order_release);
+        SBXSlabWake(&channel->published);
+    }
+
+    // Copy the borders of the neighbors into the halo, the slab before sends through its channel after it and the other way round
+    for(uint32_t direction = 0; direction < 2; direction++) {
+        if(!hasNeighbor[direction]) {
+            continue;
+        }
+        uint16_t            neighbor = direction == 0 ? slab->index - 1 : slab->index + 1;
+        SBX_slab_channel_t* channel  = SBXSlabGetChannel(shared, &layout, neighbor, 1 - direction);
+        // Check the neighbor sent this tick
+        if(!SBXSlabWaitFor(&channel->published, slab->tick + 1)) {
+            // Return error
+            return (SBX_report_t){
+                .errorFlags    = SBX_COMMON_ERROR_IO_FAILURE,
+                .reportMessage = SBX_REPORT_STRING_SLAB_TIMEOUT
+            };
+        }
+        uint32_t firstLocalLine = direction == 0 ? 0 : slab->haloBefore + ownedLines;
+        SBXSlabCopyLines(slab, firstLocalLine, SBXSlabGetChannelLines(channel, &layout, slab->tick), layout.lineLength, false);
+        atomic_store_explicit(&channel->consumed, slab->tick + 1, memory_order_release);
+        SBXSlabWake(&channel->consumed);
+    }
+
+    // Neighbors queue their migrations before sending this tick, so waiting on their borders makes them visible here
+    SBX_slab_queue_t* queue = SBXSlabGetQueue(shared, &layout, slab->index);
+    SBX_slab_migration_t migration;
+    while((slab->pendingCount < shared->migrationCapacity) && SBXSlabDequeue(queue, shared->migrationCapacity, &migration)) {
+        // Keep the pending migrations ordered by tick and sender, arrival order between senders depends on scheduling
+        uint32_t i = slab->pendingCount;
+        while((i > 0) && SBXSlabPrecedes(&migration, &slab->pending[i - 1])) {
+            slab->pending[i] = slab->pending[i - 1];
+            i--;
+        }
+        slab->pending[i] = migration;
+        slab->pendingCount++;
+    }
+
+    SBX_report_t stepReport = SBXBoxStep(slab->box);
+    slab->tick++;
+
+    if(report.errorFlags) {
+        return report;
+    }
+    if(stepReport.errorFlags) {
+        return stepReport;
+    }
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_SLAB_STEP_SUCCESSFUL
+    };
+}
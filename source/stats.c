@@ -0,0 +1,180 @@
+// Project headers
+#include <SBX/stats.h>
+#include <SBX/strings.h>
+#include <SBX/chunk.h>
+
+// LibC headers
+#include <string.h>
+#include <threads.h>
+
+// Work given to one recount thread, a range of the chunk table and the stats of that range
+typedef struct SBXBoxStatsRecountJob {
+    SBX_box_t*        box;
+    SBX_chunk_index_t firstChunk;
+    SBX_chunk_index_t lastChunk;
+    SBX_box_stats_t   stats;
+} SBX_box_stats_recount_job_t;
+
+// Sets stats to the values of a box without any plocks
+static void SBXBoxStatsClear(SBX_box_stats_t* stats) {
+    memset(stats->plockTypeCounts, 0, sizeof(stats->plockTypeCounts));
+    stats->plockCount         = 0;
+    stats->thermalEnergy      = 0.0L;
+    stats->minimumTemperature = SBX_TEMPERATURE_UNSET;
+    stats->maximumTemperature = SBX_TEMPERATURE_UNSET;
+    stats->activeChunkCount   = 0;
+}
+
+// Widens the temperature extremes of stats holding plockCount plocks to include another range
+static void SBXBoxStatsMergeExtremes(SBX_box_stats_t* stats, SBX_plock_temperature_t minimum, SBX_plock_temperature_t maximum) {
+    if(!stats->plockCount || minimum < stats->minimumTemperature) {
+        stats->minimumTemperature = minimum;
+    }
+    if(!stats->plockCount || maximum > stats->maximumTemperature) {
+        stats->maximumTemperature = maximum;
+    }
+}
+
+// Recount thread entry, scans every plock in a range of the chunk table
+static int SBXBoxStatsRecountThread(void* argument) {
+    SBX_box_stats_recount_job_t* job = argument;
+    SBXBoxStatsClear(&job->stats);
+
+    for(SBX_chunk_index_t i = job->firstChunk; i < job->lastChunk; i++) {
+        SBX_chunk_data_t* data = job->box->chunks[i].data;
+        if(data == SBX_POINTER_UNSET) {
+            continue;
+        }
+
+        SBX_plock_count_t chunkPlockCount = 0;
+        for(SBX_plock_count_t j = 0; j < data->plockArray.count; j++) {
+            SBX_plock_t* plock = &data->plockArray.plocks[j];
+            if(plock->type == SBX_PLOCK_TYPE_ID_UNSET) {
+                continue;
+            }
+
+            SBXBoxStatsMergeExtremes(&job->stats, plock->temperature, plock->temperature);
+            job->stats.plockTypeCounts[plock->type]++;
+            job->stats.thermalEnergy += plock->temperature;
+            job->stats.plockCount++;
+            chunkPlockCount++;
+        }
+        job->stats.activeChunkCount += chunkPlockCount != 0;
+    }
+
+    return 0;
+}
+
+SBX_report_t SBXBoxGetStats(SBX_box_t* box, SBX_box_stats_t* stats) {
+    // Check if required arguments are provided
+    if((box == SBX_POINTER_UNSET) || (stats == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for box initialized
+    if(!box->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_NOT_INIT,
+            .reportMessage = SBX_REPORT_STRING_BOX_NOT_INIT
+        };
+    }
+
+    SBXBoxStatsClear(stats);
+    memcpy(stats->plockTypeCounts, box->plockTypeCounts, sizeof(stats->plockTypeCounts));
+
+    // Sum up the chunk counters
+    for(SBX_chunk_index_t i = 0; i < (SBX_chunk_index_t)box->chunkColumns * box->chunkRows; i++) {
+        SBX_chunk_data_t* data = box->chunks[i].data;
+        if((data == SBX_POINTER_UNSET) || !data->plockCount) {
+            continue;
+        }
+
+        // The chunk extremes are kept exact by every plock write, so shared chunks are only read
+        SBX_plock_temperature_t minimum, maximum;
+        SBXChunkDataGetExtremes(data, &minimum, &maximum);
+
+        SBXBoxStatsMergeExtremes(stats, minimum, maximum);
+        stats->thermalEnergy += data->thermalEnergy;
+        stats->plockCount    += data->plockCount;
+        stats->activeChunkCount++;
+    }
+
+    // Positions without a plock count as unset plocks
+    stats->plockTypeCounts[SBX_PLOCK_TYPE_ID_UNSET] = (SBX_plock_count_t)box->width * box->height - stats->plockCount;
+
+    // Return success
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_GET_STATS_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxRecountStats(SBX_box_t* box, SBX_box_stats_t* stats) {
+    // Check if required arguments are provided
+    if((box == SBX_POINTER_UNSET) || (stats == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for box initialized
+    if(!box->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_NOT_INIT,
+            .reportMessage = SBX_REPORT_STRING_BOX_NOT_INIT
+        };
+    }
+
+    // Split the chunk table into even ranges, one per thread
+    SBX_chunk_index_t chunkCount = (SBX_chunk_index_t)box->chunkColumns * box->chunkRows;
+    SBX_box_stats_recount_job_t jobs[SBX_BOX_STATS_RECOUNT_THREAD_COUNT];
+    thrd_t threads[SBX_BOX_STATS_RECOUNT_THREAD_COUNT];
+    SBX_bool_t started[SBX_BOX_STATS_RECOUNT_THREAD_COUNT];
+    for(uint32_t i = 0; i < SBX_BOX_STATS_RECOUNT_THREAD_COUNT; i++) {
+        jobs[i] = (SBX_box_stats_recount_job_t){
+            .box        = box,
+            .firstChunk = (SBX_chunk_index_t)((uint64_t)chunkCount * i / SBX_BOX_STATS_RECOUNT_THREAD_COUNT),
+            .lastChunk  = (SBX_chunk_index_t)((uint64_t)chunkCount * (i + 1) / SBX_BOX_STATS_RECOUNT_THREAD_COUNT)
+        };
+
+        // The first range runs on this thread, and any range whose thread fails to start does too
+        started[i] = i && thrd_create(&threads[i], SBXBoxStatsRecountThread, &jobs[i]) == thrd_success;
+        if(!started[i]) {
+            SBXBoxStatsRecountThread(&jobs[i]);
+        }
+    }
+
+    // Merge the ranges
+    SBXBoxStatsClear(stats);
+    for(uint32_t i = 0; i < SBX_BOX_STATS_RECOUNT_THREAD_COUNT; i++) {
+        if(started[i]) {
+            thrd_join(threads[i], NULL);
+        }
+        if(!jobs[i].stats.plockCount) {
+            continue;
+        }
+
+        SBXBoxStatsMergeExtremes(stats, jobs[i].stats.minimumTemperature, jobs[i].stats.maximumTemperature);
+        for(uint32_t j = 0; j < SBX_PLOCK_TYPE_COUNT; j++) {
+            stats->plockTypeCounts[j] += jobs[i].stats.plockTypeCounts[j];
+        }
+        stats->thermalEnergy    += jobs[i].stats.thermalEnergy;
+        stats->plockCount       += jobs[i].stats.plockCount;
+        stats->activeChunkCount += jobs[i].stats.activeChunkCount;
+    }
+
+    // Positions without a plock count as unset plocks
+    stats->plockTypeCounts[SBX_PLOCK_TYPE_ID_UNSET] = (SBX_plock_count_t)box->width * box->height - stats->plockCount;
+
+    // Return success
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_RECOUNT_STATS_SUCCESSFUL
+    };
+}
@@ -0,0 +1,59 @@
+// Project headers
+#include <SBX/step.h>
+#include <SBX/strings.h>
+#include <SBX/command.h>
+#include <SBX/changes.h>
+#include <SBX/thermal.h>
+#include <SBX/workers.h>
+
+// LibC headers
+#include <stddef.h>
+
+SBX_report_t SBXBoxStep(SBX_box_t* box) {
+    // Check if required arguments are provided
+    if(box == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for box initialized
+    if(!box->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_NOT_INIT,
+            .reportMessage = SBX_REPORT_STRING_BOX_NOT_INIT
+        };
+    }
+
+    // Apply edits at the tick boundary, a failed command doesn't stop the tick
+    SBX_report_t report = SBXBoxApplyCommands(box);
+
+    // Storage the edits created was first touched on this thread, move it to the node of its home worker before the workers read it
+    if(box->workers != SBX_POINTER_UNSET) {
+        SBX_report_t placeReport = SBXWorkersPlace(box->workers, box);
+        if(!report.errorFlags) {
+            report = placeReport;
+        }
+    }
+
+    // Diffuse temperatures, including the ones just edited
+    SBX_report_t thermalReport = SBXBoxThermalStep(box);
+    if(!report.errorFlags) {
+        report = thermalReport;
+    }
+
+    box->tick++;
+
+    // Deliver everything that changed this tick
+    SBXBoxNotifyChanges(box);
+
+    if(report.errorFlags) {
+        return report;
+    }
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_STEP_SUCCESSFUL
+    };
+}
@@ -0,0 +1,581 @@
+// Project headers
+#include <SBX/thermal.h>
+#include <SBX/strings.h>
+#include <SBX/box.h>
+#include <SBX/lod.h>
+#include <SBX/workers.h>
+
+// LibC headers
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Chunk flags
+#define SBX_BOX_THERMAL_CHUNK_ACTIVE   (1 << 0)
+#define SBX_BOX_THERMAL_CHUNK_WORKING  (1 << 1)
+#define SBX_BOX_THERMAL_CHUNK_DEFERRED (1 << 2)
+
+// Frees the per chunk buffers
+static void SBXBoxThermalFreeChunks(SBX_box_thermal_t* thermal) {
+    SBXAllocatorFree(thermal->allocator, SBX_MEMORY_SUBSYSTEM_THERMAL, thermal->chunkFlags, sizeof(uint8_t) * thermal->chunkCapacity);
+    SBXAllocatorFree(thermal->allocator, SBX_MEMORY_SUBSYSTEM_THERMAL, thermal->activeChunks, sizeof(SBX_chunk_index_t) * thermal->chunkCapacity);
+    SBXAllocatorFree(thermal->allocator, SBX_MEMORY_SUBSYSTEM_THERMAL, thermal->workingChunks, sizeof(SBX_chunk_index_t) * thermal->chunkCapacity);
+    SBXAllocatorFree(thermal->allocator, SBX_MEMORY_SUBSYSTEM_THERMAL, thermal->owedTicks, sizeof(uint32_t) * thermal->chunkCapacity);
+    thermal->chunkFlags       = SBX_POINTER_UNSET;
+    thermal->activeChunks     = SBX_POINTER_UNSET;
+    thermal->workingChunks    = SBX_POINTER_UNSET;
+    thermal->owedTicks        = SBX_POINTER_UNSET;
+    thermal->activeChunkCount = 0;
+    thermal->chunkCapacity    = 0;
+}
+
+// Makes sure the per chunk buffers cover the chunk table, growing them drops the active set so the next pass diffuses every chunk
+static SBX_bool_t SBXBoxThermalReserve(SBX_box_t* box) {
+    SBX_box_thermal_t* thermal = &box->thermal;
+
+    SBX_chunk_index_t chunkCount = (SBX_chunk_index_t)box->chunkColumns * box->chunkRows;
+    if(thermal->chunkCapacity >= chunkCount) {
+        return true;
+    }
+
+    // Allocate every buffer before replacing any so they always share one capacity
+    uint8_t*           chunkFlags    = SBXAllocatorAllocate(thermal->allocator, SBX_MEMORY_SUBSYSTEM_THERMAL, sizeof(uint8_t) * chunkCount);
+    SBX_chunk_index_t* activeChunks  = SBXAllocatorAllocate(thermal->allocator, SBX_MEMORY_SUBSYSTEM_THERMAL, sizeof(SBX_chunk_index_t) * chunkCount);
+    SBX_chunk_index_t* workingChunks = SBXAllocatorAllocate(thermal->allocator, SBX_MEMORY_SUBSYSTEM_THERMAL, sizeof(SBX_chunk_index_t) * chunkCount);
+    uint32_t*          owedTicks     = SBXAllocatorAllocate(thermal->allocator, SBX_MEMORY_SUBSYSTEM_THERMAL, sizeof(uint32_t) * chunkCount);
+    if(!chunkFlags || !activeChunks || !workingChunks || !owedTicks) {
+        SBXAllocatorFree(thermal->allocator, SBX_MEMORY_SUBSYSTEM_THERMAL, chunkFlags, sizeof(uint8_t) * chunkCount);
+        SBXAllocatorFree(thermal->allocator, SBX_MEMORY_SUBSYSTEM_THERMAL, activeChunks, sizeof(SBX_chunk_index_t) * chunkCount);
+        SBXAllocatorFree(thermal->allocator, SBX_MEMORY_SUBSYSTEM_THERMAL, workingChunks, sizeof(SBX_chunk_index_t) * chunkCount);
+        SBXAllocatorFree(thermal->allocator, SBX_MEMORY_SUBSYSTEM_THERMAL, owedTicks, sizeof(uint32_t) * chunkCount);
+        return false;
+    }
+
+    thermal->saturated |= thermal->activeChunkCount != 0;
+    SBXBoxThermalFreeChunks(thermal);
+    memset(chunkFlags, 0, sizeof(uint8_t) * chunkCount);
+    memset(owedTicks, 0, sizeof(uint32_t) * chunkCount);
+    thermal->chunkFlags    = chunkFlags;
+    thermal->activeChunks  = activeChunks;
+    thermal->workingChunks = workingChunks;
+    thermal->owedTicks     = owedTicks;
+    thermal->chunkCapacity = chunkCount;
+
+    return true;
+}
+
+// Adds a chunk holding set plocks to the working set of a pass once, or to the deferred chunks at the back of the same array if the level of detail policy skips it this tick
+static void SBXBoxThermalAddWorking(SBX_box_t* box, SBX_chunk_index_t chunkIndex, SBX_chunk_index_t* workingCount, SBX_chunk_index_t* deferredCount) {
+    SBX_box_thermal_t* thermal = &box->thermal;
+    if((box->chunks[chunkIndex].data == SBX_POINTER_UNSET) ||
+       (thermal->chunkFlags[chunkIndex] & (SBX_BOX_THERMAL_CHUNK_WORKING | SBX_BOX_THERMAL_CHUNK_DEFERRED))) {
+        return;
+    }
+
+    if(!SBXBoxLODIsChunkDue(box, chunkIndex)) {
+        thermal->chunkFlags[chunkIndex] |= SBX_BOX_THERMAL_CHUNK_DEFERRED;
+        thermal->workingChunks[thermal->chunkCapacity - ++(*deferredCount)] = chunkIndex;
+        return;
+    }
+
+    thermal->chunkFlags[chunkIndex] |= SBX_BOX_THERMAL_CHUNK_WORKING;
+    thermal->workingChunks[(*workingCount)++] = chunkIndex;
+}
+
+// Gets the diffusivity of a neighbor pair whose chunks missed owedTicks passes, scaled up to catch up and clamped to stay stable
+static SBX_plock_temperature_t SBXBoxThermalCatchUpDiffusivity(SBX_box_thermal_t* thermal, uint32_t owedTicks) {
+    SBX_plock_temperature_t diffusivity = thermal->diffusivity * ((SBX_plock_temperature_t)owedTicks + 1.0L);
+    return diffusivity < SBX_BOX_THERMAL_MAXIMUM_DIFFUSIVITY ? diffusivity : SBX_BOX_THERMAL_MAXIMUM_DIFFUSIVITY;
+}
+
+// Works out the temperature change of a position of a working chunk from its ghost plane, with the weights of the neighbors in every direction
+static inline SBX_plock_temperature_t SBXBoxThermalDelta(SBX_ghost_plane_t* plane, uint32_t index, SBX_plock_temperature_t epsilon, SBX_plock_temperature_t diffusivity,
+                                                         const SBX_plock_temperature_t flowWeights[SBX_GHOST_SIDE_COUNT],
+                                                         const SBX_plock_temperature_t catchUpWeights[SBX_GHOST_SIDE_COUNT]) {
+    static const int32_t neighborOffsets[SBX_GHOST_SIDE_COUNT] = {-1, 1, -SBX_GHOST_PLANE_SIZE, SBX_GHOST_PLANE_SIZE};
+    SBX_plock_temperature_t temperature = plane->temperatures[index];
+    SBX_plock_temperature_t flow = 0.0L, catchUp = 0.0L;
+    for(uint32_t k = 0; k < SBX_GHOST_SIDE_COUNT; k++) {
+        uint32_t neighbor = index + (uint32_t)neighborOffsets[k];
+        if(plane->types[neighbor] == SBX_PLOCK_TYPE_ID_UNSET) {
+            continue;
+        }
+
+        SBX_plock_temperature_t difference = plane->temperatures[neighbor] - temperature;
+        if(fabsl(difference) > epsilon) {
+            flow    += difference * flowWeights[k];
+            catchUp += difference * catchUpWeights[k];
+        }
+    }
+    return flow * diffusivity + catchUp;
+}
+
+// Works out the temperature change of every position of a working chunk, only reads plocks and only writes the scratch space of that chunk.
+// Heat flows along each neighbor pair in both directions by the same amount, which keeps the thermal energy of the box.
+// Pairs reaching into a deferred chunk wait for it, pairs of chunks that missed passes catch up with the larger debt of the two.
+// Every neighbor is read from the ghost plane of the chunk, so there are no bounds checks, chunk lookups, or matrix layouts in the loop,
+// and the neighbors on the edge of the chunk get the weights of the chunk or boundary on their side rather than being looked up one by one
+static void SBXBoxThermalDeltas(SBX_box_t* box, SBX_chunk_index_t i) {
+    SBX_box_thermal_t*       thermal    = &box->thermal;
+    SBX_chunk_index_t        chunkIndex = thermal->workingChunks[i];
+    SBX_ghost_plane_t*       plane      = &thermal->scratch[i].plane;
+    SBX_plock_temperature_t* deltas     = thermal->scratch[i].deltas;
+    uint32_t owedTicks = thermal->owedTicks[chunkIndex];
+    SBX_plock_temperature_t diffusivity = SBXBoxThermalCatchUpDiffusivity(thermal, owedTicks);
+    SBXGhostPlaneRefresh(plane, box, chunkIndex);
+
+    // Neighbors in the chunk, in chunks owing no more passes, and in the boundary flow at the diffusivity of this chunk, the rest catch up
+    SBX_plock_temperature_t sideFlowWeights[SBX_GHOST_SIDE_COUNT], sideCatchUpWeights[SBX_GHOST_SIDE_COUNT];
+    for(uint32_t k = 0; k < SBX_GHOST_SIDE_COUNT; k++) {
+        SBX_chunk_index_t sideChunk = plane->sideChunks[k];
+        sideFlowWeights[k]    = 0.0L;
+        sideCatchUpWeights[k] = 0.0L;
+        if((sideChunk == SBX_GHOST_CHUNK_BOUNDARY) || (thermal->owedTicks[sideChunk] <= owedTicks)) {
+            sideFlowWeights[k] = 1.0L;
+        } else {
+            sideCatchUpWeights[k] = SBXBoxThermalCatchUpDiffusivity(thermal, thermal->owedTicks[sideChunk]);
+        }
+        // Deferred neighbors wait for their own pass
+        if((sideChunk != SBX_GHOST_CHUNK_BOUNDARY) && (thermal->chunkFlags[sideChunk] & SBX_BOX_THERMAL_CHUNK_DEFERRED)) {
+            sideFlowWeights[k]    = 0.0L;
+            sideCatchUpWeights[k] = 0.0L;
+        }
+    }
+
+    // Positions of an edge chunk past the box read as the boundary, only the ones in the box change
+    uint32_t columnCount = (uint32_t)box->width - (chunkIndex % box->chunkColumns) * SBX_CHUNK_SIZE;
+    uint32_t rowCount    = (uint32_t)box->height - (chunkIndex / box->chunkColumns) * SBX_CHUNK_SIZE;
+    columnCount = columnCount < SBX_CHUNK_SIZE ? columnCount : SBX_CHUNK_SIZE;
+    rowCount    = rowCount < SBX_CHUNK_SIZE ? rowCount : SBX_CHUNK_SIZE;
+    memset(deltas, 0, sizeof(thermal->scratch[i].deltas));
+
+    SBX_plock_temperature_t epsilon = thermal->epsilon;
+    static const SBX_plock_temperature_t interiorFlowWeights[SBX_GHOST_SIDE_COUNT] = {1.0L, 1.0L, 1.0L, 1.0L}, interiorCatchUpWeights[SBX_GHOST_SIDE_COUNT] = {0.0L};
+    for(uint32_t y = 0; y < rowCount; y++) {
+        for(uint32_t x = 0; x < columnCount; x++) {
+            uint32_t index = SBX_GHOST_PLANE_INDEX(x, y);
+            if(plane->types[index] == SBX_PLOCK_TYPE_ID_UNSET) {
+                continue;
+            }
+
+            // Only positions on the edge of the chunk have neighbors in the ring
+            if((x == 0) | (y == 0) | (x == SBX_CHUNK_SIZE - 1) | (y == SBX_CHUNK_SIZE - 1)) {
+                SBX_plock_temperature_t flowWeights[SBX_GHOST_SIDE_COUNT], catchUpWeights[SBX_GHOST_SIDE_COUNT];
+                SBX_bool_t ring[SBX_GHOST_SIDE_COUNT] = {x == 0, x == SBX_CHUNK_SIZE - 1, y == 0, y == SBX_CHUNK_SIZE - 1};
+                for(uint32_t k = 0; k < SBX_GHOST_SIDE_COUNT; k++) {
+                    flowWeights[k]    = ring[k] ? sideFlowWeights[k] : 1.0L;
+                    catchUpWeights[k] = ring[k] ? sideCatchUpWeights[k] : 0.0L;
+                }
+                deltas[y * SBX_CHUNK_SIZE + x] = SBXBoxThermalDelta(plane, index, epsilon, diffusivity, flowWeights, catchUpWeights);
+            } else {
+                deltas[y * SBX_CHUNK_SIZE + x] = SBXBoxThermalDelta(plane, index, epsilon, diffusivity, interiorFlowWeights, interiorCatchUpWeights);
+            }
+        }
+    }
+}
+
+// Worker pool job computing the changes of one working chunk
+static void SBXBoxThermalDeltasJob(void* userData, uint32_t item, uint32_t worker) {
+    (void)worker;
+    SBXBoxThermalDeltas(userData, item);
+}
+
+SBX_report_t SBXBoxThermalInit(SBX_box_thermal_t* thermal, SBX_allocator_t* allocator) {
+    // Check if required arguments are provided
+    if(thermal == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    *thermal = (SBX_box_thermal_t){
+        .allocator          = allocator,
+        .mode               = SBX_BOX_THERMAL_MODE_SPARSE,
+        .diffusivity        = SBX_BOX_THERMAL_DEFAULT_DIFFUSIVITY,
+        .epsilon            = SBX_BOX_THERMAL_DEFAULT_EPSILON,
+        .chunkFlags         = SBX_POINTER_UNSET,
+        .activeChunks       = SBX_POINTER_UNSET,
+        .workingChunks      = SBX_POINTER_UNSET,
+        .activeChunkCount   = 0,
+        .chunkCapacity      = 0,
+        .saturated          = false,
+        .workingChunkCount  = 0,
+        .deferredChunkCount = 0,
+        .scratch            = SBX_POINTER_UNSET,
+        .scratchCapacity    = 0
+    };
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_THERMAL_INIT_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxThermalDeinit(SBX_box_thermal_t* thermal) {
+    // Check if required arguments are provided
+    if(thermal == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    SBXBoxThermalFreeChunks(thermal);
+    SBXAllocatorFree(thermal->allocator, SBX_MEMORY_SUBSYSTEM_THERMAL, thermal->scratch, sizeof(SBX_box_thermal_chunk_t) * thermal->scratchCapacity);
+    thermal->scratch         = SBX_POINTER_UNSET;
+    thermal->scratchCapacity = 0;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_THERMAL_DEINIT_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxSetThermal(SBX_box_t* box, SBX_box_thermal_mode_t mode, SBX_plock_temperature_t diffusivity, SBX_plock_temperature_t epsilon) {
+    // Check if required arguments are provided
+    if((box == SBX_POINTER_UNSET) || (mode > SBX_BOX_THERMAL_MODE_SPARSE) ||
+       !(diffusivity > 0.0L) || (diffusivity > SBX_BOX_THERMAL_MAXIMUM_DIFFUSIVITY) || !(epsilon >= 0.0L)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // The active set only holds what changed under the old settings, start over from every chunk
+    box->thermal.mode        = mode;
+    box->thermal.diffusivity = diffusivity;
+    box->thermal.epsilon     = epsilon;
+    SBXBoxThermalActivateAll(box);
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_SET_THERMAL_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxGetThermalActiveChunkCount(SBX_box_t* box, SBX_chunk_index_t* count) {
+    // Check if required arguments are provided
+    if((box == SBX_POINTER_UNSET) || (count == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    *count = box->thermal.activeChunkCount;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_GET_THERMAL_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxThermalActivate(SBX_box_t* box, SBX_chunk_index_t chunkIndex) {
+    // Check if required arguments are provided
+    if(box == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Nothing to keep track of without diffusion, or when the next pass diffuses everything anyway
+    SBX_box_thermal_t* thermal = &box->thermal;
+    if((thermal->mode == SBX_BOX_THERMAL_MODE_OFF) || thermal->saturated) {
+        return (SBX_report_t){
+            .errorFlags    = 0,
+            .reportMessage = SBX_REPORT_STRING_BOX_THERMAL_ACTIVATE_SUCCESSFUL
+        };
+    }
+
+    // Fall back to diffusing every chunk if the buffers can't cover the chunk table
+    if(!SBXBoxThermalReserve(box)) {
+        thermal->saturated = true;
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    if(!thermal->saturated && !(thermal->chunkFlags[chunkIndex] & SBX_BOX_THERMAL_CHUNK_ACTIVE)) {
+        thermal->chunkFlags[chunkIndex] |= SBX_BOX_THERMAL_CHUNK_ACTIVE;
+        thermal->activeChunks[thermal->activeChunkCount++] = chunkIndex;
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_THERMAL_ACTIVATE_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxThermalActivateAll(SBX_box_t* box) {
+    // Check if required arguments are provided
+    if(box == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Indices of the old active set may not mean anything anymore
+    SBX_box_thermal_t* thermal = &box->thermal;
+    if(thermal->chunkCapacity) {
+        memset(thermal->chunkFlags, 0, sizeof(uint8_t) * thermal->chunkCapacity);
+        memset(thermal->owedTicks, 0, sizeof(uint32_t) * thermal->chunkCapacity);
+    }
+    thermal->activeChunkCount = 0;
+    thermal->saturated        = false;
+
+    for(SBX_chunk_index_t i = 0; i < (SBX_chunk_index_t)box->chunkColumns * box->chunkRows; i++) {
+        if(box->chunks[i].data != SBX_POINTER_UNSET) {
+            SBXBoxThermalActivate(box, i);
+        }
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_THERMAL_ACTIVATE_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxThermalBegin(SBX_box_t* box, SBX_chunk_index_t* workingCount) {
+    // Check if required arguments are provided
+    if((box == SBX_POINTER_UNSET) || (workingCount == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for box initialized
+    if(!box->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_NOT_INIT,
+            .reportMessage = SBX_REPORT_STRING_BOX_NOT_INIT
+        };
+    }
+
+    SBX_box_thermal_t* thermal = &box->thermal;
+    thermal->workingChunkCount  = 0;
+    thermal->deferredChunkCount = 0;
+    *workingCount               = 0;
+    if(thermal->mode == SBX_BOX_THERMAL_MODE_OFF) {
+        return (SBX_report_t){
+            .errorFlags    = 0,
+            .reportMessage = SBX_REPORT_STRING_BOX_THERMAL_BEGIN_SUCCESSFUL
+        };
+    }
+    if(!SBXBoxThermalReserve(box)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    // Pick the chunks to diffuse, a chunk no write touched and whose neighbors no write touched has the same temperatures as when it last settled
+    SBX_chunk_index_t workingChunkCount = 0, deferredCount = 0;
+    if((thermal->mode == SBX_BOX_THERMAL_MODE_DENSE) || thermal->saturated) {
+        for(SBX_chunk_index_t i = 0; i < (SBX_chunk_index_t)box->chunkColumns * box->chunkRows; i++) {
+            SBXBoxThermalAddWorking(box, i, &workingChunkCount, &deferredCount);
+        }
+    } else {
+        for(SBX_chunk_index_t i = 0; i < thermal->activeChunkCount; i++) {
+            SBX_chunk_index_t chunkIndex = thermal->activeChunks[i];
+            SBX_chunk_dimensions_t chunkX = chunkIndex % box->chunkColumns, chunkY = chunkIndex / box->chunkColumns;
+            SBXBoxThermalAddWorking(box, chunkIndex, &workingChunkCount, &deferredCount);
+            if(chunkX > 0) {
+                SBXBoxThermalAddWorking(box, chunkIndex - 1, &workingChunkCount, &deferredCount);
+            }
+            if(chunkX + 1 < box->chunkColumns) {
+                SBXBoxThermalAddWorking(box, chunkIndex + 1, &workingChunkCount, &deferredCount);
+            }
+            if(chunkY > 0) {
+                SBXBoxThermalAddWorking(box, chunkIndex - box->chunkColumns, &workingChunkCount, &deferredCount);
+            }
+            if(chunkY + 1 < box->chunkRows) {
+                SBXBoxThermalAddWorking(box, chunkIndex + box->chunkColumns, &workingChunkCount, &deferredCount);
+            }
+        }
+    }
+
+    // The writes of this pass build the active set of the next one
+    for(SBX_chunk_index_t i = 0; i < thermal->activeChunkCount; i++) {
+        thermal->chunkFlags[thermal->activeChunks[i]] &= (uint8_t)~SBX_BOX_THERMAL_CHUNK_ACTIVE;
+    }
+    thermal->activeChunkCount = 0;
+    thermal->saturated        = false;
+
+    // Deferred chunks go straight back into the active set and owe the pass they missed
+    for(SBX_chunk_index_t i = 0; i < deferredCount; i++) {
+        SBX_chunk_index_t chunkIndex = thermal->workingChunks[thermal->chunkCapacity - 1 - i];
+        thermal->chunkFlags[chunkIndex] |= SBX_BOX_THERMAL_CHUNK_ACTIVE;
+        thermal->activeChunks[thermal->activeChunkCount++] = chunkIndex;
+        thermal->owedTicks[chunkIndex] += thermal->owedTicks[chunkIndex] != UINT32_MAX;
+    }
+
+    // Make room for the ghost plane and the temperature change of every position of the working chunks
+    if(workingChunkCount > thermal->scratchCapacity) {
+        SBX_box_thermal_chunk_t* scratch = SBXAllocatorReallocate(thermal->allocator, SBX_MEMORY_SUBSYSTEM_THERMAL, thermal->scratch,
+                                                                  sizeof(SBX_box_thermal_chunk_t) * thermal->scratchCapacity,
+                                                                  sizeof(SBX_box_thermal_chunk_t) * workingChunkCount);
+        if(scratch == SBX_POINTER_UNSET) {
+            // Put the working chunks back in the active set so nothing is lost, and give up on this tick
+            for(SBX_chunk_index_t i = 0; i < workingChunkCount; i++) {
+                thermal->chunkFlags[thermal->workingChunks[i]] &= (uint8_t)~SBX_BOX_THERMAL_CHUNK_WORKING;
+            }
+            for(SBX_chunk_index_t i = 0; i < deferredCount; i++) {
+                thermal->chunkFlags[thermal->workingChunks[thermal->chunkCapacity - 1 - i]] &= (uint8_t)~SBX_BOX_THERMAL_CHUNK_DEFERRED;
+            }
+            thermal->saturated = true;
+
+            // Return error
+            return (SBX_report_t){
+                .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+                .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+            };
+        }
+        thermal->scratch         = scratch;
+        thermal->scratchCapacity = workingChunkCount;
+    }
+
+    thermal->workingChunkCount  = workingChunkCount;
+    thermal->deferredChunkCount = deferredCount;
+    *workingCount               = workingChunkCount;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_THERMAL_BEGIN_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxThermalComputeChunk(SBX_box_t* box, SBX_chunk_index_t workingIndex) {
+    // Check if required arguments are provided
+    if((box == SBX_POINTER_UNSET) || (workingIndex >= box->thermal.workingChunkCount)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    SBXBoxThermalDeltas(box, workingIndex);
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_THERMAL_COMPUTE_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxThermalApplyChunk(SBX_box_t* box, SBX_chunk_index_t workingIndex) {
+    // Check if required arguments are provided
+    if((box == SBX_POINTER_UNSET) || (workingIndex >= box->thermal.workingChunkCount)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    SBX_box_thermal_t* thermal = &box->thermal;
+    SBX_chunk_index_t chunkIndex = thermal->workingChunks[workingIndex];
+    SBX_plock_temperature_t* deltas = thermal->scratch[workingIndex].deltas;
+    SBX_box_position_t originX = (SBX_box_position_t)((chunkIndex % box->chunkColumns) << SBX_CHUNK_SHIFT);
+    SBX_box_position_t originY = (SBX_box_position_t)((chunkIndex / box->chunkColumns) << SBX_CHUNK_SHIFT);
+    thermal->chunkFlags[chunkIndex] &= (uint8_t)~SBX_BOX_THERMAL_CHUNK_WORKING;
+    thermal->owedTicks[chunkIndex]   = 0;
+
+    // Write the changes through the box so stats, content hashes, subscribers, and the next active set see them
+    SBX_report_t report = {.errorFlags = 0, .reportMessage = SBX_REPORT_STRING_BOX_THERMAL_APPLY_SUCCESSFUL};
+    for(SBX_plock_count_t j = 0; !report.errorFlags && j < SBX_CHUNK_PLOCK_COUNT; j++) {
+        if(deltas[j] == 0.0L) {
+            continue;
+        }
+
+        SBX_box_position_t x = originX + (SBX_box_position_t)(j & SBX_CHUNK_MASK), y = originY + (SBX_box_position_t)(j >> SBX_CHUNK_SHIFT);
+        SBX_plock_t plock;
+        SBXBoxGetPlock(box, x, y, &plock);
+        plock.temperature += deltas[j];
+        report = SBXBoxSetPlock(box, x, y, plock);
+    }
+
+    if(report.errorFlags) {
+        return report;
+    }
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_THERMAL_APPLY_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxThermalEnd(SBX_box_t* box) {
+    // Check if required arguments are provided
+    if(box == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Whether a chunk is deferred is decided again every pass
+    SBX_box_thermal_t* thermal = &box->thermal;
+    for(SBX_chunk_index_t i = 0; i < thermal->deferredChunkCount; i++) {
+        thermal->chunkFlags[thermal->workingChunks[thermal->chunkCapacity - 1 - i]] &= (uint8_t)~SBX_BOX_THERMAL_CHUNK_DEFERRED;
+    }
+    thermal->workingChunkCount  = 0;
+    thermal->deferredChunkCount = 0;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_BOX_THERMAL_END_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxThermalStep(SBX_box_t* box) {
+    SBX_chunk_index_t workingCount;
+    SBX_report_t report = SBXBoxThermalBegin(box, &workingCount);
+    if(report.errorFlags) {
+        return report;
+    }
+
+    // Work out every change before writing any, so the result does not depend on the order chunks are visited in,
+    // or on which worker of the pool of the box visits them
+    SBX_box_thermal_t* thermal = &box->thermal;
+    if(box->workers != SBX_POINTER_UNSET) {
+        SBX_report_t runReport = SBXWorkersRun(box->workers, box, thermal->workingChunks, workingCount, SBXBoxThermalDeltasJob, box);
+        // Fall back to this thread if the pool can't take the chunks
+        if(runReport.errorFlags) {
+            for(SBX_chunk_index_t i = 0; i < workingCount; i++) {
+                SBXBoxThermalDeltas(box, i);
+            }
+        }
+    } else {
+        for(SBX_chunk_index_t i = 0; i < workingCount; i++) {
+            SBXBoxThermalDeltas(box, i);
+        }
+    }
+
+    // A chunk whose writes fail doesn't stop the others from being written
+    report = (SBX_report_t){.errorFlags = 0, .reportMessage = SBX_REPORT_STRING_BOX_THERMAL_STEP_SUCCESSFUL};
+    for(SBX_chunk_index_t i = 0; i < workingCount; i++) {
+        SBX_report_t applyReport = SBXBoxThermalApplyChunk(box, i);
+        if(applyReport.errorFlags && !report.errorFlags) {
+            report = applyReport;
+        }
+    }
+
+    SBXBoxThermalEnd(box);
+
+    return report;
+}
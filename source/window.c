@@ -12,6 +12,11 @@
 
 // Window creation function
 SBX_report_t SBXWindowCreate(SBX_window_t** window) {
+    return SBXWindowCreateWithAllocator(window, SBX_POINTER_UNSET);
+}
+
+// Window creation function with an allocator
+SBX_report_t SBXWindowCreateWithAllocator(SBX_window_t** window, SBX_allocator_t* allocator) {
     // Check if required arguments are provided
     if(window == SBX_POINTER_UNSET) {
         // Return error
@@ -22,7 +27,7 @@ SBX_report_t SBXWindowCreate(SBX_window_t** window) {
     }
 
     // Allocate memory for the SBXWindow struture
-    *window = malloc(sizeof(SBX_window_t));
+    *window = SBXAllocatorAllocate(allocator, SBX_MEMORY_SUBSYSTEM_WINDOW, sizeof(SBX_window_t));
 
     // Check for a memory allocation error
     if(!*window) {
@@ -34,7 +39,9 @@ SBX_report_t SBXWindowCreate(SBX_window_t** window) {
     }
 
     // Set SBXWindow members to a deinitialized state
+    (*window)->allocator     = allocator;
     (*window)->initialized   = false;
+    (*window)->offscreen     = false;
     (*window)->windowHandle  = NULL;
     (*window)->openglContext = NULL;
 
@@ -63,7 +70,7 @@ SBX_report_t SBXWindowDestroy(SBX_window_t* window) {
         };
     }
 
-    free(window);
+    SBXAllocatorFree(window->allocator, SBX_MEMORY_SUBSYSTEM_WINDOW, window, sizeof(SBX_window_t));
 
     return (SBX_report_t){
         .errorFlags    = 0,
@@ -71,6 +78,46 @@ SBX_report_t SBXWindowDestroy(SBX_window_t* window) {
     };
 }
 
+// Makes the context of a new window handle current and loads OpenGL through it, then sets the window initialized
+static SBX_report_t SBXWindowLoadContext(SBX_window_t* window) {
+    // Set window handle user pointer to the SBXWindow manager object
+    glfwSetWindowUserPointer(window->windowHandle, window);
+
+    // Make our window handle the current context
+    glfwMakeContextCurrent(window->windowHandle);
+
+    // Attempt to allocate memory for the OpenGL context
+    window->openglContext = SBXAllocatorAllocate(window->allocator, SBX_MEMORY_SUBSYSTEM_WINDOW, sizeof(GladGLContext));
+    if(!window->openglContext) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    // Attempt to initialize context
+    if(!gladLoadGLContext(window->openglContext, (GLADloadfunc)glfwGetProcAddress)) {
+        // Free the memory used by the GladGLContext struct before exiting
+        SBXAllocatorFree(window->allocator, SBX_MEMORY_SUBSYSTEM_WINDOW, window->openglContext, sizeof(GladGLContext));
+        window->openglContext = SBX_POINTER_UNSET;
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_WINDOW_ERROR_CONTEXT_INIT_FAILED,
+            .reportMessage = SBX_REPORT_STRING_WINDOW_CONTEXT_FAILED
+        };
+    }
+
+    // Set init state to init
+    window->initialized = true;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_WINDOW_INIT_SUCCESSFUL
+    };
+}
+
 // Window initialization function
 SBX_report_t SBXWindowInit(SBX_window_t* window,
                                   SBX_string_t title,
@@ -123,41 +170,73 @@ SBX_report_t SBXWindowInit(SBX_window_t* window,
         };
     }
 
-    // Set window handle user pointer to the SBXWindow manager object
-    glfwSetWindowUserPointer(window->windowHandle, window);
+    return SBXWindowLoadContext(window);
+}
 
-    // Make our window handle the current context
-    glfwMakeContextCurrent(window->windowHandle);
+// Offscreen window initialization function
+SBX_report_t SBXWindowInitOffscreen(SBX_window_t* window, SBX_window_dimensions_t width, SBX_window_dimensions_t height) {
+    // Check if required arguments are provided
+    if((window == SBX_POINTER_UNSET) || (width == SBX_DIMENSION_UNSET) || (height == SBX_DIMENSION_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for window not already initialized
+    if(window->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_WINDOW_ERROR_ALREADY_INIT,
+            .reportMessage = SBX_REPORT_STRING_WINDOW_ALREADY_INIT
+        };
+    }
 
-    // Attempt to allocate memory for the OpenGL context
-    window->openglContext = malloc(sizeof(GladGLContext));
-    if(!window->openglContext) {
+    // Make sure GLFW is initialized, on the null platform so no display is needed. The hint only applies when GLFW isn't initialized yet,
+    // otherwise the window is a hidden one on the platform GLFW already runs on
+    glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+    int initResult = glfwInit();
+    glfwInitHint(GLFW_PLATFORM, GLFW_ANY_PLATFORM);
+    if(initResult != GLFW_TRUE) {
         // Return error
         return (SBX_report_t){
-            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
-            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+            .errorFlags    = SBX_WINDOW_ERROR_GLFW_INIT_FAILED,
+            .reportMessage = SBX_REPORT_STRING_WINDOW_GLFW_INIT_FAILED
         };
     }
 
-    // Attempt to initialize context
-    if(!gladLoadGLContext(window->openglContext, (GLADloadfunc)glfwGetProcAddress)) {
-        // Free the memory used by the GladGLContext struct before exiting
-        free(window->openglContext);
+    // Set window creation hints, the null platform has no native context API so it gets an EGL context on Mesa's surfaceless platform,
+    // which runs on llvmpipe when there is no GPU, and an OSMesa one where EGL is missing
+    SBX_bool_t nullPlatform = glfwGetPlatform() == GLFW_PLATFORM_NULL;
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 5);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    if(nullPlatform) {
+        glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_EGL_CONTEXT_API);
+    }
+
+    // Create window
+    window->windowHandle = glfwCreateWindow(width, height, "SBX", NULL, NULL);
+    if(!window->windowHandle && nullPlatform) {
+        glfwWindowHint(GLFW_CONTEXT_CREATION_API, GLFW_OSMESA_CONTEXT_API);
+        window->windowHandle = glfwCreateWindow(width, height, "SBX", NULL, NULL);
+    }
 
+    // Reset window hints
+    glfwDefaultWindowHints();
+
+    // Check if window creation failed
+    if(!window->windowHandle) {
         // Return error
         return (SBX_report_t){
-            .errorFlags    = SBX_WINDOW_ERROR_CONTEXT_INIT_FAILED,
-            .reportMessage = SBX_REPORT_STRING_WINDOW_CONTEXT_FAILED
+            .errorFlags    = SBX_WINDOW_ERROR_HANDLE_INIT_FAILED,
+            .reportMessage = SBX_REPORT_STRING_WINDOW_HANDLE_FAILED
         };
     }
 
-    // Set init state to init
-    window->initialized = true;
-
-    return (SBX_report_t){
-        .errorFlags    = 0,
-        .reportMessage = SBX_REPORT_STRING_WINDOW_INIT_SUCCESSFUL
-    };
+    window->offscreen = true;
+    return SBXWindowLoadContext(window);
 }
 
 // Window deinitialization function
@@ -187,12 +266,13 @@ SBX_report_t SBXWindowDeinit(SBX_window_t* window) {
 
     // Check if the OpenGL context handle exists, then destroy OpenGL context and set handle to SBX_POINTER_UNSET
     if(window->openglContext) {
-        free(window->openglContext);
+        SBXAllocatorFree(window->allocator, SBX_MEMORY_SUBSYSTEM_WINDOW, window->openglContext, sizeof(GladGLContext));
         window->openglContext = SBX_POINTER_UNSET;
     }
 
     // Set the initialization state to deinitialized
     window->initialized = false;
+    window->offscreen   = false;
 
     return (SBX_report_t){
         .errorFlags    = 0,
@@ -0,0 +1,580 @@
+// sched_setaffinity, its CPU set macros, and the move_pages system call are extensions on top of C17
+#if defined(__linux__)
+    #define _GNU_SOURCE
+#endif
+
+// Project headers
+#include <SBX/workers.h>
+#include <SBX/strings.h>
+#include <SBX/allocator.h>
+#include <SBX/box.h>
+#include <SBX/chunk.h>
+
+// LibC headers
+#include <stdio.h>
+#include <string.h>
+
+// Platform headers
+#if defined(__linux__)
+    #define SBX_WORKERS_NUMA
+    #include <sched.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+// Highest NUMA node ID looked for in sysfs, node IDs can have gaps
+#define SBX_WORKERS_NODE_ID_LIMIT 1024
+// Bytes of the plocks and plock IDs of one chunk, what a remote item reads across nodes at most
+#define SBX_WORKERS_CHUNK_BYTES   ((uint64_t)SBX_CHUNK_PLOCK_COUNT * (sizeof(SBX_plock_t) + sizeof(SBX_plock_id_t)))
+
+// Work given to the workers by a placement
+typedef struct SBXWorkersPlaceJob {
+    SBX_workers_t* workers;
+    SBX_box_t*     box;
+    atomic_bool    failed;
+} SBX_workers_place_job_t;
+
+// Reads the CPUs of every NUMA node that has any, returns the number of nodes, 0 where nodes can't be read
+static uint16_t SBXWorkersReadNodes(uint16_t nodeIDs[SBX_WORKERS_MAXIMUM_NODES], uint64_t nodeCPUs[SBX_WORKERS_MAXIMUM_NODES][SBX_WORKERS_MAXIMUM_CPUS / 64]) {
+    uint16_t nodeCount = 0;
+#if defined(SBX_WORKERS_NUMA)
+    for(uint32_t id = 0; id < SBX_WORKERS_NODE_ID_LIMIT; id++) {
+        char path[64];
+        snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", id);
+        FILE* file = fopen(path, "r");
+        if(!file) {
+            continue;
+        }
+
+        // The list is ranges like 0-3,8-11 or single CPUs, nodes holding only memory have an empty one
+        uint64_t   cpus[SBX_WORKERS_MAXIMUM_CPUS / 64] = {0};
+        SBX_bool_t empty = true;
+        unsigned   first, last;
+        int        matched;
+        while((matched = fscanf(file, "%u-%u", &first, &last)) >= 1) {
+            last = matched == 2 ? last : first;
+            for(unsigned cpu = first; (cpu <= last) && (cpu < SBX_WORKERS_MAXIMUM_CPUS); cpu++) {
+                cpus[cpu / 64] |= (uint64_t)1 << (cpu % 64);
+                empty = false;
+            }
+            if(fgetc(file) != ',') {
+                break;
+            }
+        }
+        fclose(file);
+        if(empty) {
+            continue;
+        }
+
+        // Nodes past the limit share the slots of earlier ones, keeping the ID of the first
+        uint16_t slot = nodeCount < SBX_WORKERS_MAXIMUM_NODES ? nodeCount : (uint16_t)(id % SBX_WORKERS_MAXIMUM_NODES);
+        if(nodeCount < SBX_WORKERS_MAXIMUM_NODES) {
+            nodeIDs[slot] = (uint16_t)id;
+            memset(nodeCPUs[slot], 0, sizeof(nodeCPUs[slot]));
+            nodeCount++;
+        }
+        for(uint32_t i = 0; i < SBX_WORKERS_MAXIMUM_CPUS / 64; i++) {
+            nodeCPUs[slot][i] |= cpus[i];
+        }
+    }
+#else
+    (void)nodeIDs;
+    (void)nodeCPUs;
+#endif
+    return nodeCount;
+}
+
+// Gets the node the page holding an address is on, SBX_WORKERS_NODE_UNKNOWN if the kernel can't tell
+static uint16_t SBXWorkersGetNode(const void* address) {
+#if defined(SBX_WORKERS_NUMA) && defined(SYS_move_pages)
+    // Without target nodes move_pages moves nothing and only reports where the page is
+    void* page   = (void*)((uintptr_t)address & ~(uintptr_t)4095);
+    int   status = -1;
+    if((syscall(SYS_move_pages, 0, 1UL, &page, NULL, &status, 0) == 0) && (status >= 0)) {
+        return (uint16_t)status;
+    }
+#else
+    (void)address;
+#endif
+    return SBX_WORKERS_NODE_UNKNOWN;
+}
+
+// Gets the worker a chunk is home to, the chunk table is cut into one band per worker in row-major order
+static inline uint32_t SBXWorkersGetHome(const SBX_workers_t* workers, SBX_chunk_index_t chunkIndex, SBX_chunk_index_t chunkCount) {
+    return (uint32_t)((uint64_t)chunkIndex * workers->threadCount / chunkCount);
+}
+
+// Runs the items of a range claimed from a worker, the owner itself or a victim
+static void SBXWorkersTake(SBX_worker_t* worker, SBX_worker_t* owner) {
+    SBX_workers_t*    workers    = worker->workers;
+    SBX_chunk_index_t chunkCount = (SBX_chunk_index_t)workers->box->chunkColumns * workers->box->chunkRows;
+    SBX_bool_t        placed     = (workers->placedBox == workers->box) && (workers->chunkCapacity == chunkCount);
+
+    uint32_t position;
+    while((position = atomic_fetch_add_explicit(&owner->cursor, SBX_WORKERS_BATCH_SIZE, memory_order_relaxed)) < owner->end) {
+        uint32_t end = position + SBX_WORKERS_BATCH_SIZE < owner->end ? position + SBX_WORKERS_BATCH_SIZE : owner->end;
+        for(; position < end; position++) {
+            uint32_t item = workers->order[position];
+
+            // Placement runs never leave the home worker and are not counted
+            if(workers->stealing) {
+                SBX_chunk_index_t chunkIndex = workers->chunks[item];
+                uint16_t          node       = placed ? workers->chunkNodes[chunkIndex] : SBX_WORKERS_NODE_UNKNOWN;
+                node = node != SBX_WORKERS_NODE_UNKNOWN ? node : workers->threads[SBXWorkersGetHome(workers, chunkIndex, chunkCount)].node;
+                if(node == worker->node) {
+                    worker->stats.localItems++;
+                } else {
+                    worker->stats.remoteItems++;
+                    worker->stats.crossNodeBytes += SBX_WORKERS_CHUNK_BYTES;
+                }
+                if(owner != worker) {
+                    worker->stats.sameNodeSteals  += owner->node == worker->node;
+                    worker->stats.crossNodeSteals += owner->node != worker->node;
+                }
+            }
+
+            workers->job(workers->userData, item, worker->index);
+        }
+    }
+}
+
+// Worker thread entry, pins itself to its node and runs every run until the pool stops
+static int SBXWorkersThread(void* argument) {
+    SBX_worker_t*  worker  = argument;
+    SBX_workers_t* workers = worker->workers;
+
+#if defined(SBX_WORKERS_NUMA)
+    // Pinning is best effort, an unpinned worker still runs and its first touches just land wherever it is scheduled
+    cpu_set_t  set;
+    SBX_bool_t any = false;
+    CPU_ZERO(&set);
+    for(uint32_t cpu = 0; (cpu < SBX_WORKERS_MAXIMUM_CPUS) && (cpu < CPU_SETSIZE); cpu++) {
+        if(worker->cpus[cpu / 64] & ((uint64_t)1 << (cpu % 64))) {
+            CPU_SET(cpu, &set);
+            any = true;
+        }
+    }
+    worker->pinned = any && (sched_setaffinity(0, sizeof(set), &set) == 0);
+#endif
+
+    mtx_lock(&workers->lock);
+    uint32_t generation = workers->generation;
+    for(;;) {
+        while(!workers->stopping && (workers->generation == generation)) {
+            cnd_wait(&workers->start, &workers->lock);
+        }
+        if(workers->stopping) {
+            break;
+        }
+        generation = workers->generation;
+        mtx_unlock(&workers->lock);
+
+        // Own items first, then the victims, same node ones first
+        SBXWorkersTake(worker, worker);
+        for(uint32_t i = 0; workers->stealing && (i < worker->victimCount); i++) {
+            SBXWorkersTake(worker, &workers->threads[worker->victims[i]]);
+        }
+
+        mtx_lock(&workers->lock);
+        if(++workers->finished == workers->threadCount) {
+            cnd_signal(&workers->done);
+        }
+    }
+    mtx_unlock(&workers->lock);
+
+    return 0;
+}
+
+// Sorts the items by home worker and runs them on every worker, waiting for the run to end
+static SBX_bool_t SBXWorkersDispatch(SBX_workers_t* workers, SBX_box_t* box, const SBX_chunk_index_t* chunks, uint32_t itemCount,
+                                     SBX_workers_job_t job, void* userData, SBX_bool_t stealing) {
+    if(itemCount > workers->orderCapacity) {
+        uint32_t* order = SBXAllocatorReallocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_WORKERS, workers->order,
+                                                 sizeof(uint32_t) * workers->orderCapacity, sizeof(uint32_t) * itemCount);
+        if(order == SBX_POINTER_UNSET) {
+            return false;
+        }
+        workers->order         = order;
+        workers->orderCapacity = itemCount;
+    }
+
+    // Counting sort of the items by home worker, every worker range starts where the previous one ends
+    SBX_chunk_index_t chunkCount = (SBX_chunk_index_t)box->chunkColumns * box->chunkRows;
+    uint32_t          offsets[SBX_WORKERS_MAXIMUM_THREADS + 1] = {0};
+    for(uint32_t i = 0; i < itemCount; i++) {
+        offsets[SBXWorkersGetHome(workers, chunks[i], chunkCount) + 1]++;
+    }
+    for(uint32_t w = 0; w < workers->threadCount; w++) {
+        offsets[w + 1] += offsets[w];
+        atomic_store_explicit(&workers->threads[w].cursor, offsets[w], memory_order_relaxed);
+        workers->threads[w].end = offsets[w + 1];
+    }
+    for(uint32_t i = 0; i < itemCount; i++) {
+        workers->order[offsets[SBXWorkersGetHome(workers, chunks[i], chunkCount)]++] = i;
+    }
+
+    mtx_lock(&workers->lock);
+    workers->box      = box;
+    workers->chunks   = chunks;
+    workers->job      = job;
+    workers->userData = userData;
+    workers->stealing = stealing;
+    workers->finished = 0;
+    for(uint32_t w = 0; w < workers->threadCount; w++) {
+        workers->threads[w].stats = (SBX_workers_stats_t){0};
+    }
+    workers->generation++;
+    cnd_broadcast(&workers->start);
+    while(workers->finished < workers->threadCount) {
+        cnd_wait(&workers->done, &workers->lock);
+    }
+
+    // Fold the counts of the run into the pool
+    for(uint32_t w = 0; w < workers->threadCount; w++) {
+        SBX_workers_stats_t* stats = &workers->threads[w].stats;
+        workers->stats.localItems      += stats->localItems;
+        workers->stats.remoteItems     += stats->remoteItems;
+        workers->stats.crossNodeBytes  += stats->crossNodeBytes;
+        workers->stats.sameNodeSteals  += stats->sameNodeSteals;
+        workers->stats.crossNodeSteals += stats->crossNodeSteals;
+        workers->stats.placedChunks    += stats->placedChunks;
+        workers->stats.migratedChunks  += stats->migratedChunks;
+    }
+    workers->stats.runs += stealing;
+    mtx_unlock(&workers->lock);
+
+    return true;
+}
+
+// Placement job, runs on the home worker of the chunk so copies it makes are faulted in on its node
+static void SBXWorkersPlaceChunk(void* userData, uint32_t item, uint32_t worker) {
+    SBX_workers_place_job_t* job        = userData;
+    SBX_workers_t*           workers    = job->workers;
+    SBX_worker_t*            self       = &workers->threads[worker];
+    SBX_chunk_index_t        chunkIndex = workers->placeChunks[item];
+    SBX_chunk_data_t*        data       = job->box->chunks[chunkIndex].data;
+
+    uint16_t node = SBXWorkersGetNode(data->plockArray.plocks != SBX_POINTER_UNSET ? (const void*)data->plockArray.plocks : (const void*)data);
+    self->stats.placedChunks++;
+
+    // Storage a snapshot also holds stays where it is, the next write copies it anyway
+    if((node != SBX_WORKERS_NODE_UNKNOWN) && (node != self->node) && (atomic_load_explicit(&data->referenceCount, memory_order_relaxed) == 1)) {
+        SBX_chunk_data_t* copy;
+        if(!SBXChunkDataDuplicate(data, &copy).errorFlags) {
+            job->box->chunks[chunkIndex].data = copy;
+            SBXChunkDataRelease(data);
+            node = SBXWorkersGetNode(copy->plockArray.plocks != SBX_POINTER_UNSET ? (const void*)copy->plockArray.plocks : (const void*)copy);
+            self->stats.migratedChunks++;
+        } else {
+            atomic_store_explicit(&job->failed, true, memory_order_relaxed);
+        }
+    }
+
+    workers->placedData[chunkIndex] = job->box->chunks[chunkIndex].data;
+    workers->chunkNodes[chunkIndex] = node;
+}
+
+SBX_report_t SBXWorkersCreate(SBX_workers_t** workers, uint32_t threadCount) {
+    // Check if required arguments are provided
+    if((workers == SBX_POINTER_UNSET) || !threadCount || (threadCount > SBX_WORKERS_MAXIMUM_THREADS)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Allocate memory for the SBXWorkers structure and its workers
+    *workers = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_WORKERS, sizeof(SBX_workers_t));
+    SBX_worker_t* threads = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_WORKERS, sizeof(SBX_worker_t) * threadCount);
+
+    // Check for a memory allocation error
+    if(!*workers || !threads) {
+        // Free anything that was allocated before exiting
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_WORKERS, *workers, sizeof(SBX_workers_t));
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_WORKERS, threads, sizeof(SBX_worker_t) * threadCount);
+        *workers = SBX_POINTER_UNSET;
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    // Without readable nodes every worker shares node 0 and is left unpinned
+    uint16_t nodeIDs[SBX_WORKERS_MAXIMUM_NODES]                            = {0};
+    uint64_t nodeCPUs[SBX_WORKERS_MAXIMUM_NODES][SBX_WORKERS_MAXIMUM_CPUS / 64] = {{0}};
+    uint16_t nodeCount = SBXWorkersReadNodes(nodeIDs, nodeCPUs);
+    nodeCount = nodeCount ? nodeCount : 1;
+
+    **workers = (SBX_workers_t){
+        .threads       = threads,
+        .threadCount   = threadCount,
+        .nodeCount     = nodeCount,
+        .generation    = 0,
+        .finished      = 0,
+        .stopping      = false,
+        .box           = SBX_POINTER_UNSET,
+        .order         = SBX_POINTER_UNSET,
+        .orderCapacity = 0,
+        .placedBox     = SBX_POINTER_UNSET,
+        .placedData    = SBX_POINTER_UNSET,
+        .chunkNodes    = SBX_POINTER_UNSET,
+        .placeChunks   = SBX_POINTER_UNSET,
+        .chunkCapacity = 0,
+        .stats         = {0}
+    };
+
+    // Consecutive workers share a node, so the bands of neighboring chunks they are home to do too
+    for(uint32_t w = 0; w < threadCount; w++) {
+        uint32_t nodeIndex = (uint32_t)((uint64_t)w * nodeCount / threadCount);
+        threads[w] = (SBX_worker_t){
+            .workers     = *workers,
+            .index       = w,
+            .node        = nodeIDs[nodeIndex],
+            .pinned      = false,
+            .victimCount = 0,
+            .end         = 0
+        };
+        memcpy(threads[w].cpus, nodeCPUs[nodeIndex], sizeof(threads[w].cpus));
+        atomic_init(&threads[w].cursor, 0);
+    }
+    // Victims on the same node come first, every worker starts looking right after itself so stealers spread out
+    for(uint32_t w = 0; w < threadCount; w++) {
+        for(uint32_t pass = 0; pass < 2; pass++) {
+            for(uint32_t i = 1; i < threadCount; i++) {
+                uint32_t victim = (w + i) % threadCount;
+                if((threads[victim].node == threads[w].node) == (pass == 0)) {
+                    threads[w].victims[threads[w].victimCount++] = victim;
+                }
+            }
+        }
+    }
+
+    SBX_bool_t synchronizationFailed = mtx_init(&(*workers)->lock, mtx_plain) != thrd_success;
+    synchronizationFailed |= cnd_init(&(*workers)->start) != thrd_success;
+    synchronizationFailed |= cnd_init(&(*workers)->done) != thrd_success;
+
+    uint32_t started = 0;
+    while(!synchronizationFailed && (started < threadCount) && (thrd_create(&threads[started].thread, SBXWorkersThread, &threads[started]) == thrd_success)) {
+        started++;
+    }
+
+    // Check for a thread creation error
+    if(started < threadCount) {
+        // Stop the workers that did start before freeing them
+        if(started) {
+            mtx_lock(&(*workers)->lock);
+            (*workers)->stopping = true;
+            cnd_broadcast(&(*workers)->start);
+            mtx_unlock(&(*workers)->lock);
+            for(uint32_t w = 0; w < started; w++) {
+                thrd_join(threads[w].thread, NULL);
+            }
+        }
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_WORKERS, threads, sizeof(SBX_worker_t) * threadCount);
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_WORKERS, *workers, sizeof(SBX_workers_t));
+        *workers = SBX_POINTER_UNSET;
+
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_THREAD_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_THREAD_FAILURE
+        };
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMMON_CREATION_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXWorkersDestroy(SBX_workers_t* workers) {
+    // Check if required arguments are provided
+    if(workers == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    mtx_lock(&workers->lock);
+    workers->stopping = true;
+    cnd_broadcast(&workers->start);
+    mtx_unlock(&workers->lock);
+    for(uint32_t w = 0; w < workers->threadCount; w++) {
+        thrd_join(workers->threads[w].thread, NULL);
+    }
+    cnd_destroy(&workers->start);
+    cnd_destroy(&workers->done);
+    mtx_destroy(&workers->lock);
+
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_WORKERS, workers->order, sizeof(uint32_t) * workers->orderCapacity);
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_WORKERS, workers->placedData, sizeof(SBX_chunk_data_t*) * workers->chunkCapacity);
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_WORKERS, workers->chunkNodes, sizeof(uint16_t) * workers->chunkCapacity);
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_WORKERS, workers->placeChunks, sizeof(SBX_chunk_index_t) * workers->chunkCapacity);
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_WORKERS, workers->threads, sizeof(SBX_worker_t) * workers->threadCount);
+    SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_WORKERS, workers, sizeof(SBX_workers_t));
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_COMMON_DESTRUCTION_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXBoxSetWorkers(SBX_box_t* box, SBX_workers_t* workers) {
+    // Check if required arguments are provided
+    if(box == SBX_POINTER_UNSET) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    box->workers = workers;
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_WORKERS_SET_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXWorkersPlace(SBX_workers_t* workers, SBX_box_t* box) {
+    // Check if required arguments are provided
+    if((workers == SBX_POINTER_UNSET) || (box == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+    // Check for box initialized
+    if(!box->initialized) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_BOX_ERROR_NOT_INIT,
+            .reportMessage = SBX_REPORT_STRING_BOX_NOT_INIT
+        };
+    }
+
+    // Another box or a resized chunk table starts over, chunk indices no longer mean the same storage
+    SBX_chunk_index_t chunkCount = (SBX_chunk_index_t)box->chunkColumns * box->chunkRows;
+    if(workers->chunkCapacity != chunkCount) {
+        SBX_chunk_data_t** placedData  = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_WORKERS, sizeof(SBX_chunk_data_t*) * chunkCount);
+        uint16_t*          chunkNodes  = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_WORKERS, sizeof(uint16_t) * chunkCount);
+        SBX_chunk_index_t* placeChunks = SBXAllocatorAllocate(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_WORKERS, sizeof(SBX_chunk_index_t) * chunkCount);
+
+        // Check for a memory allocation error
+        if(!placedData || !chunkNodes || !placeChunks) {
+            // Free anything that was allocated before exiting
+            SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_WORKERS, placedData, sizeof(SBX_chunk_data_t*) * chunkCount);
+            SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_WORKERS, chunkNodes, sizeof(uint16_t) * chunkCount);
+            SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_WORKERS, placeChunks, sizeof(SBX_chunk_index_t) * chunkCount);
+
+            // Return error
+            return (SBX_report_t){
+                .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+                .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+            };
+        }
+
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_WORKERS, workers->placedData, sizeof(SBX_chunk_data_t*) * workers->chunkCapacity);
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_WORKERS, workers->chunkNodes, sizeof(uint16_t) * workers->chunkCapacity);
+        SBXAllocatorFree(SBX_POINTER_UNSET, SBX_MEMORY_SUBSYSTEM_WORKERS, workers->placeChunks, sizeof(SBX_chunk_index_t) * workers->chunkCapacity);
+        workers->placedData    = placedData;
+        workers->chunkNodes    = chunkNodes;
+        workers->placeChunks   = placeChunks;
+        workers->chunkCapacity = chunkCount;
+        workers->placedBox     = SBX_POINTER_UNSET;
+    }
+    if(workers->placedBox != box) {
+        for(SBX_chunk_index_t i = 0; i < chunkCount; i++) {
+            workers->placedData[i] = SBX_POINTER_UNSET;
+            workers->chunkNodes[i] = SBX_WORKERS_NODE_UNKNOWN;
+        }
+        workers->placedBox = box;
+    }
+
+    // Only storage that appeared since the last placement is checked, everything else is where it was left
+    uint32_t placeCount = 0;
+    for(SBX_chunk_index_t i = 0; i < chunkCount; i++) {
+        SBX_chunk_data_t* data = box->chunks[i].data;
+        if(data == SBX_POINTER_UNSET) {
+            workers->placedData[i] = SBX_POINTER_UNSET;
+            workers->chunkNodes[i] = SBX_WORKERS_NODE_UNKNOWN;
+        } else if(data != workers->placedData[i]) {
+            workers->placeChunks[placeCount++] = i;
+        }
+    }
+    if(!placeCount) {
+        return (SBX_report_t){
+            .errorFlags    = 0,
+            .reportMessage = SBX_REPORT_STRING_WORKERS_PLACE_SUCCESSFUL
+        };
+    }
+
+    SBX_workers_place_job_t job = {.workers = workers, .box = box};
+    atomic_init(&job.failed, false);
+    // Check for a memory allocation error
+    if(!SBXWorkersDispatch(workers, box, workers->placeChunks, placeCount, SBXWorkersPlaceChunk, &job, false) ||
+       atomic_load_explicit(&job.failed, memory_order_relaxed)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_WORKERS_PLACE_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXWorkersRun(SBX_workers_t* workers, SBX_box_t* box, const SBX_chunk_index_t* chunks, uint32_t itemCount, SBX_workers_job_t job, void* userData) {
+    // Check if required arguments are provided
+    if((workers == SBX_POINTER_UNSET) || (box == SBX_POINTER_UNSET) || ((chunks == SBX_POINTER_UNSET) && itemCount) || (job == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    // Check for a memory allocation error
+    if(itemCount && !SBXWorkersDispatch(workers, box, chunks, itemCount, job, userData, true)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MEMORY_FAILURE,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MEMORY_FAILURE
+        };
+    }
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_WORKERS_RUN_SUCCESSFUL
+    };
+}
+
+SBX_report_t SBXWorkersGetStats(SBX_workers_t* workers, SBX_workers_stats_t* stats) {
+    // Check if required arguments are provided
+    if((workers == SBX_POINTER_UNSET) || (stats == SBX_POINTER_UNSET)) {
+        // Return error
+        return (SBX_report_t){
+            .errorFlags    = SBX_COMMON_ERROR_MISSING_ARGUMENT,
+            .reportMessage = SBX_REPORT_STRING_COMMON_MISSING_ARGUMENT
+        };
+    }
+
+    mtx_lock(&workers->lock);
+    *stats = workers->stats;
+    mtx_unlock(&workers->lock);
+
+    return (SBX_report_t){
+        .errorFlags    = 0,
+        .reportMessage = SBX_REPORT_STRING_WORKERS_GET_STATS_SUCCESSFUL
+    };
+}
@@ -0,0 +1,65 @@
+// Project headers
+#include <SBX/material.h>
+#include <SBX/strings.h>
+
+// LibC headers
+#include <stdio.h>
+#include <string.h>
+
+// Compiles material files into the C source of SBXMaterialTableEmbedded, run by the build on resources/plocks,
+// usage: SBXMaterialPack output.c [file.plk ...]
+int main(int argc, char* argv[]) {
+    if(argc < 2) {
+        fprintf(stderr, "Usage: %s output.c [file%s ...]\n", argv[0], SBX_MATERIAL_EXTENSION);
+        return 1;
+    }
+
+    // Types no file defines keep their reset shade of grey
+    static SBX_material_table_t table;
+    SBXMaterialTableReset(&table);
+    SBX_string_t sources[SBX_PLOCK_TYPE_COUNT] = {NULL};
+    for(int i = 2; i < argc; i++) {
+        SBX_plock_type_id_t id = SBX_PLOCK_TYPE_ID_UNSET;
+        SBX_report_t report = SBXMaterialTableLoadFile(&table, argv[i], &id);
+        if(report.errorFlags) {
+            fprintf(stderr, "%s: %s\n", argv[i], report.reportMessage);
+            return 1;
+        }
+        if(sources[id] != NULL) {
+            fprintf(stderr, "%s: type ID %u is already defined by %s\n", argv[i], (unsigned)id, sources[id]);
+            return 1;
+        }
+        sources[id] = argv[i];
+    }
+
+    FILE* output = fopen(argv[1], "w");
+    if(output == NULL) {
+        fprintf(stderr, "%s: %s\n", argv[1], SBX_REPORT_STRING_COMMON_IO_FAILURE);
+        return 1;
+    }
+
+    // Colors are written as hexadecimal floats so the embedded table holds the exact values loading the files would
+    fprintf(output, "// Generated by SBXMaterialPack from the material files in resources/plocks, edit those instead\n\n");
+    fprintf(output, "// Project headers\n#include <SBX/material.h>\n\n");
+    fprintf(output, "const SBX_material_table_t SBXMaterialTableEmbedded = {\n    .types = {\n");
+    for(uint32_t i = 0; i < SBX_PLOCK_TYPE_COUNT; i++) {
+        const SBX_color_t* color = &table.types[i].color;
+        fprintf(output, "        [%u] = {.color = {.raw = {%a, %a, %a}}},\n", i, (double)color->raw[0], (double)color->raw[1], (double)color->raw[2]);
+    }
+    // The unset type never has a name, written anyway so the initializer isn't empty when no file is given
+    fprintf(output, "    },\n    .names = {\n        [%u] = \"\",\n", (unsigned)SBX_PLOCK_TYPE_ID_UNSET);
+    for(uint32_t i = 0; i < SBX_PLOCK_TYPE_COUNT; i++) {
+        // Names are letters, digits, underscores, and dashes, so they need no escaping
+        if(table.names[i][0]) {
+            fprintf(output, "        [%u] = \"%s\",\n", i, table.names[i]);
+        }
+    }
+    fprintf(output, "    }\n};\n");
+
+    if(ferror(output) | fclose(output)) {
+        fprintf(stderr, "%s: %s\n", argv[1], SBX_REPORT_STRING_COMMON_IO_FAILURE);
+        remove(argv[1]);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,197 @@
+// Project headers
+#include <SBX/pyramid.h>
+#include <SBX/strings.h>
+#include <SBX/plock.h>
+#include <SBX/box.h>
+
+// LibC headers
+#include <stdio.h>
+#include <string.h>
+
+// Box the check builds the pyramid for, 3 by 2 chunks with the right column and bottom row only partly inside the box
+#define SBX_PYRAMID_CHECK_WIDTH  160
+#define SBX_PYRAMID_CHECK_HEIGHT 100
+
+static SBX_plock_type_t SBXPyramidCheckTypes[SBX_PLOCK_TYPE_COUNT];
+static uint8_t          SBXPyramidCheckLevels[SBX_COLOR_PYRAMID_LEVEL_COUNT][SBX_CHUNK_PLOCK_COUNT * SBX_COLOR_PYRAMID_TEXEL_SIZE];
+static uint8_t          SBXPyramidCheckPixels[SBX_CHUNK_PLOCK_COUNT * SBX_COLOR_PYRAMID_TEXEL_SIZE];
+static int              SBXPyramidCheckFailures;
+
+// Reports a failed check, the check goes on so one run reports every failure
+static void SBXPyramidCheck(int passed, const char* what) {
+    if(!passed) {
+        printf("pyramid: %s\n", what);
+        SBXPyramidCheckFailures++;
+    }
+}
+
+// Checks every level of a chunk against levels reduced here from the plocks of the box, with the same rounding the pyramid uses
+static void SBXPyramidCheckChunk(SBX_color_pyramid_t* pyramid, SBX_box_t* box, SBX_chunk_index_t chunkIndex) {
+    uint32_t chunkX = (chunkIndex % box->chunkColumns) << SBX_CHUNK_SHIFT;
+    uint32_t chunkY = (chunkIndex / box->chunkColumns) << SBX_CHUNK_SHIFT;
+
+    // Level 0 is the palette color of every position, transparent outside the box and at unset positions
+    for(uint32_t y = 0; y < SBX_CHUNK_SIZE; y++) {
+        for(uint32_t x = 0; x < SBX_CHUNK_SIZE; x++) {
+            uint8_t* texel = &SBXPyramidCheckLevels[0][(y * SBX_CHUNK_SIZE + x) * SBX_COLOR_PYRAMID_TEXEL_SIZE];
+            memset(texel, 0, SBX_COLOR_PYRAMID_TEXEL_SIZE);
+
+            SBX_plock_t plock;
+            if((chunkX + x < box->width) && (chunkY + y < box->height) &&
+               !(SBXBoxGetPlock)(box, (SBX_box_position_t)(chunkX + x), (SBX_box_position_t)(chunkY + y), &plock).errorFlags &&
+               (plock.type != SBX_PLOCK_TYPE_ID_UNSET)) {
+                memcpy(texel, pyramid->palette[plock.type], SBX_COLOR_PYRAMID_TEXEL_SIZE);
+            }
+        }
+    }
+
+    for(uint8_t level = 0; level < SBX_COLOR_PYRAMID_LEVEL_COUNT; level++) {
+        uint32_t size = SBX_COLOR_PYRAMID_LEVEL_SIZE(level);
+        if(level) {
+            const uint8_t* source = SBXPyramidCheckLevels[level - 1];
+            for(uint32_t y = 0; y < size; y++) {
+                for(uint32_t x = 0; x < size; x++) {
+                    for(uint32_t channel = 0; channel < SBX_COLOR_PYRAMID_TEXEL_SIZE; channel++) {
+                        uint32_t sum = source[((2 * y) * size * 2 + 2 * x) * SBX_COLOR_PYRAMID_TEXEL_SIZE + channel] +
+                                       source[((2 * y) * size * 2 + 2 * x + 1) * SBX_COLOR_PYRAMID_TEXEL_SIZE + channel] +
+                                       source[((2 * y + 1) * size * 2 + 2 * x) * SBX_COLOR_PYRAMID_TEXEL_SIZE + channel] +
+                                       source[((2 * y + 1) * size * 2 + 2 * x + 1) * SBX_COLOR_PYRAMID_TEXEL_SIZE + channel];
+                        SBXPyramidCheckLevels[level][(y * size + x) * SBX_COLOR_PYRAMID_TEXEL_SIZE + channel] = (uint8_t)((sum + 2) >> 2);
+                    }
+                }
+            }
+        }
+
+        size_t rowSize = (size_t)size * SBX_COLOR_PYRAMID_TEXEL_SIZE;
+        SBX_report_t report = SBXColorPyramidWriteChunk(pyramid, box, chunkIndex, level, SBXPyramidCheckPixels, rowSize);
+        SBXPyramidCheck(!report.errorFlags && !memcmp(SBXPyramidCheckPixels, SBXPyramidCheckLevels[level], rowSize * size), "level texels differ from the plocks");
+    }
+}
+
+// Checks every chunk of the box
+static void SBXPyramidCheckBox(SBX_color_pyramid_t* pyramid, SBX_box_t* box) {
+    SBX_chunk_index_t chunkCount = (SBX_chunk_index_t)box->chunkColumns * box->chunkRows;
+    for(SBX_chunk_index_t c = 0; c < chunkCount; c++) {
+        SBXPyramidCheckChunk(pyramid, box, c);
+    }
+}
+
+// Gets the single texel of the top level of a chunk
+static void SBXPyramidCheckTop(SBX_color_pyramid_t* pyramid, SBX_box_t* box, SBX_chunk_index_t chunkIndex, uint8_t texel[SBX_COLOR_PYRAMID_TEXEL_SIZE]) {
+    memset(texel, 0xFF, SBX_COLOR_PYRAMID_TEXEL_SIZE);
+    SBXColorPyramidWriteChunk(pyramid, box, chunkIndex, SBX_CHUNK_SHIFT, texel, SBX_COLOR_PYRAMID_TEXEL_SIZE);
+}
+
+// Builds the color pyramid of a known box headless and checks its level texels and which chunks updates rebuild, run by ctest
+int main(void) {
+    // Type 1 is red, type 2 blue, type 3 a color that doesn't divide evenly, every other type is transparent
+    for(uint32_t t = 0; t < SBX_PLOCK_TYPE_COUNT; t++) {
+        SBXPyramidCheckTypes[t].color = SBX_COLOR_UNSET;
+    }
+    SBXPyramidCheckTypes[1].color = (SBX_color_t){{1.0f, 0.0f, 0.0f}};
+    SBXPyramidCheckTypes[2].color = (SBX_color_t){{0.0f, 0.0f, 1.0f}};
+    SBXPyramidCheckTypes[3].color = (SBX_color_t){{0.3f, 0.6f, 0.9f}};
+
+    SBX_box_t* box = SBX_POINTER_UNSET;
+    SBX_report_t report = SBXBoxCreate(&box);
+    if(!report.errorFlags) {
+        report = SBXBoxInit(box, SBX_PYRAMID_CHECK_WIDTH, SBX_PYRAMID_CHECK_HEIGHT);
+    }
+    SBX_color_pyramid_t* pyramid = SBX_POINTER_UNSET;
+    if(!report.errorFlags) {
+        report = SBXColorPyramidCreate(&pyramid, SBXPyramidCheckTypes);
+    }
+    if(report.errorFlags) {
+        printf("pyramid: %s\n", report.reportMessage);
+        return 1;
+    }
+
+    // Chunk 0 is all red, chunk 1 has a blue left half, chunk 3 a checkerboard of type 3, chunk 5 a diagonal of red, chunks 2 and 4 stay empty
+    for(uint32_t y = 0; y < SBX_CHUNK_SIZE; y++) {
+        for(uint32_t x = 0; x < SBX_CHUNK_SIZE; x++) {
+            SBXBoxSetPlock(box, (SBX_box_position_t)x, (SBX_box_position_t)y, (SBX_plock_t){.type = 1, .temperature = 20.0L});
+            if(x < SBX_CHUNK_SIZE / 2) {
+                SBXBoxSetPlock(box, (SBX_box_position_t)(SBX_CHUNK_SIZE + x), (SBX_box_position_t)y, (SBX_plock_t){.type = 2, .temperature = 20.0L});
+            }
+            if((SBX_CHUNK_SIZE + y < SBX_PYRAMID_CHECK_HEIGHT) && ((x + y) & 1)) {
+                SBXBoxSetPlock(box, (SBX_box_position_t)x, (SBX_box_position_t)(SBX_CHUNK_SIZE + y), (SBX_plock_t){.type = 3, .temperature = 20.0L});
+            }
+        }
+    }
+    for(uint32_t i = 0; (SBX_CHUNK_SIZE + i < SBX_PYRAMID_CHECK_HEIGHT) && (2 * SBX_CHUNK_SIZE + i < SBX_PYRAMID_CHECK_WIDTH); i++) {
+        SBXBoxSetPlock(box, (SBX_box_position_t)(2 * SBX_CHUNK_SIZE + i), (SBX_box_position_t)(SBX_CHUNK_SIZE + i), (SBX_plock_t){.type = 1, .temperature = 20.0L});
+    }
+
+    // The first update builds every chunk, empty chunks keep no texels
+    SBX_chunk_index_t chunkCount = (SBX_chunk_index_t)box->chunkColumns * box->chunkRows;
+    report = SBXColorPyramidUpdate(pyramid, box);
+    SBXPyramidCheck(!report.errorFlags, "first update failed");
+    SBXPyramidCheck(atomic_load(&pyramid->rebuiltChunkCount) == chunkCount, "first update did not build every chunk");
+    SBXPyramidCheck((pyramid->chunks[2].texels == SBX_POINTER_UNSET) && (pyramid->chunks[4].texels == SBX_POINTER_UNSET), "empty chunks keep texels");
+    SBXPyramidCheckBox(pyramid, box);
+
+    // Uniform regions reduce without rounding
+    uint8_t top[SBX_COLOR_PYRAMID_TEXEL_SIZE];
+    SBXPyramidCheckTop(pyramid, box, 0, top);
+    SBXPyramidCheck(!memcmp(top, (uint8_t[]){255, 0, 0, 255}, SBX_COLOR_PYRAMID_TEXEL_SIZE), "red chunk does not reduce to red");
+    SBXPyramidCheckTop(pyramid, box, 1, top);
+    SBXPyramidCheck(!memcmp(top, (uint8_t[]){0, 0, 128, 128}, SBX_COLOR_PYRAMID_TEXEL_SIZE), "half blue chunk does not reduce to half covered blue");
+    SBXPyramidCheckTop(pyramid, box, 2, top);
+    SBXPyramidCheck(!memcmp(top, (uint8_t[]){0, 0, 0, 0}, SBX_COLOR_PYRAMID_TEXEL_SIZE), "empty chunk is not transparent");
+
+    // Nothing changed, so nothing is rebuilt
+    report = SBXColorPyramidUpdate(pyramid, box);
+    SBXPyramidCheck(!report.errorFlags && !atomic_load(&pyramid->rebuiltChunkCount), "update without changes rebuilt chunks");
+
+    // Temperatures don't change colors, so heating every plock of the box rebuilds nothing
+    for(uint32_t y = 0; y < SBX_PYRAMID_CHECK_HEIGHT; y++) {
+        for(uint32_t x = 0; x < SBX_PYRAMID_CHECK_WIDTH; x++) {
+            SBX_plock_t plock;
+            if(!(SBXBoxGetPlock)(box, (SBX_box_position_t)x, (SBX_box_position_t)y, &plock).errorFlags && (plock.type != SBX_PLOCK_TYPE_ID_UNSET)) {
+                plock.temperature += 100.0L + x;
+                SBXBoxSetPlock(box, (SBX_box_position_t)x, (SBX_box_position_t)y, plock);
+            }
+        }
+    }
+    report = SBXColorPyramidUpdate(pyramid, box);
+    SBXPyramidCheck(!report.errorFlags && !atomic_load(&pyramid->rebuiltChunkCount), "temperature changes rebuilt chunks");
+
+    // A type change rebuilds only its chunk, and a plock in an empty chunk gives it texels
+    uint32_t revision = pyramid->chunks[0].revision;
+    SBXBoxSetPlock(box, 5, 7, (SBX_plock_t){.type = 2, .temperature = 20.0L});
+    SBXBoxSetPlock(box, 2 * SBX_CHUNK_SIZE + 3, 1, (SBX_plock_t){.type = 3, .temperature = 20.0L});
+    report = SBXColorPyramidUpdate(pyramid, box);
+    SBXPyramidCheck(!report.errorFlags && (atomic_load(&pyramid->rebuiltChunkCount) == 2), "type changes did not rebuild exactly their chunks");
+    SBXPyramidCheck(pyramid->chunks[0].revision == revision + 1, "rebuilt chunk kept its revision");
+    SBXPyramidCheck(pyramid->chunks[2].texels != SBX_POINTER_UNSET, "chunk that gained a plock has no texels");
+    SBXPyramidCheckBox(pyramid, box);
+
+    // Unsetting the only plock of a chunk drops its texels again
+    SBXBoxSetPlock(box, 2 * SBX_CHUNK_SIZE + 3, 1, (SBX_plock_t){.type = SBX_PLOCK_TYPE_ID_UNSET, .temperature = SBX_TEMPERATURE_UNSET});
+    report = SBXColorPyramidUpdate(pyramid, box);
+    SBXPyramidCheck(!report.errorFlags && (atomic_load(&pyramid->rebuiltChunkCount) == 1), "unset did not rebuild exactly its chunk");
+    SBXPyramidCheck(pyramid->chunks[2].texels == SBX_POINTER_UNSET, "chunk that lost its plocks keeps texels");
+
+    // A new palette rebuilds every chunk
+    SBXPyramidCheckTypes[1].color = (SBX_color_t){{0.0f, 1.0f, 0.0f}};
+    SBXColorPyramidSetPalette(pyramid, SBXPyramidCheckTypes);
+    report = SBXColorPyramidUpdate(pyramid, box);
+    SBXPyramidCheck(!report.errorFlags && (atomic_load(&pyramid->rebuiltChunkCount) == chunkCount), "palette change did not rebuild every chunk");
+    SBXPyramidCheckBox(pyramid, box);
+
+    // Growing the box lays the pyramid out again for the new chunk table
+    report = SBXBoxSetSize(box, SBX_PYRAMID_CHECK_WIDTH + SBX_CHUNK_SIZE, SBX_PYRAMID_CHECK_HEIGHT);
+    if(!report.errorFlags) {
+        report = SBXColorPyramidUpdate(pyramid, box);
+    }
+    chunkCount = (SBX_chunk_index_t)box->chunkColumns * box->chunkRows;
+    SBXPyramidCheck(!report.errorFlags && (atomic_load(&pyramid->rebuiltChunkCount) == chunkCount), "resize did not rebuild every chunk");
+    SBXPyramidCheckBox(pyramid, box);
+
+    SBXColorPyramidDestroy(pyramid);
+    SBXBoxDeinit(box);
+    SBXBoxDestroy(box);
+
+    printf("pyramid: %s\n", SBXPyramidCheckFailures ? "failed" : "passed");
+    return SBXPyramidCheckFailures != 0;
+}
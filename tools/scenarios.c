@@ -0,0 +1,57 @@
+// Project headers
+#include <SBX/scenario.h>
+#include <SBX/strings.h>
+
+// LibC headers
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Runs the scenario corpus headless against the golden files in a directory and fails on any hash divergence or timing regression,
+// run by ctest on resources/scenarios, usage: SBXScenarios golden-directory [--update] [--timing-threshold ratio]
+int main(int argc, char* argv[]) {
+    if(argc < 2) {
+        fprintf(stderr, "Usage: %s golden-directory [--update] [--timing-threshold ratio]\n", argv[0]);
+        return 1;
+    }
+
+    SBX_scenario_options_t options = {
+        .goldenDirectory = argv[1],
+        .update          = false,
+        .timingThreshold = 0.0
+    };
+    for(int i = 2; i < argc; i++) {
+        if(!strcmp(argv[i], "--update")) {
+            options.update = true;
+        }
+        else if(!strcmp(argv[i], "--timing-threshold") && (i + 1 < argc)) {
+            options.timingThreshold = strtod(argv[++i], NULL);
+        }
+        else {
+            fprintf(stderr, "Unknown scenario argument: %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    const SBX_scenario_t* scenarios = NULL;
+    uint32_t scenarioCount = 0;
+    SBXScenarioGetCorpus(&scenarios, &scenarioCount);
+
+    // Run every scenario even after a failure so one run reports all of them
+    int failures = 0;
+    for(uint32_t i = 0; i < scenarioCount; i++) {
+        SBX_scenario_result_t result;
+        SBX_report_t report = SBXScenarioRun(&scenarios[i], &options, &result);
+        if(report.errorFlags & SBX_SCENARIO_ERROR_DIVERGED) {
+            printf("%s: %s at tick %llu, chunk %lu\n", scenarios[i].name, report.reportMessage,
+                   (unsigned long long)result.divergedTick, (unsigned long)result.divergedChunk);
+        }
+        else {
+            printf("%s: %s, mean step %llu ns, baseline %llu ns\n", scenarios[i].name, report.reportMessage,
+                   (unsigned long long)result.meanStepNanoseconds, (unsigned long long)result.baselineStepNanoseconds);
+        }
+        failures += report.errorFlags != 0;
+    }
+
+    return failures != 0;
+}
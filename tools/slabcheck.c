@@ -0,0 +1,198 @@
+// fork, waitpid, and anonymous shared mappings are extensions on top of C17
+#define _GNU_SOURCE
+
+// Project headers
+#include <SBX/slab.h>
+#include <SBX/strings.h>
+#include <SBX/plock.h>
+#include <SBX/step.h>
+#include <SBX/box.h>
+
+// LibC headers
+#include <stdio.h>
+#include <string.h>
+
+// Platform headers
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+// World the check cuts into horizontal slabs, each slab is stepped by its own process
+#define SBX_SLAB_CHECK_WIDTH      150
+#define SBX_SLAB_CHECK_HEIGHT     120
+#define SBX_SLAB_CHECK_SLAB_COUNT 3
+#define SBX_SLAB_CHECK_TICK_COUNT 40
+
+// Cross slab edits, the sender sets the plock after stepping sendTick times and the owner applies it after stepping dueTick times
+typedef struct SBXSlabCheckEdit {
+    uint16_t           sender;
+    uint32_t           sendTick, dueTick;
+    SBX_box_position_t x, y;
+    SBX_plock_t        plock;
+} SBX_slab_check_edit_t;
+
+// The first edit moves two slabs down, the second lands on the first line of the middle slab, which the top slab keeps in its halo.
+// Both replace seeded plocks with seeded neighbors, so applying them on any other tick changes how heat flows around them
+static const SBX_slab_check_edit_t SBXSlabCheckEdits[] = {
+    {.sender = 0, .sendTick = 5,  .dueTick = 7,  .x = 71, .y = 110, .plock = {.type = 3, .temperature = 900}},
+    {.sender = 2, .sendTick = 12, .dueTick = 13, .x = 63, .y = 40,  .plock = {.type = 5, .temperature = -700}}
+};
+#define SBX_SLAB_CHECK_EDIT_COUNT (sizeof(SBXSlabCheckEdits) / sizeof(SBXSlabCheckEdits[0]))
+
+// Seeds a third of the world with plocks derived from their position, so the slabs and the single box start from the same state
+static SBX_plock_t SBXSlabCheckSeed(SBX_box_position_t x, SBX_box_position_t y) {
+    uint64_t hash = ((uint64_t)x << 16 | y) + 0x9E3779B97F4A7C15ULL;
+    hash = (hash ^ (hash >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    hash = (hash ^ (hash >> 27)) * 0x94D049BB133111EBULL;
+    hash ^= hash >> 31;
+
+    if(hash % 3) {
+        return (SBX_plock_t){.type = SBX_PLOCK_TYPE_ID_UNSET, .temperature = 0};
+    }
+    return (SBX_plock_t){
+        .type        = (SBX_plock_type_id_t)(1 + (hash >> 8) % 8),
+        .temperature = (SBX_plock_temperature_t)((hash >> 16) % 2000) - 1000
+    };
+}
+
+// Runs one slab in a child process and writes its owned plocks into the shared result, returns the exit status of the child
+static int SBXSlabCheckRunSlab(const char* name, uint16_t index, SBX_plock_t* result) {
+    SBX_slab_t*  slab;
+    SBX_report_t report = SBXSlabAttach(&slab, name, index);
+    if(report.errorFlags) {
+        printf("slabs: slab %u: %s\n", index, report.reportMessage);
+        return 1;
+    }
+
+    for(uint32_t y = slab->firstLine; y < slab->lastLine; y++) {
+        for(uint32_t x = 0; x < SBX_SLAB_CHECK_WIDTH; x++) {
+            SBX_plock_t plock = SBXSlabCheckSeed((SBX_box_position_t)x, (SBX_box_position_t)y);
+            if(plock.type != SBX_PLOCK_TYPE_ID_UNSET) {
+                SBXSlabSetPlock(slab, (SBX_box_position_t)x, (SBX_box_position_t)y, plock);
+            }
+        }
+    }
+
+    for(uint32_t tick = 0; !report.errorFlags && (tick < SBX_SLAB_CHECK_TICK_COUNT); tick++) {
+        for(uint32_t i = 0; !report.errorFlags && (i < SBX_SLAB_CHECK_EDIT_COUNT); i++) {
+            const SBX_slab_check_edit_t* edit = &SBXSlabCheckEdits[i];
+            if((edit->sender == index) && (edit->sendTick == tick)) {
+                report = SBXSlabSetPlock(slab, edit->x, edit->y, edit->plock);
+            }
+        }
+        if(!report.errorFlags) {
+            report = SBXSlabStep(slab);
+        }
+    }
+    if(report.errorFlags) {
+        printf("slabs: slab %u: %s\n", index, report.reportMessage);
+        SBXSlabDetach(slab);
+        return 1;
+    }
+
+    for(uint32_t y = slab->firstLine; y < slab->lastLine; y++) {
+        for(uint32_t x = 0; x < SBX_SLAB_CHECK_WIDTH; x++) {
+            SBX_box_position_t localX, localY;
+            SBXSlabGetLocalPosition(slab, (SBX_box_position_t)x, (SBX_box_position_t)y, &localX, &localY);
+            SBXBoxGetPlock(slab->box, localX, localY, &result[y * SBX_SLAB_CHECK_WIDTH + x]);
+        }
+    }
+
+    SBXSlabDetach(slab);
+    return 0;
+}
+
+// Steps a world cut into slabs by one process each next to the same world in a single box, with edits that cross slabs, and fails on any plock that differs
+int main(void) {
+    char name[64];
+    snprintf(name, sizeof(name), "/sbx-slab-check-%ld", (long)getpid());
+
+    size_t       resultSize = sizeof(SBX_plock_t) * SBX_SLAB_CHECK_WIDTH * SBX_SLAB_CHECK_HEIGHT;
+    SBX_plock_t* result     = mmap(NULL, resultSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if(result == MAP_FAILED) {
+        printf("slabs: %s\n", SBX_REPORT_STRING_COMMON_MEMORY_FAILURE);
+        return 1;
+    }
+
+    SBX_report_t report = SBXSlabGroupCreate(name, SBX_SLAB_AXIS_HORIZONTAL, SBX_SLAB_CHECK_WIDTH, SBX_SLAB_CHECK_HEIGHT, SBX_SLAB_CHECK_SLAB_COUNT, 64);
+    if(report.errorFlags) {
+        printf("slabs: %s\n", report.reportMessage);
+        return 1;
+    }
+
+    // Every slab runs in its own process, as it would on a host
+    fflush(stdout);
+    pid_t children[SBX_SLAB_CHECK_SLAB_COUNT];
+    int   failures = 0;
+    for(uint16_t i = 0; i < SBX_SLAB_CHECK_SLAB_COUNT; i++) {
+        children[i] = fork();
+        if(!children[i]) {
+            int status = SBXSlabCheckRunSlab(name, i, result);
+            fflush(stdout);
+            _exit(status);
+        }
+        if(children[i] < 0) {
+            printf("slabs: could not fork slab %u\n", i);
+            failures++;
+        }
+    }
+    for(uint16_t i = 0; i < SBX_SLAB_CHECK_SLAB_COUNT; i++) {
+        int status = 1;
+        if((children[i] > 0) && ((waitpid(children[i], &status, 0) != children[i]) || !WIFEXITED(status) || WEXITSTATUS(status))) {
+            printf("slabs: slab %u failed\n", i);
+            failures++;
+        }
+    }
+    SBXSlabGroupDestroy(name);
+
+    // The same world in one box, edits land on the tick their owner applies them
+    SBX_box_t* box;
+    report = SBXBoxCreate(&box);
+    if(!report.errorFlags) {
+        report = SBXBoxInit(box, SBX_SLAB_CHECK_WIDTH, SBX_SLAB_CHECK_HEIGHT);
+    }
+    if(report.errorFlags) {
+        printf("slabs: %s\n", report.reportMessage);
+        return 1;
+    }
+    for(uint32_t y = 0; y < SBX_SLAB_CHECK_HEIGHT; y++) {
+        for(uint32_t x = 0; x < SBX_SLAB_CHECK_WIDTH; x++) {
+            SBX_plock_t plock = SBXSlabCheckSeed((SBX_box_position_t)x, (SBX_box_position_t)y);
+            if(plock.type != SBX_PLOCK_TYPE_ID_UNSET) {
+                SBXBoxSetPlock(box, (SBX_box_position_t)x, (SBX_box_position_t)y, plock);
+            }
+        }
+    }
+    for(uint32_t tick = 0; tick < SBX_SLAB_CHECK_TICK_COUNT; tick++) {
+        for(uint32_t i = 0; i < SBX_SLAB_CHECK_EDIT_COUNT; i++) {
+            if(SBXSlabCheckEdits[i].dueTick == tick) {
+                SBXBoxSetPlock(box, SBXSlabCheckEdits[i].x, SBXSlabCheckEdits[i].y, SBXSlabCheckEdits[i].plock);
+            }
+        }
+        SBXBoxStep(box);
+    }
+
+    // Compare cell for cell, temperatures included, every slab diffuses its borders from the halo so nothing may drift
+    uint32_t mismatches = 0;
+    for(uint32_t y = 0; !failures && (y < SBX_SLAB_CHECK_HEIGHT); y++) {
+        for(uint32_t x = 0; x < SBX_SLAB_CHECK_WIDTH; x++) {
+            SBX_plock_t expected, actual = result[y * SBX_SLAB_CHECK_WIDTH + x];
+            SBXBoxGetPlock(box, (SBX_box_position_t)x, (SBX_box_position_t)y, &expected);
+            if((expected.type != actual.type) || (expected.temperature != actual.temperature)) {
+                if(mismatches < 8) {
+                    printf("slabs: plock %u, %u is type %u at %Lf, the single box has type %u at %Lf\n",
+                           x, y, actual.type, actual.temperature, expected.type, expected.temperature);
+                }
+                mismatches++;
+            }
+        }
+    }
+    failures += mismatches != 0;
+
+    SBXBoxDeinit(box);
+    SBXBoxDestroy(box);
+    munmap(result, resultSize);
+
+    printf("slabs: %s\n", failures ? "failed" : "passed");
+    return failures != 0;
+}